@@ -0,0 +1,56 @@
+// ComparisonDialog.cpp - Defines the ComparisonDialog class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ComparisonDialog.h"
+
+ComparisonDialog::ComparisonDialog(
+    wxWindow* parent, const UsageComparison& comparison,
+    const std::vector<Instruction>& instructions,
+    const wxString& baselineName, const wxString& currentName)
+    : wxDialog{ parent, wxID_ANY, "Compare With Baseline", wxDefaultPosition,
+                wxDefaultSize, wxDEFAULT_DIALOG_STYLE | wxRESIZE_BORDER }
+{
+    wxString summary;
+    summary << comparison.ChangedCount() << " of " << instructions.size();
+    summary << " instructions changed from " << baselineName << " to ";
+    summary << currentName << ". Functions are matched by name.";
+
+    wxStaticText* summaryLabel = new wxStaticText{ this, wxID_ANY, summary };
+
+    totalListView = new ComparisonListView{ this, comparison, instructions,
+                                            false };
+    functionListView = new ComparisonListView{ this, comparison,
+                                               instructions, true };
+
+    wxStaticBoxSizer* totalSizer = new wxStaticBoxSizer{ wxVERTICAL, this,
+                                                         "Instructions" };
+    totalSizer->Add(totalListView, 1, wxALL | wxEXPAND, 5);
+
+    wxStaticBoxSizer* functionSizer = new wxStaticBoxSizer{ wxVERTICAL, this,
+                                                            "Functions" };
+    functionSizer->Add(functionListView, 1, wxALL | wxEXPAND, 5);
+
+    wxBoxSizer* listSizer = new wxBoxSizer{ wxHORIZONTAL };
+    listSizer->Add(totalSizer, 2, wxALL | wxEXPAND, 5);
+    listSizer->Add(functionSizer, 3, wxALL | wxEXPAND, 5);
+
+    wxBoxSizer* dialogSizer = new wxBoxSizer{ wxVERTICAL };
+    dialogSizer->Add(summaryLabel, 0, wxALL | wxEXPAND, 10);
+    dialogSizer->Add(listSizer, 1, wxEXPAND);
+    dialogSizer->Add(CreateButtonSizer(wxOK), 0, wxALL | wxEXPAND, 10);
+
+    SetSizerAndFit(dialogSizer);
+}
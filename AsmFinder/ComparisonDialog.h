@@ -0,0 +1,47 @@
+// ComparisonDialog.h - Declares the ComparisonDialog class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef COMPARISON_DIALOG_H
+#define COMPARISON_DIALOG_H
+
+#include <vector>
+#include <wx/wx.h>
+#include "ComparisonListView.h"
+#include "Instruction.h"
+#include "UsageComparison.h"
+
+/// @brief Shows how the count of each instruction changed between two
+/// builds, in total and in each function.
+class ComparisonDialog : public wxDialog
+{
+public:
+    /// @brief Constructor; creates a new instance of ComparisonDialog.
+    /// @param parent The window the dialog belongs to.
+    /// @param comparison The comparison to show. Must outlive the dialog.
+    /// @param instructions The instructions that were searched for. Must
+    /// outlive the dialog.
+    /// @param baselineName The name of the baseline build's file.
+    /// @param currentName The name of the current build's file.
+    ComparisonDialog(wxWindow* parent, const UsageComparison& comparison,
+                     const std::vector<Instruction>& instructions,
+                     const wxString& baselineName,
+                     const wxString& currentName);
+private:
+    ComparisonListView* totalListView;
+    ComparisonListView* functionListView;
+};
+
+#endif
@@ -0,0 +1,155 @@
+// ComparisonListView.cpp - Defines the ComparisonListView class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ComparisonListView.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+ComparisonListView::ComparisonListView(
+    wxWindow* parent, const UsageComparison& comparison,
+    const std::vector<Instruction>& instructions, bool byFunction)
+    : wxListView{ parent, wxID_ANY, wxDefaultPosition, wxSize{ 460, 300 },
+                  wxLC_REPORT | wxLC_VIRTUAL },
+      comparison{ comparison }, instructions{ instructions },
+      rows{ byFunction ? comparison.Functions() : comparison.Totals() },
+      order(rows.size()), firstColumn{ byFunction ? Column::Function
+                                                  : Column::Name }
+{
+    if (byFunction)
+        AppendColumn("Function", wxLIST_FORMAT_LEFT, 160);
+
+    AppendColumn("Instruction", wxLIST_FORMAT_LEFT, 120);
+    AppendColumn("Baseline", wxLIST_FORMAT_RIGHT, 80);
+    AppendColumn("Current", wxLIST_FORMAT_RIGHT, 80);
+    AppendColumn("Change", wxLIST_FORMAT_RIGHT, 80);
+
+    for (std::size_t i = 0; i < order.size(); i++)
+        order[i] = i;
+
+    Sort();
+    Bind(wxEVT_LIST_COL_CLICK, &ComparisonListView::OnColumnClick, this);
+}
+
+wxString ComparisonListView::OnGetItemText(long item, long column) const
+{
+    const UsageComparison::Row& row =
+        rows[order[static_cast<std::size_t>(item)]];
+    wxString text;
+
+    switch (column + firstColumn)
+    {
+    case Column::Function:
+    {
+        const std::string& name = comparison.FunctionName(row.function);
+
+        if (name.empty())
+            return "(outside functions)";
+
+        return wxString::FromUTF8(name.data(), name.size());
+    }
+    case Column::Name:
+        return instructions[row.instruction].Name();
+    case Column::Baseline:
+        text << row.baseline;
+        return text;
+    case Column::Current:
+        text << row.current;
+        return text;
+    case Column::Change:
+        if (row.Change() > 0)
+            text << '+';
+
+        text << row.Change();
+        return text;
+    default:
+        return text;
+    }
+}
+
+void ComparisonListView::Sort()
+{
+    // Rows that are equal in the sort column are kept in the order of the
+    // comparison, which is the order of their indexes.
+    auto count = [&](const UsageComparison::Row& row) {
+        if (sortColumn == Column::Baseline)
+            return static_cast<std::int64_t>(row.baseline);
+
+        if (sortColumn == Column::Current)
+            return static_cast<std::int64_t>(row.current);
+
+        return row.Change();
+    };
+
+    auto name = [&](const UsageComparison::Row& row) {
+        if (sortColumn == Column::Function)
+        {
+            const std::string& function =
+                comparison.FunctionName(row.function);
+            return wxString::FromUTF8(function.data(), function.size());
+        }
+
+        return instructions[row.instruction].Name();
+    };
+
+    if (sortColumn != -1)
+    {
+        std::sort(order.begin(), order.end(),
+                  [&](std::size_t a, std::size_t b) {
+            const UsageComparison::Row& first = rows[ascending ? a : b];
+            const UsageComparison::Row& second = rows[ascending ? b : a];
+
+            if (sortColumn == Column::Function || sortColumn == Column::Name)
+            {
+                int difference = name(first).Cmp(name(second));
+
+                if (difference != 0)
+                    return difference < 0;
+            }
+            else if (count(first) != count(second))
+            {
+                return count(first) < count(second);
+            }
+
+            return a < b;
+        });
+    }
+
+    SetItemCount(static_cast<long>(order.size()));
+    Refresh();
+}
+
+void ComparisonListView::OnColumnClick(wxListEvent& event)
+{
+    long column = event.GetColumn() + firstColumn;
+
+    // Names read best A to Z and counts read best largest first.
+    if (column == sortColumn)
+        ascending = !ascending;
+    else
+        ascending = column == Column::Function || column == Column::Name;
+
+    sortColumn = column;
+
+    for (long item = GetFirstSelected(); item != -1;
+         item = GetNextSelected(item))
+    {
+        Select(item, false);
+    }
+
+    Sort();
+}
@@ -0,0 +1,79 @@
+// ComparisonListView.h - Declares the ComparisonListView class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef COMPARISON_LIST_VIEW_H
+#define COMPARISON_LIST_VIEW_H
+
+#include <cstddef>
+#include <vector>
+#include <wx/wx.h>
+#include <wx/listctrl.h>
+#include "Instruction.h"
+#include "UsageComparison.h"
+
+/// @brief Shows the counts of a comparison of two builds, either the total
+/// of each instruction or the changes in each function.
+///
+/// The view is virtual, since a large program can have a change in many
+/// thousands of functions. Clicking a column header sorts by that column,
+/// and clicking it again reverses the order.
+class ComparisonListView : public wxListView
+{
+public:
+    /// @brief Constructor; creates a new instance of ComparisonListView.
+    /// @param parent The window the view belongs to.
+    /// @param comparison The comparison to show. Must outlive the view.
+    /// @param instructions The instructions that were searched for. Must
+    /// outlive the view.
+    /// @param byFunction True to show the changes in each function, or false
+    /// to show the total of each instruction.
+    ComparisonListView(wxWindow* parent, const UsageComparison& comparison,
+                       const std::vector<Instruction>& instructions,
+                       bool byFunction);
+protected:
+    /// @brief Gets the text of a cell.
+    /// @param item The row of the cell.
+    /// @param column The column of the cell.
+    /// @return The text to show in the cell.
+    wxString OnGetItemText(long item, long column) const override;
+private:
+    enum Column
+    {
+        Function = 0,
+        Name = 1,
+        Baseline = 2,
+        Current = 3,
+        Change = 4
+    };
+
+    const UsageComparison& comparison;
+    const std::vector<Instruction>& instructions;
+    const std::vector<UsageComparison::Row>& rows;
+    std::vector<std::size_t> order;
+    long firstColumn;
+    long sortColumn{ -1 };
+    bool ascending{ false };
+
+    /// @brief Sorts the rows by the current sort column, or leaves them in
+    /// the order of the comparison until a column is chosen.
+    void Sort();
+
+    /// @brief Event handler for clicks on a column header.
+    /// @param event The triggering event.
+    void OnColumnClick(wxListEvent& event);
+};
+
+#endif
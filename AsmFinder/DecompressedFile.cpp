@@ -0,0 +1,159 @@
+// DecompressedFile.cpp - Defines the DecompressedFile class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "DecompressedFile.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+    // Assembly listings usually compress to a fifth of their size or
+    // less, which is close enough to show progress before the real size is
+    // known.
+    constexpr std::size_t expectedRatio{ 5 };
+
+    // Address space is reserved for text up to this many times the size of
+    // the compressed file, well beyond what gzip can compress text to.
+    constexpr std::size_t maxRatio{ 1024 };
+
+    // Small files still get room to grow, and the largest reservation is
+    // kept well inside the address space of the process.
+    constexpr std::size_t minCapacity{ std::size_t{ 64 } << 20 };
+    constexpr std::size_t maxCapacity{ sizeof(std::size_t) >= 8
+        ? static_cast<std::size_t>(std::uint64_t{ 1 } << 40)
+        : std::size_t{ 1 } << 30 };
+
+    // The readers are woken each time this much more text is ready, which
+    // is small enough that they rarely wait long and large enough that
+    // waking them costs nothing next to decompressing it.
+    constexpr std::size_t readSize{ 1 << 20 };
+}
+
+DecompressedFile::DecompressedFile(const char* data, std::size_t size,
+                                   Decompressor::Format format) :
+    input{ data },
+    inputSize{ size },
+    format{ format },
+    estimatedSize{ size * expectedRatio }
+{
+}
+
+DecompressedFile::~DecompressedFile()
+{
+    stopping = true;
+
+    if (thread.joinable())
+        thread.join();
+}
+
+const char* DecompressedFile::Data()
+{
+    Start();
+    return text.Data();
+}
+
+std::size_t DecompressedFile::Size()
+{
+    Start();
+
+    if (finished)
+        return size;
+
+    std::unique_lock<std::mutex> lock{ mutex };
+    grown.wait(lock, [&]() { return finished.load(); });
+    return size;
+}
+
+std::size_t DecompressedFile::WaitForSize(std::size_t neededSize)
+{
+    Start();
+
+    if (size >= neededSize || finished)
+        return size;
+
+    std::unique_lock<std::mutex> lock{ mutex };
+    grown.wait(lock, [&]() { return size >= neededSize || finished; });
+    return size;
+}
+
+std::size_t DecompressedFile::ReadySize()
+{
+    Start();
+    return size;
+}
+
+bool DecompressedFile::Failed()
+{
+    Size();
+    return failed;
+}
+
+void DecompressedFile::Start()
+{
+    std::call_once(started, [&]() {
+        std::size_t capacity = inputSize > maxCapacity / maxRatio
+            ? maxCapacity
+            : std::max(inputSize * maxRatio, minCapacity);
+
+        // A process short of address space, such as a 32-bit one, gets as
+        // much of it as it can spare.
+        while (!text.Reserve(capacity) && capacity > minCapacity)
+            capacity /= 2;
+
+        thread = std::thread{ &DecompressedFile::Decompress, this };
+    });
+}
+
+void DecompressedFile::Decompress()
+{
+    Decompressor decompressor;
+    bool succeeded = text.Data() != nullptr &&
+        decompressor.Start(input, inputSize, format);
+    std::size_t decompressed{ 0 };
+
+    while (succeeded && !decompressor.Finished() && !stopping)
+    {
+        std::size_t readEnd = std::min(decompressed + readSize,
+                                       text.Capacity());
+
+        // Text that doesn't fit in the reserved space is treated like a
+        // damaged file, keeping what was read before it.
+        if (readEnd == decompressed || !text.Commit(readEnd))
+        {
+            succeeded = false;
+            break;
+        }
+
+        decompressed += decompressor.Read(text.Data() + decompressed,
+                                          readEnd - decompressed);
+
+        {
+            std::lock_guard<std::mutex> lock{ mutex };
+            size = decompressed;
+        }
+
+        grown.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{ mutex };
+        failed = !succeeded || decompressor.Failed();
+        finished = true;
+    }
+
+    grown.notify_all();
+}
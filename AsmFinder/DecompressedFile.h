@@ -0,0 +1,103 @@
+// DecompressedFile.h - Declares the DecompressedFile class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DECOMPRESSED_FILE_H
+#define DECOMPRESSED_FILE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include "Decompressor.h"
+#include "ReservedMemory.h"
+
+/// @brief Represents the text of a compressed file, which is decompressed
+/// on a thread of its own while the text that is already there is read.
+///
+/// The text is decompressed into reserved address space, so it never moves
+/// as it grows and can be read while more of it is still being written.
+/// Nothing is decompressed until the text is first asked for.
+class DecompressedFile
+{
+public:
+    /// @brief Constructor; prepares to decompress a file.
+    /// @param data The compressed contents of the file. Must outlive the
+    /// DecompressedFile.
+    /// @param size The size of the compressed contents in bytes.
+    /// @param format The format the contents are compressed in, which
+    /// Decompressor::IsSupported() must be true for.
+    DecompressedFile(const char* data, std::size_t size,
+                     Decompressor::Format format);
+
+    /// @brief Destructor; stops decompressing and frees the text.
+    ~DecompressedFile();
+
+    DecompressedFile(const DecompressedFile&) = delete;
+    DecompressedFile& operator=(const DecompressedFile&) = delete;
+
+    /// @brief Gets the text, starting to decompress it if it hasn't been.
+    /// @return A pointer to the first byte of the text, which stays the
+    /// same as more of the text is decompressed.
+    const char* Data();
+
+    /// @brief Gets the size of the whole text, waiting for all of it to be
+    /// decompressed.
+    /// @return The size of the text in bytes.
+    std::size_t Size();
+
+    /// @brief Waits for part of the text to be decompressed.
+    /// @param size The number of bytes from the start of the text needed.
+    /// @return The number of bytes decompressed so far, which is less than
+    /// size only if the whole text is shorter.
+    std::size_t WaitForSize(std::size_t size);
+
+    /// @brief Gets how much of the text is ready without waiting for more.
+    /// @return The number of bytes decompressed so far.
+    std::size_t ReadySize();
+
+    /// @brief Guesses the size of the text without decompressing any of it.
+    /// @return The expected size of the text in bytes.
+    std::size_t EstimatedSize() const { return estimatedSize; }
+
+    /// @brief Determines if the file turned out to be damaged, waiting for
+    /// all of it to be decompressed.
+    /// @return True if decompression stopped early, leaving only the text
+    /// before the damage, otherwise false.
+    bool Failed();
+private:
+    const char* input;
+    std::size_t inputSize;
+    Decompressor::Format format;
+    std::size_t estimatedSize;
+    ReservedMemory text;
+    std::once_flag started;
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable grown;
+    std::atomic<std::size_t> size{ 0 };
+    std::atomic<bool> finished{ false };
+    std::atomic<bool> stopping{ false };
+    bool failed{ false };
+
+    /// @brief Starts decompressing the text, if it hasn't been started.
+    void Start();
+
+    /// @brief Decompresses the whole text. Runs on its own thread.
+    void Decompress();
+};
+
+#endif
@@ -0,0 +1,323 @@
+// Decompressor.cpp - Defines the Decompressor class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Decompressor.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <zlib.h>
+
+#ifdef ASMFINDER_ZSTD
+#include <zstd.h>
+#endif
+
+#ifdef ASMFINDER_LZMA
+#include <lzma.h>
+#endif
+
+namespace
+{
+    constexpr unsigned char gzipMagic[]{ 0x1F, 0x8B };
+    constexpr unsigned char zstdMagic[]{ 0x28, 0xB5, 0x2F, 0xFD };
+    constexpr unsigned char xzMagic[]{ 0xFD, '7', 'z', 'X', 'Z', 0x00 };
+
+    // zlib counts bytes in 32 bits, so larger buffers are passed to it a
+    // slice at a time.
+    constexpr std::size_t maxZlibSlice{ 1 << 30 };
+
+    // Adding 16 to the window size makes zlib read a gzip header and
+    // trailer rather than a zlib one.
+    constexpr int gzipWindowBits{ 15 + 16 };
+
+    template <std::size_t size>
+    bool StartsWith(const char* data, std::size_t dataSize,
+                    const unsigned char (&magic)[size])
+    {
+        return dataSize >= size && std::memcmp(data, magic, size) == 0;
+    }
+}
+
+struct Decompressor::Stream
+{
+    z_stream zlib{};
+#ifdef ASMFINDER_ZSTD
+    ZSTD_DStream* zstd{ nullptr };
+#endif
+#ifdef ASMFINDER_LZMA
+    lzma_stream xz = LZMA_STREAM_INIT;
+#endif
+};
+
+Decompressor::Decompressor() = default;
+
+Decompressor::~Decompressor()
+{
+    End();
+}
+
+Decompressor::Format Decompressor::Detect(const char* data, std::size_t size)
+{
+    if (StartsWith(data, size, gzipMagic))
+        return Format::Gzip;
+
+    if (StartsWith(data, size, zstdMagic))
+        return Format::Zstd;
+
+    if (StartsWith(data, size, xzMagic))
+        return Format::Xz;
+
+    return Format::None;
+}
+
+bool Decompressor::IsSupported(Format format)
+{
+    switch (format)
+    {
+    case Format::Gzip:
+        return true;
+    case Format::Zstd:
+#ifdef ASMFINDER_ZSTD
+        return true;
+#else
+        return false;
+#endif
+    case Format::Xz:
+#ifdef ASMFINDER_LZMA
+        return true;
+#else
+        return false;
+#endif
+    default:
+        return false;
+    }
+}
+
+bool Decompressor::Start(const char* data, std::size_t size, Format format)
+{
+    End();
+    input = data;
+    inputSize = size;
+    consumed = 0;
+    this->format = format;
+    finished = false;
+    failed = false;
+
+    if (!IsSupported(format))
+        return false;
+
+    stream = std::make_unique<Stream>();
+    bool started{ false };
+
+    switch (format)
+    {
+    case Format::Gzip:
+        started = inflateInit2(&stream->zlib, gzipWindowBits) == Z_OK;
+        break;
+#ifdef ASMFINDER_ZSTD
+    case Format::Zstd:
+        stream->zstd = ZSTD_createDStream();
+        started = stream->zstd != nullptr &&
+            !ZSTD_isError(ZSTD_initDStream(stream->zstd));
+        break;
+#endif
+#ifdef ASMFINDER_LZMA
+    case Format::Xz:
+        started = lzma_stream_decoder(&stream->xz, UINT64_MAX,
+                                      LZMA_CONCATENATED) == LZMA_OK;
+        break;
+#endif
+    default:
+        break;
+    }
+
+    if (!started)
+    {
+        End();
+        return false;
+    }
+
+    return true;
+}
+
+std::size_t Decompressor::Read(char* output, std::size_t size)
+{
+    if (!stream || finished)
+        return 0;
+
+    switch (format)
+    {
+    case Format::Gzip:
+        return ReadGzip(output, size);
+    case Format::Zstd:
+        return ReadZstd(output, size);
+    case Format::Xz:
+        return ReadXz(output, size);
+    default:
+        return 0;
+    }
+}
+
+void Decompressor::End()
+{
+    if (!stream)
+        return;
+
+    switch (format)
+    {
+    case Format::Gzip:
+        inflateEnd(&stream->zlib);
+        break;
+#ifdef ASMFINDER_ZSTD
+    case Format::Zstd:
+        ZSTD_freeDStream(stream->zstd);
+        break;
+#endif
+#ifdef ASMFINDER_LZMA
+    case Format::Xz:
+        lzma_end(&stream->xz);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    stream.reset();
+}
+
+std::size_t Decompressor::ReadGzip(char* output, std::size_t size)
+{
+    z_stream& zlib = stream->zlib;
+    std::size_t written{ 0 };
+
+    while (written < size && !finished)
+    {
+        uInt inputSlice = static_cast<uInt>(
+            std::min(inputSize - consumed, maxZlibSlice));
+        uInt outputSlice = static_cast<uInt>(
+            std::min(size - written, maxZlibSlice));
+
+        zlib.next_in = reinterpret_cast<Bytef*>(
+            const_cast<char*>(input + consumed));
+        zlib.avail_in = inputSlice;
+        zlib.next_out = reinterpret_cast<Bytef*>(output + written);
+        zlib.avail_out = outputSlice;
+
+        int result = inflate(&zlib, Z_NO_FLUSH);
+        consumed += inputSlice - zlib.avail_in;
+        written += outputSlice - zlib.avail_out;
+
+        if (result == Z_STREAM_END)
+        {
+            // Another member can follow, which gzip itself reads as more
+            // of the same file. Anything else after the end is ignored,
+            // the same as gzip ignores the padding some tools add.
+            if (Detect(input + consumed, inputSize - consumed) ==
+                Format::Gzip)
+            {
+                inflateReset(&zlib);
+            }
+            else
+            {
+                finished = true;
+            }
+        }
+        else if ((result != Z_OK && result != Z_BUF_ERROR) ||
+                 (zlib.avail_in == inputSlice &&
+                  zlib.avail_out == outputSlice))
+        {
+            // Nothing could be read, so the data is damaged or the file
+            // ends in the middle of a stream.
+            finished = true;
+            failed = true;
+        }
+    }
+
+    return written;
+}
+
+std::size_t Decompressor::ReadZstd(char* output, std::size_t size)
+{
+#ifdef ASMFINDER_ZSTD
+    std::size_t written{ 0 };
+
+    while (written < size && !finished)
+    {
+        ZSTD_inBuffer in{ input + consumed, inputSize - consumed, 0 };
+        ZSTD_outBuffer out{ output + written, size - written, 0 };
+        std::size_t result = ZSTD_decompressStream(stream->zstd, &out, &in);
+        consumed += in.pos;
+        written += out.pos;
+
+        // A result of zero means a frame just ended, and the next one
+        // starts with the next byte if there is one.
+        if (ZSTD_isError(result) || (result != 0 && in.pos == 0 &&
+                                     out.pos == 0))
+        {
+            finished = true;
+            failed = true;
+        }
+        else if (result == 0 && consumed == inputSize)
+        {
+            finished = true;
+        }
+    }
+
+    return written;
+#else
+    (void)output;
+    (void)size;
+    return 0;
+#endif
+}
+
+std::size_t Decompressor::ReadXz(char* output, std::size_t size)
+{
+#ifdef ASMFINDER_LZMA
+    lzma_stream& xz = stream->xz;
+    std::size_t written{ 0 };
+
+    while (written < size && !finished)
+    {
+        xz.next_in = reinterpret_cast<const std::uint8_t*>(input + consumed);
+        xz.avail_in = inputSize - consumed;
+        xz.next_out = reinterpret_cast<std::uint8_t*>(output + written);
+        xz.avail_out = size - written;
+
+        // The whole file is already in memory, so liblzma is told from
+        // the start that no more input will follow what it is given.
+        lzma_ret result = lzma_code(&xz, LZMA_FINISH);
+        consumed = inputSize - xz.avail_in;
+        written = size - xz.avail_out;
+
+        if (result == LZMA_STREAM_END)
+        {
+            finished = true;
+        }
+        else if (result != LZMA_OK)
+        {
+            finished = true;
+            failed = true;
+        }
+    }
+
+    return written;
+#else
+    (void)output;
+    (void)size;
+    return 0;
+#endif
+}
@@ -0,0 +1,120 @@
+// Decompressor.h - Declares the Decompressor class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DECOMPRESSOR_H
+#define DECOMPRESSOR_H
+
+#include <cstddef>
+#include <memory>
+
+/// @brief Decompresses a compressed file held in memory a piece at a time.
+///
+/// gzip is always supported, while zstd and xz are supported when their
+/// libraries were found at build time. A file made of several compressed
+/// streams one after another, as concatenating compressed files makes, is
+/// decompressed as a single stream.
+class Decompressor
+{
+public:
+    /// @brief The kinds of compression a file can have.
+    enum class Format
+    {
+        None,
+        Gzip,
+        Zstd,
+        Xz
+    };
+
+    /// @brief Default constructor; creates a Decompressor that hasn't
+    /// started.
+    Decompressor();
+
+    /// @brief Destructor; frees the state of the decompression.
+    ~Decompressor();
+
+    Decompressor(const Decompressor&) = delete;
+    Decompressor& operator=(const Decompressor&) = delete;
+
+    /// @brief Finds out how a file is compressed from its first bytes.
+    /// @param data The contents of the file.
+    /// @param size The size of the contents in bytes.
+    /// @return The format of the file, or Format::None if it isn't
+    /// compressed.
+    static Format Detect(const char* data, std::size_t size);
+
+    /// @brief Determines if this build can decompress a format.
+    /// @param format The format to check.
+    /// @return True if files in the format can be decompressed, otherwise
+    /// false.
+    static bool IsSupported(Format format);
+
+    /// @brief Starts decompressing a file.
+    /// @param data The compressed contents. Must outlive the decompression.
+    /// @param size The size of the compressed contents in bytes.
+    /// @param format The format of the contents.
+    /// @return True if the decompression could start, otherwise false.
+    bool Start(const char* data, std::size_t size, Format format);
+
+    /// @brief Decompresses the next part of the file.
+    /// @param output Receives the decompressed bytes.
+    /// @param size The size of the output in bytes.
+    /// @return The number of bytes written, which is less than size only
+    /// once the decompression is finished.
+    std::size_t Read(char* output, std::size_t size);
+
+    /// @brief Determines if the decompression is finished.
+    /// @return True if the whole file has been read or it turned out to be
+    /// damaged, otherwise false.
+    bool Finished() const { return finished; }
+
+    /// @brief Determines if the file turned out to be damaged.
+    /// @return True if the decompression stopped at damaged or missing
+    /// data, otherwise false.
+    bool Failed() const { return failed; }
+private:
+    struct Stream;
+
+    const char* input{ nullptr };
+    std::size_t inputSize{ 0 };
+    std::size_t consumed{ 0 };
+    Format format{ Format::None };
+    bool finished{ false };
+    bool failed{ false };
+    std::unique_ptr<Stream> stream;
+
+    /// @brief Frees the state of the decompression, if it has started.
+    void End();
+
+    /// @brief Decompresses the next part of a gzip file.
+    /// @param output Receives the decompressed bytes.
+    /// @param size The size of the output in bytes.
+    /// @return The number of bytes written.
+    std::size_t ReadGzip(char* output, std::size_t size);
+
+    /// @brief Decompresses the next part of a zstd file.
+    /// @param output Receives the decompressed bytes.
+    /// @param size The size of the output in bytes.
+    /// @return The number of bytes written.
+    std::size_t ReadZstd(char* output, std::size_t size);
+
+    /// @brief Decompresses the next part of an xz file.
+    /// @param output Receives the decompressed bytes.
+    /// @param size The size of the output in bytes.
+    /// @return The number of bytes written.
+    std::size_t ReadXz(char* output, std::size_t size);
+};
+
+#endif
@@ -0,0 +1,439 @@
+// Dialect.cpp - Defines the Dialect class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "Dialect.h"
+
+#include <cstring>
+
+namespace
+{
+    bool IsBlank(char c)
+    {
+        return c == ' ' || c == '\t';
+    }
+
+    bool IsHex(char c)
+    {
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') ||
+            (c >= 'A' && c <= 'F');
+    }
+
+    // The characters GNU as and NASM both allow in a label.
+    bool IsLabel(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+            (c >= '0' && c <= '9') || c == '_' || c == '.' || c == '$' ||
+            c == '?' || c == '@' || static_cast<unsigned char>(c) >= 0x80;
+    }
+
+    const char* SkipBlanks(const char* position, const char* end)
+    {
+        while (position != end && IsBlank(*position))
+            position++;
+
+        return position;
+    }
+
+    const char* FindBlank(const char* position, const char* end)
+    {
+        while (position != end && !IsBlank(*position))
+            position++;
+
+        return position;
+    }
+
+    // A line can have several labels before its instruction, such as
+    // "1: loop: daddu ...".
+    const char* SkipLabels(const char* position, const char* end)
+    {
+        for (;;)
+        {
+            const char* label = position;
+
+            while (label != end && IsLabel(*label))
+                label++;
+
+            if (label == position || label == end || *label != ':')
+                return position;
+
+            position = SkipBlanks(label + 1, end);
+        }
+    }
+
+    bool EqualsLower(std::string_view token, const char* lower)
+    {
+        std::size_t size = std::strlen(lower);
+
+        if (token.size() != size)
+            return false;
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            char c = token[i];
+
+            if (c >= 'A' && c <= 'Z')
+                c = static_cast<char>(c - 'A' + 'a');
+
+            if (c != lower[i])
+                return false;
+        }
+
+        return true;
+    }
+
+    // NASM directives and pseudo-instructions that aren't instructions.
+    // The data ones usually follow a label without a colon, as in
+    // "message db 'Hello'".
+    const char* const nasmDirectives[]
+    {
+        "absolute", "align", "alignb", "at", "bits", "common", "cpu",
+        "db", "dd", "default", "do", "dq", "dt", "dw", "dy", "dz",
+        "endstruc", "equ", "extern", "global", "iend", "incbin", "istruc",
+        "org", "resb", "resd", "reso", "resq", "rest", "resw", "resy",
+        "resz", "section", "segment", "struc", "use16", "use32", "use64"
+    };
+
+    bool IsNasmDirective(std::string_view token)
+    {
+        for (const char* directive : nasmDirectives)
+        {
+            if (EqualsLower(token, directive))
+                return true;
+        }
+
+        return false;
+    }
+}
+
+std::optional<Dialect> Dialect::FromName(const wxString& name)
+{
+    for (Kind candidate : kinds)
+    {
+        Dialect dialect{ candidate };
+
+        if (name.Lower() == wxString{ dialect.Name() })
+            return dialect;
+    }
+
+    return std::nullopt;
+}
+
+const char* Dialect::Name() const
+{
+    switch (kind)
+    {
+    case Kind::Gas:
+        return "gas";
+    case Kind::Nasm:
+        return "nasm";
+    case Kind::Objdump:
+        return "objdump";
+    default:
+        return "plain";
+    }
+}
+
+const char* Dialect::Label() const
+{
+    switch (kind)
+    {
+    case Kind::Gas:
+        return "GNU as (MIPS)";
+    case Kind::Nasm:
+        return "NASM";
+    case Kind::Objdump:
+        return "objdump -d";
+    default:
+        return "First word";
+    }
+}
+
+std::string_view Dialect::Split(std::string_view line,
+                                std::string_view& operands,
+                                const LineKernel& kernel) const
+{
+    const char* end = line.data() + line.size();
+    const char* begin = kernel.SkipBlanks(line.data(), end);
+    std::string_view mnemonic;
+
+    switch (kind)
+    {
+    case Kind::Plain:
+        mnemonic = std::string_view(begin, kernel.FindBlank(begin, end) -
+                                    begin);
+        break;
+    case Kind::Gas:
+        mnemonic = SplitGas(begin, end);
+        break;
+    case Kind::Nasm:
+        mnemonic = SplitNasm(begin, end);
+        break;
+    case Kind::Objdump:
+        mnemonic = SplitObjdump(begin, end);
+        break;
+    }
+
+    if (mnemonic.empty())
+        operands = std::string_view{};
+    else
+        operands = std::string_view(mnemonic.data() + mnemonic.size(),
+                                    end - mnemonic.data() - mnemonic.size());
+
+    return mnemonic;
+}
+
+std::string_view Dialect::Symbol(std::string_view line) const
+{
+    // Instructions are indented, so most lines are ruled out by their first
+    // character.
+    if (line.empty() || IsBlank(line[0]))
+        return std::string_view{};
+
+    const char* begin = line.data();
+    const char* end = begin + line.size();
+
+    if (kind == Kind::Objdump)
+    {
+        const char* position = begin;
+
+        while (position != end && IsHex(*position))
+            position++;
+
+        if (position == begin || position == end || !IsBlank(*position))
+            return std::string_view{};
+
+        position = SkipBlanks(position, end);
+
+        if (position == end || *position != '<' || end - position < 3 ||
+            end[-1] != ':' || end[-2] != '>')
+        {
+            return std::string_view{};
+        }
+
+        return std::string_view(position + 1, end - position - 3);
+    }
+
+    if (*begin == '.' || *begin == '$' || (*begin >= '0' && *begin <= '9'))
+        return std::string_view{};
+
+    const char* label = begin;
+
+    while (label != end && IsLabel(*label))
+        label++;
+
+    if (label == begin || label == end || *label != ':')
+        return std::string_view{};
+
+    return std::string_view(begin, label - begin);
+}
+
+std::string_view Dialect::Section(std::string_view line) const
+{
+    const char* begin = line.data();
+    const char* end = begin + line.size();
+
+    if (kind == Kind::Objdump)
+    {
+        constexpr std::string_view prefix{ "Disassembly of section " };
+
+        if (line.size() <= prefix.size() + 1 ||
+            line.substr(0, prefix.size()) != prefix || end[-1] != ':')
+        {
+            return std::string_view{};
+        }
+
+        return line.substr(prefix.size(), line.size() - prefix.size() - 1);
+    }
+
+    const char* position = SkipBlanks(begin, end);
+
+    // Directives are ruled out by their first character before any of them
+    // is compared.
+    if (kind == Kind::Nasm)
+    {
+        // "[section .text]" is the primitive form of "section .text".
+        if (position != end && *position == '[')
+            position = SkipBlanks(position + 1, end);
+
+        if (position == end || (*position != 's' && *position != 'S'))
+            return std::string_view{};
+
+        const char* directiveEnd = FindBlank(position, end);
+        std::string_view directive(position, directiveEnd - position);
+
+        if (!EqualsLower(directive, "section") &&
+            !EqualsLower(directive, "segment"))
+        {
+            return std::string_view{};
+        }
+
+        const char* name = SkipBlanks(directiveEnd, end);
+        const char* nameEnd = name;
+
+        while (nameEnd != end && !IsBlank(*nameEnd) && *nameEnd != ']' &&
+               *nameEnd != ';')
+        {
+            nameEnd++;
+        }
+
+        return std::string_view(name, nameEnd - name);
+    }
+
+    if (position == end || *position != '.')
+        return std::string_view{};
+
+    const char* directiveEnd = FindBlank(position, end);
+    std::string_view directive(position, directiveEnd - position);
+
+    if (directive == ".text" || directive == ".data" || directive == ".bss")
+        return directive;
+
+    if (directive != ".section")
+        return std::string_view{};
+
+    // The flags and type follow the name, as in
+    // ".section .rodata,\"a\",@progbits".
+    const char* name = SkipBlanks(directiveEnd, end);
+    const char* nameEnd = name;
+
+    while (nameEnd != end && !IsBlank(*nameEnd) && *nameEnd != ',' &&
+           *nameEnd != '#')
+    {
+        nameEnd++;
+    }
+
+    return std::string_view(name, nameEnd - name);
+}
+
+std::string_view Dialect::SplitGas(const char* begin, const char* end)
+{
+    begin = SkipLabels(begin, end);
+
+    // Comments start with "#", "//" or "/*", and so do preprocessor lines.
+    // Everything starting with a "." is a directive.
+    if (begin == end || *begin == '#' || *begin == '.' ||
+        (*begin == '/' && end - begin > 1 &&
+         (begin[1] == '/' || begin[1] == '*')))
+    {
+        return std::string_view{};
+    }
+
+    const char* mnemonicEnd = FindBlank(begin, end);
+
+    // "size = 16" sets a symbol.
+    const char* next = SkipBlanks(mnemonicEnd, end);
+
+    if (next != end && *next == '=')
+        return std::string_view{};
+
+    return std::string_view(begin, mnemonicEnd - begin);
+}
+
+std::string_view Dialect::SplitNasm(const char* begin, const char* end)
+{
+    begin = SkipLabels(begin, end);
+
+    // "%" starts a preprocessor line and "[" a directive such as
+    // "[bits 32]".
+    if (begin == end || *begin == ';' || *begin == '%' || *begin == '[')
+        return std::string_view{};
+
+    const char* mnemonicEnd = FindBlank(begin, end);
+    std::string_view mnemonic(begin, mnemonicEnd - begin);
+
+    if (IsNasmDirective(mnemonic))
+        return std::string_view{};
+
+    // A label doesn't need a colon, so "message db 'Hello'" is data.
+    const char* next = SkipBlanks(mnemonicEnd, end);
+    std::string_view second(next, FindBlank(next, end) - next);
+
+    if (IsNasmDirective(second))
+        return std::string_view{};
+
+    return mnemonic;
+}
+
+std::string_view Dialect::SplitObjdump(const char* begin, const char* end)
+{
+    // Instruction lines start with their address, as in
+    // "  4c:\t27bdffe0 \taddiu\tsp,sp,-32". Headers, symbol lines such as
+    // "0000000000000000 <main>:" and "..." don't.
+    const char* position = begin;
+
+    while (position != end && IsHex(*position))
+        position++;
+
+    if (position == begin || position == end || *position != ':')
+        return std::string_view{};
+
+    position = SkipBlanks(position + 1, end);
+
+    // The instruction bytes are groups of hex digits separated by single
+    // spaces, such as "48 89 e5" for x86 or "27bdffe0" for MIPS. objdump
+    // closes the column with blanks ending in " \t", which a mnemonic made
+    // of hex letters, such as "dadd" or "fadd", is never followed by. A long
+    // instruction continues on lines that only have bytes. Without
+    // --show-raw-insn there are no bytes and the mnemonic comes first.
+    const char* bytes = position;
+
+    while (position != end)
+    {
+        const char* group = position;
+
+        while (group != end && IsHex(*group))
+            group++;
+
+        std::size_t digits = group - position;
+
+        if (digits < 2 || digits % 2 != 0 ||
+            (group != end && !IsBlank(*group)))
+        {
+            position = bytes;
+            break;
+        }
+
+        const char* next = SkipBlanks(group, end);
+
+        // Only a lone word with nothing after it, such as "fadd", can be a
+        // mnemonic. Anything else that runs to the end of the line is the
+        // rest of the bytes of the instruction before.
+        if (next == end)
+        {
+            if (group == end && position == bytes)
+                break;
+
+            return std::string_view{};
+        }
+
+        position = next;
+
+        if (next - group >= 2 && next[-1] == '\t' && next[-2] == ' ')
+            break;
+
+        if (next - group != 1 || *group != ' ')
+        {
+            position = bytes;
+            break;
+        }
+    }
+
+    if (position == end)
+        return std::string_view{};
+
+    return std::string_view(position, FindBlank(position, end) - position);
+}
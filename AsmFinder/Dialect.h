@@ -0,0 +1,132 @@
+// Dialect.h - Declares the Dialect class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef DIALECT_H
+#define DIALECT_H
+
+#include <optional>
+#include <string_view>
+#include <wx/string.h>
+#include "LineKernel.h"
+
+/// @brief Finds the mnemonic of a line the way an assembler or disassembler
+/// would read it.
+///
+/// The plain dialect takes the first whitespace-delimited token of every
+/// line, which is how AsmFinder has always worked. The others skip comment
+/// and directive lines and strip labels, and the objdump dialect also
+/// strips the address and instruction bytes in front of each mnemonic, so a
+/// line whose instruction isn't the first token still matches it.
+class Dialect
+{
+public:
+    /// @brief Identifies a dialect.
+    enum class Kind
+    {
+        Plain,
+        Gas,
+        Nasm,
+        Objdump
+    };
+
+    /// @brief Every dialect, in the order they are offered to the user.
+    static constexpr Kind kinds[]{ Kind::Plain, Kind::Gas, Kind::Nasm,
+                                   Kind::Objdump };
+
+    /// @brief Default constructor; creates the plain dialect.
+    Dialect() = default;
+
+    /// @brief Constructor; creates a new instance of Dialect.
+    /// @param kind The dialect.
+    explicit Dialect(Kind kind) : kind{ kind } {}
+
+    /// @brief Finds a dialect by the name Name() gives it.
+    /// @param name The name, in any case.
+    /// @return The dialect, or nothing if there is none with the name.
+    static std::optional<Dialect> FromName(const wxString& name);
+
+    /// @brief Gets which dialect this is.
+    /// @return The kind of dialect.
+    Kind GetKind() const { return kind; }
+
+    /// @brief Gets the short name of the dialect, as used on the command
+    /// line.
+    /// @return The name, such as "gas".
+    const char* Name() const;
+
+    /// @brief Gets the name of the dialect to show to the user.
+    /// @return The name, such as "GNU as (MIPS)".
+    const char* Label() const;
+
+    /// @brief Finds the mnemonic of a line.
+    /// @param line The text of the line, without its line ending.
+    /// @param operands Receives the text of the line after the mnemonic.
+    /// @param kernel The kernel that skips blanks.
+    /// @return The mnemonic as it appears in the line, which is empty if
+    /// the line has no instruction.
+    std::string_view Split(std::string_view line, std::string_view& operands,
+                           const LineKernel& kernel = LineKernel::Best()) const;
+
+    /// @brief Finds the function a line starts.
+    ///
+    /// objdump starts each function with a symbol line such as
+    /// "0000000000401000 <main>:". In source, a function starts with a
+    /// label at the start of the line, such as "main:". Local labels, which
+    /// start with "." or "$" or are numbers, are only jumped to within a
+    /// function and don't start one.
+    /// @param line The text of the line, without its line ending.
+    /// @return The name of the function, which is empty if the line doesn't
+    /// start one.
+    std::string_view Symbol(std::string_view line) const;
+
+    /// @brief Finds the section a line starts.
+    ///
+    /// objdump starts each section with a line such as "Disassembly of
+    /// section .text:". In NASM source, a section starts with a "section"
+    /// or "segment" directive, and in other source with a ".section"
+    /// directive or the ".text", ".data" and ".bss" directives that stand
+    /// for one.
+    /// @param line The text of the line, without its line ending.
+    /// @return The name of the section, which is empty if the line doesn't
+    /// start one.
+    std::string_view Section(std::string_view line) const;
+private:
+    Kind kind{ Kind::Plain };
+
+    /// @brief Finds the mnemonic of a GNU as line.
+    /// @param begin The first byte after any leading blanks.
+    /// @param end One past the last byte of the line.
+    /// @return The mnemonic, which is empty for a comment, directive or
+    /// label line.
+    static std::string_view SplitGas(const char* begin, const char* end);
+
+    /// @brief Finds the mnemonic of a NASM line.
+    /// @param begin The first byte after any leading blanks.
+    /// @param end One past the last byte of the line.
+    /// @return The mnemonic, which is empty for a comment, directive or
+    /// label line.
+    static std::string_view SplitNasm(const char* begin, const char* end);
+
+    /// @brief Finds the mnemonic of a line of objdump -d output.
+    /// @param begin The first byte after any leading blanks.
+    /// @param end One past the last byte of the line.
+    /// @return The mnemonic, which is empty for any line other than an
+    /// instruction.
+    static std::string_view SplitObjdump(const char* begin, const char* end);
+};
+
+#endif
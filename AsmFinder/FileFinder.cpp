@@ -0,0 +1,138 @@
+// FileFinder.cpp - Defines the FileFinder class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "FileFinder.h"
+
+#include <algorithm>
+#include <wx/dir.h>
+#include <wx/filename.h>
+#include <wx/tokenzr.h>
+
+namespace
+{
+    /// @brief Collects the included files while a directory tree is walked.
+    class Collector : public wxDirTraverser
+    {
+    public:
+        Collector(const FileFinder& finder, const wxString& directory,
+                  std::vector<wxString>& paths)
+            : finder{ finder }, directory{ directory }, paths{ paths }
+        {}
+
+        wxDirTraverseResult OnFile(const wxString& path) override
+        {
+            if (finder.IsIncluded(RelativePath(path)))
+                paths.push_back(path);
+
+            return wxDIR_CONTINUE;
+        }
+
+        wxDirTraverseResult OnDir(const wxString& path) override
+        {
+            return finder.IsExcluded(RelativePath(path)) ? wxDIR_IGNORE
+                                                         : wxDIR_CONTINUE;
+        }
+    private:
+        const FileFinder& finder;
+        wxString directory;
+        std::vector<wxString>& paths;
+
+        wxString RelativePath(const wxString& path) const
+        {
+            wxFileName name{ path };
+            name.MakeRelativeTo(directory);
+            return name.GetFullPath(wxPATH_UNIX);
+        }
+    };
+}
+
+void FileFinder::SetIncludePatterns(const wxString& patterns)
+{
+    includePatterns = SplitPatterns(patterns);
+}
+
+void FileFinder::SetExcludePatterns(const wxString& patterns)
+{
+    excludePatterns = SplitPatterns(patterns);
+}
+
+bool FileFinder::Find(const wxString& directory,
+                      std::vector<wxString>& paths) const
+{
+    wxDir dir{ directory };
+
+    if (!dir.IsOpened())
+        return false;
+
+    // Symbolic links to directories aren't followed, so a link back up the
+    // tree can't make the walk go on forever.
+    std::size_t first = paths.size();
+    Collector collector{ *this, directory, paths };
+    dir.Traverse(collector, wxEmptyString,
+                 wxDIR_FILES | wxDIR_DIRS | wxDIR_HIDDEN | wxDIR_NO_FOLLOW);
+    std::sort(paths.begin() + first, paths.end());
+    return true;
+}
+
+bool FileFinder::IsIncluded(const wxString& relativePath) const
+{
+    if (!includePatterns.empty() &&
+        !MatchesAny(includePatterns, relativePath))
+    {
+        return false;
+    }
+
+    return !IsExcluded(relativePath);
+}
+
+bool FileFinder::IsExcluded(const wxString& relativePath) const
+{
+    return MatchesAny(excludePatterns, relativePath);
+}
+
+std::vector<wxString> FileFinder::SplitPatterns(const wxString& patterns)
+{
+    std::vector<wxString> split;
+    wxStringTokenizer tokenizer{ patterns, ";" };
+
+    while (tokenizer.HasMoreTokens())
+    {
+        wxString pattern = tokenizer.GetNextToken().Trim().Trim(false);
+
+        if (!pattern.empty())
+            split.push_back(pattern);
+    }
+
+    return split;
+}
+
+bool FileFinder::MatchesAny(const std::vector<wxString>& patterns,
+                            const wxString& relativePath)
+{
+    wxString name = relativePath.AfterLast('/');
+
+    for (auto& pattern : patterns)
+    {
+        const wxString& text = pattern.Find('/') == wxNOT_FOUND ? name
+                                                                : relativePath;
+
+        if (wxMatchWild(pattern, text, false))
+            return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,78 @@
+// FileFinder.h - Declares the FileFinder class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef FILE_FINDER_H
+#define FILE_FINDER_H
+
+#include <vector>
+#include <wx/string.h>
+
+/// @brief Finds the source files in a directory tree.
+///
+/// Files are chosen with include and exclude patterns such as "*.s;*.asm".
+/// A pattern without a path separator is matched against the name of each
+/// file and directory, and one with a separator is matched against the path
+/// relative to the top directory, always written with "/". Excluding a
+/// directory skips everything in it.
+class FileFinder
+{
+public:
+    /// @brief Sets the files to include.
+    /// @param patterns Wildcard patterns separated by semicolons. An empty
+    /// string includes every file.
+    void SetIncludePatterns(const wxString& patterns);
+
+    /// @brief Sets the files and directories to exclude.
+    /// @param patterns Wildcard patterns separated by semicolons.
+    void SetExcludePatterns(const wxString& patterns);
+
+    /// @brief Finds the files in a directory and all the ones below it.
+    /// @param directory The top directory.
+    /// @param paths Receives the paths of the files found, sorted so the
+    /// same tree always gives the same order.
+    /// @return True if the directory could be read, otherwise false.
+    bool Find(const wxString& directory, std::vector<wxString>& paths) const;
+
+    /// @brief Determines if a file is included.
+    /// @param relativePath The path of the file relative to the top
+    /// directory, using "/" as the separator.
+    /// @return True if the file is included and not excluded.
+    bool IsIncluded(const wxString& relativePath) const;
+
+    /// @brief Determines if a directory is excluded.
+    /// @param relativePath The path of the directory relative to the top
+    /// directory, using "/" as the separator.
+    /// @return True if the directory and everything in it are skipped.
+    bool IsExcluded(const wxString& relativePath) const;
+private:
+    std::vector<wxString> includePatterns;
+    std::vector<wxString> excludePatterns;
+
+    /// @brief Splits a list of patterns.
+    /// @param patterns Wildcard patterns separated by semicolons.
+    /// @return The patterns, without any empty ones.
+    static std::vector<wxString> SplitPatterns(const wxString& patterns);
+
+    /// @brief Determines if a path matches any of a list of patterns.
+    /// @param patterns The patterns.
+    /// @param relativePath The relative path, using "/" as the separator.
+    /// @return True if a pattern matches, otherwise false.
+    static bool MatchesAny(const std::vector<wxString>& patterns,
+                           const wxString& relativePath);
+};
+
+#endif
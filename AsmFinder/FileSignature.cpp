@@ -0,0 +1,206 @@
+// FileSignature.cpp - Defines the FileSignature class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "FileSignature.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace
+{
+    std::uint64_t HashBlock(const char* data, std::size_t size)
+    {
+        // The bytes are mixed in a word at a time, which keeps hashing far
+        // cheaper than searching the same text.
+        constexpr std::uint64_t prime{ 0x9E3779B97F4A7C15ULL };
+        std::uint64_t hash{ size * prime };
+        std::size_t i{ 0 };
+
+        for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t))
+        {
+            std::uint64_t word;
+            std::memcpy(&word, data + i, sizeof(word));
+            hash = (hash ^ word) * prime;
+            hash ^= hash >> 32;
+        }
+
+        for (; i < size; i++)
+        {
+            hash = (hash ^ static_cast<unsigned char>(data[i])) * prime;
+            hash ^= hash >> 32;
+        }
+
+        return hash;
+    }
+
+    /// @brief Counts the lines that start in a range.
+    /// @param data The whole text.
+    /// @param from The first offset of the range.
+    /// @param to The offset after the range, which must be inside the text.
+    /// @return The number of lines that start in the range.
+    std::uint32_t CountLineStarts(const char* data, std::size_t from,
+                                  std::size_t to)
+    {
+        // A line starts at the beginning of the text and after every line
+        // ending, where "\r\n" is a single line ending, the same as
+        // LineScanner splits lines.
+        std::uint32_t count{ 0 };
+
+        if (from == 0 && to > 0)
+        {
+            count++;
+            from++;
+        }
+
+        for (std::size_t i = from; i < to; i++)
+        {
+            char previous = data[i - 1];
+            count += (previous == '\n') |
+                     ((previous == '\r') & (data[i] != '\n'));
+        }
+
+        return count;
+    }
+
+    bool IsLineStart(const char* data, std::size_t offset)
+    {
+        return offset == 0 || CountLineStarts(data, offset, offset + 1) == 1;
+    }
+}
+
+void FileSignature::Compute(const char* data, std::size_t size,
+                            unsigned threadCount)
+{
+    std::size_t headCount = (size + blockSize - 1) / blockSize;
+    std::size_t tailCount = size / blockSize;
+
+    this->size = size;
+    headHashes.assign(headCount, 0);
+    tailHashes.assign(tailCount, 0);
+    linesBefore.assign(headCount + 1, 0);
+
+    // Every block is independent, so the threads take every nth block.
+    std::size_t workerCount = std::max<std::size_t>(
+        std::min<std::size_t>(threadCount, headCount), 1);
+
+    auto work = [&](std::size_t first) {
+        for (std::size_t i = first; i < headCount; i += workerCount)
+        {
+            std::size_t begin = i * blockSize;
+            std::size_t end = std::min(begin + blockSize, size);
+            headHashes[i] = HashBlock(data + begin, end - begin);
+            linesBefore[i + 1] = CountLineStarts(data, begin, end);
+
+            if (i < tailCount)
+            {
+                tailHashes[i] = HashBlock(data + size - (i + 1) * blockSize,
+                                          blockSize);
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+
+    for (std::size_t i = 1; i < workerCount; i++)
+        workers.emplace_back(work, i);
+
+    work(0);
+
+    for (auto& worker : workers)
+        worker.join();
+
+    // Each block was counted on its own, so the counts are added up to get
+    // the number of lines before each one.
+    for (std::size_t i = 1; i <= headCount; i++)
+        linesBefore[i] += linesBefore[i - 1];
+
+    lineCount = linesBefore[headCount];
+    valid = true;
+}
+
+bool FileSignature::Compare(const FileSignature& newer, const char* newData,
+                            FileChange& change) const
+{
+    std::size_t commonSize = std::min(size, newer.size);
+
+    if (size == newer.size && headHashes == newer.headHashes)
+        return false;
+
+    // Only whole blocks that match are skipped, so a block that was only
+    // partly written before is searched again.
+    std::size_t headBlocks{ 0 };
+
+    while ((headBlocks + 1) * blockSize <= commonSize &&
+           headHashes[headBlocks] == newer.headHashes[headBlocks])
+    {
+        headBlocks++;
+    }
+
+    std::size_t tailBlocks{ 0 };
+
+    while (tailBlocks < tailHashes.size() &&
+           tailBlocks < newer.tailHashes.size() &&
+           tailHashes[tailBlocks] == newer.tailHashes[tailBlocks])
+    {
+        tailBlocks++;
+    }
+
+    std::size_t headSize = headBlocks * blockSize;
+    std::size_t tailSize = std::min(tailBlocks * blockSize,
+                                    commonSize - headSize);
+
+    // The change is widened to whole lines. Whether a line starts at an
+    // offset depends on the bytes on both sides of it, so the start is
+    // moved to a line before the first changed byte and the end to a line
+    // after the last one.
+    std::size_t begin = headSize;
+
+    while (begin > 0 && (begin == headSize || !IsLineStart(newData, begin)))
+        begin--;
+
+    std::size_t newEnd = newer.size - tailSize;
+
+    if (newEnd < newer.size)
+    {
+        newEnd++;
+
+        while (newEnd < newer.size && !IsLineStart(newData, newEnd))
+            newEnd++;
+    }
+
+    change.begin = begin;
+    change.newEnd = newEnd;
+    change.oldEnd = size - (newer.size - newEnd);
+    change.firstLine = newer.LinesBefore(newData, begin);
+
+    // The lines after the change are the same in both versions, so they
+    // keep the same distance from the end of the file.
+    change.lineShift = static_cast<std::int64_t>(newer.lineCount) -
+        static_cast<std::int64_t>(lineCount);
+    change.offsetShift = static_cast<std::int64_t>(newer.size) -
+        static_cast<std::int64_t>(size);
+    return true;
+}
+
+std::uint32_t FileSignature::LinesBefore(const char* data,
+                                         std::size_t offset) const
+{
+    std::size_t block = offset / blockSize;
+    return linesBefore[block] +
+        CountLineStarts(data, block * blockSize, offset);
+}
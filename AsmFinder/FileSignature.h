@@ -0,0 +1,100 @@
+// FileSignature.h - Declares the FileSignature class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef FILE_SIGNATURE_H
+#define FILE_SIGNATURE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// @brief Describes the lines that differ between two versions of a file.
+///
+/// The lines before begin are the same in both versions, and so are the
+/// lines from oldEnd in the old version and newEnd in the new one. Both ends
+/// are at the start of a line or the end of the file.
+struct FileChange
+{
+    std::size_t begin{ 0 };
+    std::size_t oldEnd{ 0 };
+    std::size_t newEnd{ 0 };
+
+    /// @brief The number of lines before begin.
+    std::uint32_t firstLine{ 0 };
+
+    /// @brief How far the line numbers after the change moved.
+    std::int64_t lineShift{ 0 };
+
+    /// @brief How far the offsets after the change moved.
+    std::int64_t offsetShift{ 0 };
+};
+
+/// @brief Checksums of the blocks of a file, used to find what changed when
+/// the file is written again.
+///
+/// Blocks are checksummed both from the start and from the end of the file.
+/// Comparing the blocks from the start finds the first change, and comparing
+/// them from the end finds the last one, even when text was inserted or
+/// removed in between. The number of lines before each block is kept too, so
+/// the lines around a change can be numbered without reading the whole file.
+class FileSignature
+{
+public:
+    /// @brief The size of each checksummed block.
+    static constexpr std::size_t blockSize{ 64 << 10 };
+
+    /// @brief Computes the signature of a file.
+    /// @param data The text of the file.
+    /// @param size The size of the text in bytes.
+    /// @param threadCount The number of threads to compute it with.
+    void Compute(const char* data, std::size_t size, unsigned threadCount);
+
+    /// @brief Determines if the signature has been computed.
+    /// @return True once Compute() has been called, otherwise false.
+    bool IsValid() const { return valid; }
+
+    /// @brief Gets the size of the file.
+    /// @return The size in bytes.
+    std::size_t Size() const { return size; }
+
+    /// @brief Gets the number of lines in the file.
+    /// @return The number of lines, counted the way LineScanner counts them.
+    std::uint32_t LineCount() const { return lineCount; }
+
+    /// @brief Finds what changed in a newer version of the file.
+    /// @param newer The signature of the newer version.
+    /// @param newData The text of the newer version.
+    /// @param change Receives the lines that changed.
+    /// @return True if the file changed, or false if it is the same.
+    bool Compare(const FileSignature& newer, const char* newData,
+                 FileChange& change) const;
+private:
+    std::vector<std::uint64_t> headHashes;
+    std::vector<std::uint64_t> tailHashes;
+    std::vector<std::uint32_t> linesBefore;
+    std::size_t size{ 0 };
+    std::uint32_t lineCount{ 0 };
+    bool valid{ false };
+
+    /// @brief Counts the lines before an offset.
+    /// @param data The text of the file the signature is for.
+    /// @param offset The offset.
+    /// @return The number of lines that start before the offset.
+    std::uint32_t LinesBefore(const char* data, std::size_t offset) const;
+};
+
+#endif
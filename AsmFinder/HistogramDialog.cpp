@@ -0,0 +1,125 @@
+// HistogramDialog.cpp - Defines the HistogramDialog class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "HistogramDialog.h"
+
+HistogramDialog::HistogramDialog(wxWindow* parent,
+                                 const MnemonicHistogram& histogram,
+                                 const std::vector<wxString>& sourceNames)
+    : wxDialog{ parent, wxID_ANY, "Analysis", wxDefaultPosition,
+                wxDefaultSize, wxDEFAULT_DIALOG_STYLE | wxRESIZE_BORDER },
+      histogram{ histogram }
+{
+    wxString summary;
+    summary << histogram.InstructionCount() << " instructions on ";
+    summary << histogram.LineCount() << " lines, with ";
+    summary << histogram.MnemonicCount() << " different mnemonics. ";
+    summary << "Select the mnemonics to search for and click OK, or click OK "
+               "without selecting any to search for all of them.";
+
+    wxStaticText* summaryLabel = new wxStaticText{ this, wxID_ANY, summary };
+    mnemonicListView = new MnemonicListView{ this, histogram };
+
+    regionListView = new wxListView{ this, wxID_ANY, wxDefaultPosition,
+                                     wxSize{ 420, 300 }, wxLC_REPORT };
+    regionListView->AppendColumn("Lines", wxLIST_FORMAT_LEFT, 160);
+    regionListView->AppendColumn("Instructions", wxLIST_FORMAT_RIGHT);
+    regionListView->AppendColumn("Matches", wxLIST_FORMAT_RIGHT);
+    regionListView->AppendColumn("Per 1k Lines", wxLIST_FORMAT_RIGHT);
+    FillRegions(sourceNames);
+
+    wxStaticBoxSizer* mnemonicSizer = new wxStaticBoxSizer{ wxVERTICAL, this,
+                                                            "Mnemonics" };
+    mnemonicSizer->Add(mnemonicListView, 1, wxALL | wxEXPAND, 5);
+
+    wxString regionTitle;
+    regionTitle << "Hot Regions (" << histogram.WindowSize() << " lines each)";
+    wxStaticBoxSizer* regionSizer = new wxStaticBoxSizer{ wxVERTICAL, this,
+                                                          regionTitle };
+    regionSizer->Add(regionListView, 1, wxALL | wxEXPAND, 5);
+
+    wxBoxSizer* listSizer = new wxBoxSizer{ wxHORIZONTAL };
+    listSizer->Add(mnemonicSizer, 1, wxALL | wxEXPAND, 5);
+    listSizer->Add(regionSizer, 1, wxALL | wxEXPAND, 5);
+
+    wxBoxSizer* dialogSizer = new wxBoxSizer{ wxVERTICAL };
+    dialogSizer->Add(summaryLabel, 0, wxALL | wxEXPAND, 10);
+    dialogSizer->Add(listSizer, 1, wxEXPAND);
+    dialogSizer->Add(CreateButtonSizer(wxOK | wxCANCEL), 0,
+                     wxALL | wxEXPAND, 10);
+
+    SetSizerAndFit(dialogSizer);
+}
+
+std::vector<wxString> HistogramDialog::ChosenMnemonics() const
+{
+    std::vector<std::size_t> chosen = mnemonicListView->SelectedMnemonics();
+
+    if (chosen.empty())
+        chosen = mnemonicListView->AllMnemonics();
+
+    std::vector<wxString> mnemonics;
+
+    for (std::size_t i : chosen)
+    {
+        std::string_view mnemonic = histogram.Mnemonic(i);
+        mnemonics.push_back(wxString::FromUTF8(mnemonic.data(),
+                                               mnemonic.size()));
+    }
+
+    return mnemonics;
+}
+
+void HistogramDialog::FillRegions(const std::vector<wxString>& sourceNames)
+{
+    const std::vector<MnemonicHistogram::Window>& windows =
+        histogram.Windows();
+    long item{ 0 };
+
+    for (std::size_t i : histogram.HotWindows(hotRegionCount))
+    {
+        const MnemonicHistogram::Window& window = windows[i];
+
+        wxString lines;
+
+        if (sourceNames.size() > 1)
+            lines << sourceNames[window.file] << ':';
+
+        lines << window.firstLine << '-';
+        lines << window.firstLine + window.lineCount - 1;
+
+        wxString instructions;
+        instructions << window.instructionCount;
+
+        wxString matches;
+        matches << window.matchCount;
+
+        // The density is of the matches, which are what the user searched
+        // for, unless nothing matched. That is how the regions are ranked.
+        std::uint32_t found = histogram.MatchCount() > 0
+            ? window.matchCount
+            : window.instructionCount;
+        wxString density = wxString::Format(
+            "%.1f", 1000.0 * found / window.lineCount);
+
+        regionListView->InsertItem(item, lines);
+        regionListView->SetItem(item, Column::Instructions, instructions);
+        regionListView->SetItem(item, Column::Matches, matches);
+        regionListView->SetItem(item, Column::Density, density);
+        item++;
+    }
+}
@@ -0,0 +1,65 @@
+// HistogramDialog.h - Declares the HistogramDialog class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef HISTOGRAM_DIALOG_H
+#define HISTOGRAM_DIALOG_H
+
+#include <vector>
+#include <wx/wx.h>
+#include <wx/listctrl.h>
+#include "MnemonicHistogram.h"
+#include "MnemonicListView.h"
+
+/// @brief Shows every mnemonic found by an analysis and the regions of the
+/// files where the most was found, and lets the user pick mnemonics to add
+/// to the instructions.
+class HistogramDialog : public wxDialog
+{
+public:
+    /// @brief Constructor; creates a new instance of HistogramDialog.
+    /// @param parent The window the dialog belongs to.
+    /// @param histogram The analysis to show. Must outlive the dialog.
+    /// @param sourceNames The name of each file that was analyzed.
+    HistogramDialog(wxWindow* parent, const MnemonicHistogram& histogram,
+                    const std::vector<wxString>& sourceNames);
+
+    /// @brief Gets the mnemonics to add to the instructions.
+    /// @return The selected mnemonics, or all of them if none were selected,
+    /// in the order they were shown.
+    std::vector<wxString> ChosenMnemonics() const;
+private:
+    enum Column
+    {
+        Lines = 0,
+        Instructions = 1,
+        Matches = 2,
+        Density = 3
+    };
+
+    /// @brief The most hot regions that are listed.
+    static constexpr std::size_t hotRegionCount{ 100 };
+
+    const MnemonicHistogram& histogram;
+    MnemonicListView* mnemonicListView;
+    wxListView* regionListView;
+
+    /// @brief Fills in the list of hot regions.
+    /// @param sourceNames The name of each file that was analyzed.
+    void FillRegions(const std::vector<wxString>& sourceNames);
+};
+
+#endif
@@ -15,19 +15,115 @@
 // limitations under the License.
 
 #include "Instruction.h"
+#include <string>
+#include <unordered_set>
+#include <wx/textfile.h>
 
-bool Instruction::Match(const Line& line)
+namespace
 {
-    // Basically all we're doing here now is a compare. Initially, we tried to
-    // tokenize each line and instruction name in this method, but that
-    // resulted in horrendous times (3:11:83 for 321,379 lines). However, by
-    // pre-tokenzing each line as its read in from the file and pre-tokenizing
-    // the instruction name, the same number of lines takes 0:09:03.
-    if (token == line.FirstToken())
+    std::string TokenKey(const Instruction& instruction)
     {
-        matchingLines.push_back(line);
+        wxScopedCharBuffer utf8 = instruction.Token().ToUTF8();
+        return std::string{ utf8.data(), utf8.length() };
+    }
+}
+
+std::optional<Instruction> Instruction::Parse(const wxString& definition)
+{
+    // A pattern with more than one operand has commas in it, so the name
+    // can be put in double quotes.
+    if (definition.StartsWith("\""))
+    {
+        size_t quotePosition = definition.find('"', 1);
+
+        if (quotePosition == wxString::npos ||
+            quotePosition + 1 >= definition.Length() ||
+            definition[quotePosition + 1] != ',')
+        {
+            return std::nullopt;
+        }
+
+        wxString name = definition.SubString(1, quotePosition - 1);
+        wxString desc = definition.Mid(quotePosition + 2);
+        return Instruction{ name, desc };
+    }
+
+    int commaPosition = definition.Find(',');
+
+    if (commaPosition == wxNOT_FOUND)
+        return std::nullopt;
+
+    size_t nameFrom{ 0 };
+    size_t nameTo{ static_cast<size_t>(commaPosition) - 1 };
+    size_t descFrom{ static_cast<size_t>(commaPosition) + 1 };
+    size_t descTo{ definition.Length() - 1 };
+    wxString name = definition.SubString(nameFrom, nameTo);
+    wxString desc = definition.SubString(descFrom, descTo);
+    return Instruction{ name, desc };
+}
+
+bool Instruction::ReadFile(const wxString& path,
+                           std::vector<Instruction>& instructions)
+{
+    wxTextFile instructionFile;
+
+    if (!instructionFile.Open(path))
+        return false;
+
+    if (instructionFile.GetLineCount() == 0)
         return true;
+
+    instructions.reserve(instructions.size() +
+                         instructionFile.GetLineCount());
+
+    if (auto instruction = Parse(instructionFile.GetFirstLine()))
+        instructions.push_back(*instruction);
+
+    while (!instructionFile.Eof())
+    {
+        if (auto instruction = Parse(instructionFile.GetNextLine()))
+            instructions.push_back(*instruction);
+    }
+
+    return true;
+}
+
+wxString Instruction::FoldCase(const wxString& text)
+{
+    wxScopedCharBuffer utf8 = text.ToUTF8();
+    std::string folded{ utf8.data(), utf8.length() };
+
+    for (char& c : folded)
+    {
+        if (c >= 'A' && c <= 'Z')
+            c = static_cast<char>(c - 'A' + 'a');
+    }
+
+    return wxString::FromUTF8(folded.data(), folded.size());
+}
+
+std::size_t Instruction::AddUnique(std::vector<Instruction>& instructions,
+                                  const std::vector<Instruction>& added)
+{
+    // The tokens are hashed so adding thousands of instructions to a long
+    // list doesn't compare each one to every other.
+    std::unordered_set<std::string> tokens;
+    tokens.reserve(instructions.size() + added.size());
+
+    for (const Instruction& instruction : instructions)
+        tokens.insert(TokenKey(instruction));
+
+    instructions.reserve(instructions.size() + added.size());
+    std::size_t addedCount{ 0 };
+
+    for (const Instruction& instruction : added)
+    {
+        if (tokens.insert(TokenKey(instruction)).second)
+        {
+            instructions.push_back(instruction);
+            addedCount++;
+        }
     }
-    
-    return false;
-}
\ No newline at end of file
+
+    return addedCount;
+}
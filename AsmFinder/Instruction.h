@@ -17,9 +17,10 @@
 #ifndef INSTRUCTION_H
 #define INSTRUCTION_H
 
+#include <cstddef>
+#include <optional>
 #include <vector>
-#include <wx/wx.h>
-#include "Line.h"
+#include <wx/string.h>
 
 /// @brief Represents an assembly language instruction.
 class Instruction
@@ -29,9 +30,37 @@ public:
     /// @param name The name of the instruction.
     /// @param description The instruction's description.
     Instruction(wxString name, wxString description) 
-        : name{ name }, description{ description }, token{ name.Lower() }
+        : name{ name }, description{ description }, token{ FoldCase(name) }
     {}
 
+    /// @brief Parses an instruction definition in "name,description" form.
+    /// The name can be in double quotes when it has commas in it.
+    /// @param definition The definition to parse.
+    /// @return The instruction, or nothing if the definition has no comma.
+    static std::optional<Instruction> Parse(const wxString& definition);
+
+    /// @brief Reads instruction definitions from a file, one per line.
+    /// @param path The path of the file to read.
+    /// @param instructions Receives the instructions that were defined.
+    /// @return True if the file could be read, otherwise false.
+    static bool ReadFile(const wxString& path,
+                         std::vector<Instruction>& instructions);
+
+    /// @brief Adds instructions to a list, leaving out any whose token is
+    /// already in it.
+    /// @param instructions The list to add to.
+    /// @param added The instructions to add, in order.
+    /// @return The number of instructions that were added.
+    static std::size_t AddUnique(std::vector<Instruction>& instructions,
+                                 const std::vector<Instruction>& added);
+
+    /// @brief Lowercases the ASCII letters of a name or token, which is how
+    /// case is ignored everywhere instructions are compared. Other letters
+    /// are left as they are, so the result doesn't depend on the locale.
+    /// @param text The text to lowercase.
+    /// @return The text with its ASCII letters lowercase.
+    static wxString FoldCase(const wxString& text);
+
     /// @brief Gets the name of the instruction. 
     /// @return A wxString representing the name of the instruction.
     wxString Name() const { return name; }
@@ -44,23 +73,10 @@ public:
     /// @return A lowercase version of the instruction to use as a token.
     wxString Token() const { return token; }
 
-    /// @brief Obtains the lines that have the instruction in them.
-    /// @return A vector of lines from the assembly language source file.
-    std::vector<Line> MatchingLines() const { return matchingLines; }
-
-    /// @brief Determines if the specified line has this instruction.
-    /// @param line The line to check.
-    /// @return True if the line contains the instruction, otherwise false.
-    /// @post MatchingLines() will contain line if it matches.
-    bool Match(const Line& line);
-
-    /// @brief Clears the matching lines associated with this instruction.
-    void ClearMatches() { matchingLines.clear(); }
 private:
     wxString name;
     wxString description;
     wxString token;
-    std::vector<Line> matchingLines;
 };
 
 #endif
\ No newline at end of file
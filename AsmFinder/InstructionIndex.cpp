@@ -0,0 +1,78 @@
+// InstructionIndex.cpp - Defines the InstructionIndex class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "InstructionIndex.h"
+
+void InstructionIndex::Build(const std::vector<Instruction>& instructions)
+{
+    symbols.Clear();
+    instructionOf.clear();
+    nextAlias.assign(instructions.size(), notFound);
+
+    // The last instruction with each token, which the next one with it is
+    // chained to.
+    std::vector<int> lastAlias;
+
+    for (std::size_t i = 0; i < instructions.size(); i++)
+    {
+        if (Pattern::IsPattern(instructions[i].Name()))
+            continue;
+
+        wxScopedCharBuffer utf8 = instructions[i].Token().ToUTF8();
+        std::uint32_t id = symbols.Intern(
+            std::string_view{ utf8.data(), utf8.length() });
+
+        // The first instruction with a given token is the one the token
+        // maps to, and any later ones are its aliases. Patterns still only
+        // take a line from a plain instruction that comes after them.
+        if (id == instructionOf.size())
+        {
+            instructionOf.push_back(static_cast<int>(i));
+            lastAlias.push_back(static_cast<int>(i));
+        }
+        else
+        {
+            nextAlias[static_cast<std::size_t>(lastAlias[id])] =
+                static_cast<int>(i);
+            lastAlias[id] = static_cast<int>(i);
+        }
+    }
+
+    patterns.Build(instructions);
+}
+
+int InstructionIndex::Find(std::string_view token) const
+{
+    std::uint32_t id = symbols.Find(token);
+    return id != SymbolTable::notFound ? instructionOf[id] : notFound;
+}
+
+int InstructionIndex::Find(std::string_view token, std::string_view operands,
+                           Cache& cache) const
+{
+    int plain = Find(token);
+
+    // A pattern only gets the line if it comes before the plain instruction,
+    // so there is nothing to do when every pattern comes after it.
+    if (patterns.IsEmpty() ||
+        (plain != notFound && plain < patterns.FirstInstruction()))
+    {
+        return plain;
+    }
+
+    int pattern = patterns.Find(token, operands, plain, cache);
+    return pattern != notFound ? pattern : plain;
+}
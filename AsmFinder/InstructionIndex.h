@@ -0,0 +1,101 @@
+// InstructionIndex.h - Declares the InstructionIndex class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INSTRUCTION_INDEX_H
+#define INSTRUCTION_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <wx/string.h>
+#include "Instruction.h"
+#include "PatternSet.h"
+#include "SymbolTable.h"
+
+/// @brief Resolves a lowercase token to the instruction it names in O(1).
+///
+/// Instructions whose names are patterns are matched by a PatternSet
+/// instead, and a line goes to whichever instruction comes first. Plain
+/// instructions that share a token, such as "mov" and "MOV", are aliases:
+/// Find() gives the first of them and NextAlias() leads to the others, so
+/// each one gets every line the token is on.
+class InstructionIndex
+{
+public:
+    /// @brief The value Find() returns when no instruction has the token.
+    static constexpr int notFound{ -1 };
+
+    /// @brief The patterns' scratch space, which each thread needs its own
+    /// of.
+    using Cache = PatternSet::Cache;
+
+    /// @brief Builds the index from the specified instructions.
+    /// @param instructions The instructions to index.
+    /// @post Find() maps each token to the first instruction that has it
+    /// and NextAlias() chains the others that have it in list order.
+    void Build(const std::vector<Instruction>& instructions);
+
+    /// @brief Finds the next instruction with the same token.
+    /// @param instruction The position of an instruction Find() gave or
+    /// NextAlias() led to.
+    /// @return The position of the next instruction with the token, or
+    /// notFound if there are no more.
+    int NextAlias(int instruction) const
+    {
+        return nextAlias[static_cast<std::size_t>(instruction)];
+    }
+
+    /// @brief Determines if any instruction is a pattern.
+    /// @return True if matching a line can depend on its operands,
+    /// otherwise false.
+    bool HasPatterns() const { return !patterns.IsEmpty(); }
+
+    /// @brief Finds the instruction with the specified token.
+    /// @param token The UTF-8 token to look up. Only the case of ASCII
+    /// letters is ignored, as with Instruction::FoldCase().
+    /// @return The position of the instruction in the vector the index was
+    /// built from, or notFound if no instruction has the token.
+    int Find(std::string_view token) const;
+
+    /// @brief Finds the first instruction that matches a line.
+    /// @param token The first token of the line, in any case.
+    /// @param operands The text of the line after its first token.
+    /// @param cache The calling thread's cache.
+    /// @return The position of the instruction in the vector the index was
+    /// built from, or notFound if no instruction matches the line.
+    int Find(std::string_view token, std::string_view operands,
+             Cache& cache) const;
+
+    /// @brief Determines if a pattern could match lines with a token.
+    /// @param token The token, in any case.
+    /// @param cache The calling thread's cache.
+    /// @return True if which instruction the lines match can depend on
+    /// their operands, otherwise false.
+    bool PatternsMayMatch(std::string_view token, Cache& cache) const
+    {
+        return patterns.MayMatch(token, cache);
+    }
+
+private:
+    SymbolTable symbols;
+    std::vector<int> instructionOf;
+    std::vector<int> nextAlias;
+    PatternSet patterns;
+};
+
+#endif
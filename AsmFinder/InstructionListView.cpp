@@ -0,0 +1,63 @@
+// InstructionListView.cpp - Defines the InstructionListView class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "InstructionListView.h"
+
+InstructionListView::InstructionListView(
+    wxWindow* parent, const std::vector<Instruction>& instructions,
+    const MatchTable& matches)
+    : wxListView{ parent, wxID_ANY, wxDefaultPosition, wxDefaultSize,
+                  wxLC_REPORT | wxLC_VIRTUAL },
+      instructions{ instructions }, matches{ matches }
+{
+    AppendColumn("Instruction");
+    AppendColumn("Description", wxLIST_FORMAT_LEFT, 300);
+    AppendColumn("Found");
+    AppendColumn("Files");
+}
+
+void InstructionListView::UpdateItems()
+{
+    SetItemCount(static_cast<long>(instructions.size()));
+    Refresh();
+}
+
+wxString InstructionListView::OnGetItemText(long item, long column) const
+{
+    const Instruction& instruction = instructions[item];
+
+    switch (column)
+    {
+    case Column::Name:
+        return instruction.Name();
+    case Column::Description:
+        return instruction.Description();
+    case Column::Found:
+    {
+        wxString found;
+        found << matches.Count(static_cast<std::size_t>(item));
+        return found;
+    }
+    case Column::Files:
+    {
+        wxString files;
+        files << matches.FileCount(static_cast<std::size_t>(item));
+        return files;
+    }
+    default:
+        return wxString{};
+    }
+}
@@ -0,0 +1,63 @@
+// InstructionListView.h - Declares the InstructionListView class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INSTRUCTION_LIST_VIEW_H
+#define INSTRUCTION_LIST_VIEW_H
+
+#include <vector>
+#include <wx/wx.h>
+#include <wx/listctrl.h>
+#include "Instruction.h"
+#include "MatchTable.h"
+
+/// @brief Shows the instructions being searched for and their match counts.
+///
+/// The view is virtual, so it reads each visible row straight from the
+/// instructions instead of keeping its own copy of every row.
+class InstructionListView : public wxListView
+{
+public:
+    /// @brief Constructor; creates a new instance of InstructionListView.
+    /// @param parent The window the view belongs to.
+    /// @param instructions The instructions to show. Must outlive the view.
+    /// @param matches The matches to count. Must outlive the view.
+    InstructionListView(wxWindow* parent,
+                        const std::vector<Instruction>& instructions,
+                        const MatchTable& matches);
+
+    /// @brief Updates the view after the instructions have changed.
+    /// @post Only the rows that are visible are redrawn.
+    void UpdateItems();
+protected:
+    /// @brief Gets the text of a cell.
+    /// @param item The row of the cell.
+    /// @param column The column of the cell.
+    /// @return The text to show in the cell.
+    wxString OnGetItemText(long item, long column) const override;
+private:
+    enum Column
+    {
+        Name = 0,
+        Description = 1,
+        Found = 2,
+        Files = 3
+    };
+
+    const std::vector<Instruction>& instructions;
+    const MatchTable& matches;
+};
+
+#endif
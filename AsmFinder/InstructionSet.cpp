@@ -0,0 +1,2477 @@
+// InstructionSet.cpp - Defines the InstructionSet class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "InstructionSet.h"
+
+#include <algorithm>
+#include <iterator>
+#include "Span.h"
+
+namespace
+{
+    // MIPS I, as in the R2000 and R3000, with the common assembler macros.
+    constexpr InstructionSet::Entry mips1[]
+    {
+        { "abs.d", "Floating Point Absolute Value Double" },
+        { "abs.s", "Floating Point Absolute Value Single" },
+        { "add", "Add" },
+        { "add.d", "Floating Point Add Double" },
+        { "add.s", "Floating Point Add Single" },
+        { "addi", "Add Immediate" },
+        { "addiu", "Add Immediate Unsigned" },
+        { "addu", "Add Unsigned" },
+        { "and", "And" },
+        { "andi", "And Immediate" },
+        { "b", "Branch (Pseudo)" },
+        { "bal", "Branch and Link (Pseudo)" },
+        { "bc0f", "Branch on Coprocessor 0 False" },
+        { "bc0t", "Branch on Coprocessor 0 True" },
+        { "bc1f", "Branch on Floating Point False" },
+        { "bc1t", "Branch on Floating Point True" },
+        { "bc2f", "Branch on Coprocessor 2 False" },
+        { "bc2t", "Branch on Coprocessor 2 True" },
+        { "beq", "Branch on Equal" },
+        { "beqz", "Branch on Equal to Zero (Pseudo)" },
+        { "bge", "Branch on Greater Than or Equal (Pseudo)" },
+        { "bgeu", "Branch on Greater Than or Equal Unsigned (Pseudo)" },
+        { "bgez", "Branch on Greater Than or Equal to Zero" },
+        { "bgezal", "Branch on Greater Than or Equal to Zero and Link" },
+        { "bgt", "Branch on Greater Than (Pseudo)" },
+        { "bgtu", "Branch on Greater Than Unsigned (Pseudo)" },
+        { "bgtz", "Branch on Greater Than Zero" },
+        { "ble", "Branch on Less Than or Equal (Pseudo)" },
+        { "bleu", "Branch on Less Than or Equal Unsigned (Pseudo)" },
+        { "blez", "Branch on Less Than or Equal to Zero" },
+        { "blt", "Branch on Less Than (Pseudo)" },
+        { "bltu", "Branch on Less Than Unsigned (Pseudo)" },
+        { "bltz", "Branch on Less Than Zero" },
+        { "bltzal", "Branch on Less Than Zero and Link" },
+        { "bne", "Branch on Not Equal" },
+        { "bnez", "Branch on Not Equal to Zero (Pseudo)" },
+        { "break", "Breakpoint" },
+        { "c.eq.d", "Floating Point Compare Equal Double" },
+        { "c.eq.s", "Floating Point Compare Equal Single" },
+        { "c.f.d", "Floating Point Compare False Double" },
+        { "c.f.s", "Floating Point Compare False Single" },
+        { "c.le.d", "Floating Point Compare Less Than or Equal Double" },
+        { "c.le.s", "Floating Point Compare Less Than or Equal Single" },
+        { "c.lt.d", "Floating Point Compare Less Than Double" },
+        { "c.lt.s", "Floating Point Compare Less Than Single" },
+        { "c.nge.d",
+          "Floating Point Compare Not Greater Than or Equal Double" },
+        { "c.nge.s",
+          "Floating Point Compare Not Greater Than or Equal Single" },
+        { "c.ngl.d",
+          "Floating Point Compare Not Greater Than or Less Than Double" },
+        { "c.ngl.s",
+          "Floating Point Compare Not Greater Than or Less Than Single" },
+        { "c.ngle.d",
+          "Floating Point Compare Not Greater Than or Less Than or Equal "
+          "Double" },
+        { "c.ngle.s",
+          "Floating Point Compare Not Greater Than or Less Than or Equal "
+          "Single" },
+        { "c.ngt.d", "Floating Point Compare Not Greater Than Double" },
+        { "c.ngt.s", "Floating Point Compare Not Greater Than Single" },
+        { "c.ole.d",
+          "Floating Point Compare Ordered Less Than or Equal Double" },
+        { "c.ole.s",
+          "Floating Point Compare Ordered Less Than or Equal Single" },
+        { "c.olt.d", "Floating Point Compare Ordered Less Than Double" },
+        { "c.olt.s", "Floating Point Compare Ordered Less Than Single" },
+        { "c.seq.d", "Floating Point Compare Signaling Equal Double" },
+        { "c.seq.s", "Floating Point Compare Signaling Equal Single" },
+        { "c.sf.d", "Floating Point Compare Signaling False Double" },
+        { "c.sf.s", "Floating Point Compare Signaling False Single" },
+        { "c.ueq.d", "Floating Point Compare Unordered or Equal Double" },
+        { "c.ueq.s", "Floating Point Compare Unordered or Equal Single" },
+        { "c.ule.d",
+          "Floating Point Compare Unordered or Less Than or Equal Double" },
+        { "c.ule.s",
+          "Floating Point Compare Unordered or Less Than or Equal Single" },
+        { "c.ult.d", "Floating Point Compare Unordered or Less Than Double" },
+        { "c.ult.s", "Floating Point Compare Unordered or Less Than Single" },
+        { "c.un.d", "Floating Point Compare Unordered Double" },
+        { "c.un.s", "Floating Point Compare Unordered Single" },
+        { "cfc1", "Move Control Word From Floating Point" },
+        { "cfc2", "Move Control Word From Coprocessor 2" },
+        { "cop0", "Coprocessor 0 Operation" },
+        { "cop2", "Coprocessor 2 Operation" },
+        { "ctc1", "Move Control Word To Floating Point" },
+        { "ctc2", "Move Control Word To Coprocessor 2" },
+        { "cvt.d.s", "Convert Single to Double" },
+        { "cvt.d.w", "Convert Word to Double" },
+        { "cvt.s.d", "Convert Double to Single" },
+        { "cvt.s.w", "Convert Word to Single" },
+        { "cvt.w.d", "Convert Double to Word" },
+        { "cvt.w.s", "Convert Single to Word" },
+        { "div", "Divide" },
+        { "div.d", "Floating Point Divide Double" },
+        { "div.s", "Floating Point Divide Single" },
+        { "divu", "Divide Unsigned" },
+        { "j", "Jump" },
+        { "jal", "Jump and Link" },
+        { "jalr", "Jump and Link Register" },
+        { "jr", "Jump Register" },
+        { "la", "Load Address (Pseudo)" },
+        { "lb", "Load Byte" },
+        { "lbu", "Load Byte Unsigned" },
+        { "lh", "Load Halfword" },
+        { "lhu", "Load Halfword Unsigned" },
+        { "li", "Load Immediate (Pseudo)" },
+        { "lui", "Load Upper Immediate" },
+        { "lw", "Load Word" },
+        { "lwc1", "Load Word to Floating Point" },
+        { "lwc2", "Load Word to Coprocessor 2" },
+        { "lwl", "Load Word Left" },
+        { "lwr", "Load Word Right" },
+        { "mfc0", "Move From System Control Coprocessor" },
+        { "mfc1", "Move Word From Floating Point" },
+        { "mfc2", "Move Word From Coprocessor 2" },
+        { "mfhi", "Move From HI" },
+        { "mflo", "Move From LO" },
+        { "mov.d", "Floating Point Move Double" },
+        { "mov.s", "Floating Point Move Single" },
+        { "move", "Move (Pseudo)" },
+        { "mtc0", "Move To System Control Coprocessor" },
+        { "mtc1", "Move Word To Floating Point" },
+        { "mtc2", "Move Word To Coprocessor 2" },
+        { "mthi", "Move To HI" },
+        { "mtlo", "Move To LO" },
+        { "mul.d", "Floating Point Multiply Double" },
+        { "mul.s", "Floating Point Multiply Single" },
+        { "mult", "Multiply" },
+        { "multu", "Multiply Unsigned" },
+        { "neg", "Negate (Pseudo)" },
+        { "neg.d", "Floating Point Negate Double" },
+        { "neg.s", "Floating Point Negate Single" },
+        { "negu", "Negate Unsigned (Pseudo)" },
+        { "nop", "No Operation (Pseudo)" },
+        { "nor", "Not Or" },
+        { "not", "Not (Pseudo)" },
+        { "or", "Or" },
+        { "ori", "Or Immediate" },
+        { "rfe", "Restore From Exception" },
+        { "sb", "Store Byte" },
+        { "sh", "Store Halfword" },
+        { "sll", "Shift Left Logical" },
+        { "sllv", "Shift Left Logical Variable" },
+        { "slt", "Set on Less Than" },
+        { "slti", "Set on Less Than Immediate" },
+        { "sltiu", "Set on Less Than Immediate Unsigned" },
+        { "sltu", "Set on Less Than Unsigned" },
+        { "sra", "Shift Right Arithmetic" },
+        { "srav", "Shift Right Arithmetic Variable" },
+        { "srl", "Shift Right Logical" },
+        { "srlv", "Shift Right Logical Variable" },
+        { "sub", "Subtract" },
+        { "sub.d", "Floating Point Subtract Double" },
+        { "sub.s", "Floating Point Subtract Single" },
+        { "subu", "Subtract Unsigned" },
+        { "sw", "Store Word" },
+        { "swc1", "Store Word From Floating Point" },
+        { "swc2", "Store Word From Coprocessor 2" },
+        { "swl", "Store Word Left" },
+        { "swr", "Store Word Right" },
+        { "syscall", "System Call" },
+        { "tlbp", "Probe TLB for Matching Entry" },
+        { "tlbr", "Read Indexed TLB Entry" },
+        { "tlbwi", "Write Indexed TLB Entry" },
+        { "tlbwr", "Write Random TLB Entry" },
+        { "xor", "Exclusive Or" },
+        { "xori", "Exclusive Or Immediate" },
+    };
+
+    // Added by MIPS II, as in the R6000.
+    constexpr InstructionSet::Entry mips2[]
+    {
+        { "bc1fl", "Branch on Floating Point False Likely" },
+        { "bc1tl", "Branch on Floating Point True Likely" },
+        { "bc2fl", "Branch on Coprocessor 2 False Likely" },
+        { "bc2tl", "Branch on Coprocessor 2 True Likely" },
+        { "beql", "Branch on Equal Likely" },
+        { "bgezall",
+          "Branch on Greater Than or Equal to Zero and Link Likely" },
+        { "bgezl", "Branch on Greater Than or Equal to Zero Likely" },
+        { "bgtzl", "Branch on Greater Than Zero Likely" },
+        { "blezl", "Branch on Less Than or Equal to Zero Likely" },
+        { "bltzall", "Branch on Less Than Zero and Link Likely" },
+        { "bltzl", "Branch on Less Than Zero Likely" },
+        { "bnel", "Branch on Not Equal Likely" },
+        { "ceil.w.d", "Floating Point Ceiling Double to Word" },
+        { "ceil.w.s", "Floating Point Ceiling Single to Word" },
+        { "floor.w.d", "Floating Point Floor Double to Word" },
+        { "floor.w.s", "Floating Point Floor Single to Word" },
+        { "ldc1", "Load Doubleword to Floating Point" },
+        { "ldc2", "Load Doubleword to Coprocessor 2" },
+        { "ll", "Load Linked Word" },
+        { "round.w.d", "Floating Point Round Double to Word" },
+        { "round.w.s", "Floating Point Round Single to Word" },
+        { "sc", "Store Conditional Word" },
+        { "sdc1", "Store Doubleword From Floating Point" },
+        { "sdc2", "Store Doubleword From Coprocessor 2" },
+        { "sqrt.d", "Floating Point Square Root Double" },
+        { "sqrt.s", "Floating Point Square Root Single" },
+        { "sync", "Synchronize Shared Memory" },
+        { "teq", "Trap if Equal" },
+        { "teqi", "Trap if Equal Immediate" },
+        { "tge", "Trap if Greater Than or Equal" },
+        { "tgei", "Trap if Greater Than or Equal Immediate" },
+        { "tgeiu", "Trap if Greater Than or Equal Immediate Unsigned" },
+        { "tgeu", "Trap if Greater Than or Equal Unsigned" },
+        { "tlt", "Trap if Less Than" },
+        { "tlti", "Trap if Less Than Immediate" },
+        { "tltiu", "Trap if Less Than Immediate Unsigned" },
+        { "tltu", "Trap if Less Than Unsigned" },
+        { "tne", "Trap if Not Equal" },
+        { "tnei", "Trap if Not Equal Immediate" },
+        { "trunc.w.d", "Floating Point Truncate Double to Word" },
+        { "trunc.w.s", "Floating Point Truncate Single to Word" },
+    };
+
+    // Added by MIPS III, as in the R4000.
+    constexpr InstructionSet::Entry mips3[]
+    {
+        { "cache", "Perform Cache Operation" },
+        { "ceil.l.d", "Floating Point Ceiling Double to Long" },
+        { "ceil.l.s", "Floating Point Ceiling Single to Long" },
+        { "cvt.d.l", "Convert Long to Double" },
+        { "cvt.l.d", "Convert Double to Long" },
+        { "cvt.l.s", "Convert Single to Long" },
+        { "cvt.s.l", "Convert Long to Single" },
+        { "dadd", "Doubleword Add" },
+        { "daddi", "Doubleword Add Immediate" },
+        { "daddiu", "Doubleword Add Immediate Unsigned" },
+        { "daddu", "Doubleword Add Unsigned" },
+        { "ddiv", "Doubleword Divide" },
+        { "ddivu", "Doubleword Divide Unsigned" },
+        { "dla", "Doubleword Load Address (Pseudo)" },
+        { "dli", "Doubleword Load Immediate (Pseudo)" },
+        { "dmfc0", "Doubleword Move From System Control Coprocessor" },
+        { "dmfc1", "Doubleword Move From Floating Point" },
+        { "dmove", "Doubleword Move (Pseudo)" },
+        { "dmtc0", "Doubleword Move To System Control Coprocessor" },
+        { "dmtc1", "Doubleword Move To Floating Point" },
+        { "dmult", "Doubleword Multiply" },
+        { "dmultu", "Doubleword Multiply Unsigned" },
+        { "dneg", "Doubleword Negate (Pseudo)" },
+        { "dnegu", "Doubleword Negate Unsigned (Pseudo)" },
+        { "dsll", "Doubleword Shift Left Logical" },
+        { "dsll32", "Doubleword Shift Left Logical + 32" },
+        { "dsllv", "Doubleword Shift Left Logical Variable" },
+        { "dsra", "Doubleword Shift Right Arithmetic" },
+        { "dsra32", "Doubleword Shift Right Arithmetic + 32" },
+        { "dsrav", "Doubleword Shift Right Arithmetic Variable" },
+        { "dsrl", "Doubleword Shift Right Logical" },
+        { "dsrl32", "Doubleword Shift Right Logical + 32" },
+        { "dsrlv", "Doubleword Shift Right Logical Variable" },
+        { "dsub", "Doubleword Subtract" },
+        { "dsubu", "Doubleword Subtract Unsigned" },
+        { "eret", "Exception Return" },
+        { "floor.l.d", "Floating Point Floor Double to Long" },
+        { "floor.l.s", "Floating Point Floor Single to Long" },
+        { "ld", "Load Doubleword" },
+        { "ldl", "Load Doubleword Left" },
+        { "ldr", "Load Doubleword Right" },
+        { "lld", "Load Linked Doubleword" },
+        { "lwu", "Load Word Unsigned" },
+        { "round.l.d", "Floating Point Round Double to Long" },
+        { "round.l.s", "Floating Point Round Single to Long" },
+        { "scd", "Store Conditional Doubleword" },
+        { "sd", "Store Doubleword" },
+        { "sdl", "Store Doubleword Left" },
+        { "sdr", "Store Doubleword Right" },
+        { "trunc.l.d", "Floating Point Truncate Double to Long" },
+        { "trunc.l.s", "Floating Point Truncate Single to Long" },
+    };
+
+    // Added by MIPS IV, as in the R8000 and R10000.
+    constexpr InstructionSet::Entry mips4[]
+    {
+        { "ldxc1", "Load Doubleword Indexed to Floating Point" },
+        { "lwxc1", "Load Word Indexed to Floating Point" },
+        { "madd.d", "Floating Point Multiply Add Double" },
+        { "madd.s", "Floating Point Multiply Add Single" },
+        { "movf", "Move Conditional on Floating Point False" },
+        { "movf.d",
+          "Floating Point Move Conditional on Floating Point False Double" },
+        { "movf.s",
+          "Floating Point Move Conditional on Floating Point False Single" },
+        { "movn", "Move Conditional on Not Zero" },
+        { "movn.d", "Floating Point Move Conditional on Not Zero Double" },
+        { "movn.s", "Floating Point Move Conditional on Not Zero Single" },
+        { "movt", "Move Conditional on Floating Point True" },
+        { "movt.d",
+          "Floating Point Move Conditional on Floating Point True Double" },
+        { "movt.s",
+          "Floating Point Move Conditional on Floating Point True Single" },
+        { "movz", "Move Conditional on Zero" },
+        { "movz.d", "Floating Point Move Conditional on Zero Double" },
+        { "movz.s", "Floating Point Move Conditional on Zero Single" },
+        { "msub.d", "Floating Point Multiply Subtract Double" },
+        { "msub.s", "Floating Point Multiply Subtract Single" },
+        { "nmadd.d", "Floating Point Negative Multiply Add Double" },
+        { "nmadd.s", "Floating Point Negative Multiply Add Single" },
+        { "nmsub.d", "Floating Point Negative Multiply Subtract Double" },
+        { "nmsub.s", "Floating Point Negative Multiply Subtract Single" },
+        { "pref", "Prefetch" },
+        { "prefx", "Prefetch Indexed" },
+        { "recip.d", "Floating Point Reciprocal Approximation Double" },
+        { "recip.s", "Floating Point Reciprocal Approximation Single" },
+        { "rsqrt.d",
+          "Floating Point Reciprocal Square Root Approximation Double" },
+        { "rsqrt.s",
+          "Floating Point Reciprocal Square Root Approximation Single" },
+        { "sdxc1", "Store Doubleword Indexed From Floating Point" },
+        { "swxc1", "Store Word Indexed From Floating Point" },
+    };
+
+    // x86-64 through AVX-512, in Intel syntax and with the AT&T suffixes GNU as
+    // and objdump use.
+    constexpr InstructionSet::Entry x86_64[]
+    {
+        { "aaa", "ASCII Adjust After Addition" },
+        { "adc", "Add With Carry" },
+        { "adcb", "Add With Carry Byte (AT&T)" },
+        { "adcl", "Add With Carry Long (AT&T)" },
+        { "adcq", "Add With Carry Quad (AT&T)" },
+        { "adcw", "Add With Carry Word (AT&T)" },
+        { "adcx", "Unsigned Add With Carry Flag" },
+        { "add", "Add" },
+        { "addb", "Add Byte (AT&T)" },
+        { "addl", "Add Long (AT&T)" },
+        { "addpd", "Add Packed Double" },
+        { "addps", "Add Packed Single" },
+        { "addq", "Add Quad (AT&T)" },
+        { "addsd", "Add Scalar Double" },
+        { "addss", "Add Scalar Single" },
+        { "addsubpd", "Add and Subtract Packed Double" },
+        { "addsubps", "Add and Subtract Packed Single" },
+        { "addw", "Add Word (AT&T)" },
+        { "adox", "Unsigned Add With Overflow Flag" },
+        { "aesdec", "AES Decrypt Round" },
+        { "aesdeclast", "AES Decrypt Last Round" },
+        { "aesenc", "AES Encrypt Round" },
+        { "aesenclast", "AES Encrypt Last Round" },
+        { "aesimc", "AES Inverse Mix Columns" },
+        { "aeskeygenassist", "AES Round Key Generation Assist" },
+        { "and", "Logical And" },
+        { "andb", "Logical And Byte (AT&T)" },
+        { "andl", "Logical And Long (AT&T)" },
+        { "andn", "Logical And Not" },
+        { "andnpd", "Bitwise And Not Packed Double" },
+        { "andnps", "Bitwise And Not Packed Single" },
+        { "andpd", "Bitwise And Packed Double" },
+        { "andps", "Bitwise And Packed Single" },
+        { "andq", "Logical And Quad (AT&T)" },
+        { "andw", "Logical And Word (AT&T)" },
+        { "bextr", "Bit Field Extract" },
+        { "blendpd", "Blend Packed Double" },
+        { "blendps", "Blend Packed Single" },
+        { "blendvpd", "Variable Blend Packed Double" },
+        { "blendvps", "Variable Blend Packed Single" },
+        { "blsi", "Extract Lowest Set Bit" },
+        { "blsmsk", "Mask Up to Lowest Set Bit" },
+        { "blsr", "Reset Lowest Set Bit" },
+        { "bsf", "Bit Scan Forward" },
+        { "bsfl", "Bit Scan Forward Long (AT&T)" },
+        { "bsfq", "Bit Scan Forward Quad (AT&T)" },
+        { "bsfw", "Bit Scan Forward Word (AT&T)" },
+        { "bsr", "Bit Scan Reverse" },
+        { "bsrl", "Bit Scan Reverse Long (AT&T)" },
+        { "bsrq", "Bit Scan Reverse Quad (AT&T)" },
+        { "bsrw", "Bit Scan Reverse Word (AT&T)" },
+        { "bswap", "Byte Swap" },
+        { "bt", "Bit Test" },
+        { "btc", "Bit Test and Complement" },
+        { "btcl", "Bit Test and Complement Long (AT&T)" },
+        { "btcq", "Bit Test and Complement Quad (AT&T)" },
+        { "btcw", "Bit Test and Complement Word (AT&T)" },
+        { "btl", "Bit Test Long (AT&T)" },
+        { "btq", "Bit Test Quad (AT&T)" },
+        { "btr", "Bit Test and Reset" },
+        { "btrl", "Bit Test and Reset Long (AT&T)" },
+        { "btrq", "Bit Test and Reset Quad (AT&T)" },
+        { "btrw", "Bit Test and Reset Word (AT&T)" },
+        { "bts", "Bit Test and Set" },
+        { "btsl", "Bit Test and Set Long (AT&T)" },
+        { "btsq", "Bit Test and Set Quad (AT&T)" },
+        { "btsw", "Bit Test and Set Word (AT&T)" },
+        { "btw", "Bit Test Word (AT&T)" },
+        { "bzhi", "Zero High Bits" },
+        { "call", "Call Procedure" },
+        { "callq", "Call Procedure Quad (AT&T)" },
+        { "cbtw", "Convert Byte to Word (AT&T cbw)" },
+        { "cbw", "Convert Byte to Word" },
+        { "cdq", "Convert Doubleword to Quadword" },
+        { "cdqe", "Convert Doubleword to Quadword in RAX" },
+        { "clc", "Clear Carry Flag" },
+        { "cld", "Clear Direction Flag" },
+        { "clflush", "Flush Cache Line" },
+        { "clflushopt", "Flush Cache Line Optimized" },
+        { "cli", "Clear Interrupt Flag" },
+        { "cltd", "Convert Long to Double Long (AT&T cdq)" },
+        { "cltq", "Convert Long to Quad in RAX (AT&T cdqe)" },
+        { "clwb", "Cache Line Write Back" },
+        { "cmc", "Complement Carry Flag" },
+        { "cmova", "Conditional Move if Above" },
+        { "cmovae", "Conditional Move if Above or Equal" },
+        { "cmovb", "Conditional Move if Below" },
+        { "cmovbe", "Conditional Move if Below or Equal" },
+        { "cmovc", "Conditional Move if Carry" },
+        { "cmove", "Conditional Move if Equal" },
+        { "cmovg", "Conditional Move if Greater" },
+        { "cmovge", "Conditional Move if Greater or Equal" },
+        { "cmovl", "Conditional Move if Less" },
+        { "cmovle", "Conditional Move if Less or Equal" },
+        { "cmovna", "Conditional Move if Not Above" },
+        { "cmovnae", "Conditional Move if Not Above or Equal" },
+        { "cmovnb", "Conditional Move if Not Below" },
+        { "cmovnbe", "Conditional Move if Not Below or Equal" },
+        { "cmovnc", "Conditional Move if Not Carry" },
+        { "cmovne", "Conditional Move if Not Equal" },
+        { "cmovng", "Conditional Move if Not Greater" },
+        { "cmovnge", "Conditional Move if Not Greater or Equal" },
+        { "cmovnl", "Conditional Move if Not Less" },
+        { "cmovnle", "Conditional Move if Not Less or Equal" },
+        { "cmovno", "Conditional Move if Not Overflow" },
+        { "cmovnp", "Conditional Move if Not Parity" },
+        { "cmovns", "Conditional Move if Not Sign" },
+        { "cmovnz", "Conditional Move if Not Zero" },
+        { "cmovo", "Conditional Move if Overflow" },
+        { "cmovp", "Conditional Move if Parity" },
+        { "cmovpe", "Conditional Move if Parity Even" },
+        { "cmovpo", "Conditional Move if Parity Odd" },
+        { "cmovs", "Conditional Move if Sign" },
+        { "cmovz", "Conditional Move if Zero" },
+        { "cmp", "Compare" },
+        { "cmpb", "Compare Byte (AT&T)" },
+        { "cmpl", "Compare Long (AT&T)" },
+        { "cmppd", "Compare Packed Double" },
+        { "cmpps", "Compare Packed Single" },
+        { "cmpq", "Compare Quad (AT&T)" },
+        { "cmps", "Compare String" },
+        { "cmpsb", "Compare String Byte" },
+        { "cmpsd", "Compare String Doubleword or Scalar Double" },
+        { "cmpsq", "Compare String Quadword" },
+        { "cmpss", "Compare Scalar Single" },
+        { "cmpsw", "Compare String Word" },
+        { "cmpw", "Compare Word (AT&T)" },
+        { "cmpxchg", "Compare and Exchange" },
+        { "cmpxchg16b", "Compare and Exchange 16 Bytes" },
+        { "cmpxchg8b", "Compare and Exchange 8 Bytes" },
+        { "cmpxchgb", "Compare and Exchange Byte (AT&T)" },
+        { "cmpxchgl", "Compare and Exchange Long (AT&T)" },
+        { "cmpxchgq", "Compare and Exchange Quad (AT&T)" },
+        { "cmpxchgw", "Compare and Exchange Word (AT&T)" },
+        { "comisd", "Compare Ordered Scalar Double" },
+        { "comiss", "Compare Ordered Scalar Single" },
+        { "cpuid", "CPU Identification" },
+        { "cqo", "Convert Quadword to Octaword" },
+        { "cqto", "Convert Quad to Octa (AT&T cqo)" },
+        { "crc32", "Accumulate CRC32" },
+        { "cvtdq2pd", "Convert Packed Doubleword to Packed Double" },
+        { "cvtdq2ps", "Convert Packed Doubleword to Packed Single" },
+        { "cvtpd2dq", "Convert Packed Double to Packed Doubleword" },
+        { "cvtpd2ps", "Convert Packed Double to Packed Single" },
+        { "cvtps2dq", "Convert Packed Single to Packed Doubleword" },
+        { "cvtps2pd", "Convert Packed Single to Packed Double" },
+        { "cvtsd2si", "Convert Scalar Double to Integer" },
+        { "cvtsd2ss", "Convert Scalar Double to Scalar Single" },
+        { "cvtsi2sd", "Convert Integer to Scalar Double" },
+        { "cvtsi2ss", "Convert Integer to Scalar Single" },
+        { "cvtss2sd", "Convert Scalar Single to Scalar Double" },
+        { "cvtss2si", "Convert Scalar Single to Integer" },
+        { "cvttpd2dq",
+          "Convert With Truncation Packed Double to Packed Doubleword" },
+        { "cvttps2dq",
+          "Convert With Truncation Packed Single to Packed Doubleword" },
+        { "cvttsd2si", "Convert With Truncation Scalar Double to Integer" },
+        { "cvttss2si", "Convert With Truncation Scalar Single to Integer" },
+        { "cwd", "Convert Word to Doubleword" },
+        { "cwde", "Convert Word to Doubleword in EAX" },
+        { "cwtd", "Convert Word to Double Word (AT&T cwd)" },
+        { "cwtl", "Convert Word to Long in EAX (AT&T cwde)" },
+        { "dec", "Decrement" },
+        { "decb", "Decrement Byte (AT&T)" },
+        { "decl", "Decrement Long (AT&T)" },
+        { "decq", "Decrement Quad (AT&T)" },
+        { "decw", "Decrement Word (AT&T)" },
+        { "div", "Unsigned Divide" },
+        { "divb", "Unsigned Divide Byte (AT&T)" },
+        { "divl", "Unsigned Divide Long (AT&T)" },
+        { "divpd", "Divide Packed Double" },
+        { "divps", "Divide Packed Single" },
+        { "divq", "Unsigned Divide Quad (AT&T)" },
+        { "divsd", "Divide Scalar Double" },
+        { "divss", "Divide Scalar Single" },
+        { "divw", "Unsigned Divide Word (AT&T)" },
+        { "dppd", "Dot Product Packed Double" },
+        { "dpps", "Dot Product Packed Single" },
+        { "emms", "Empty MMX State" },
+        { "endbr32", "Terminate an Indirect Branch in 32-bit Mode" },
+        { "endbr64", "Terminate an Indirect Branch in 64-bit Mode" },
+        { "enter", "Make Stack Frame" },
+        { "extractps", "Extract Packed Single" },
+        { "f2xm1", "Compute 2^x - 1" },
+        { "fabs", "Floating Point Absolute Value" },
+        { "fadd", "Floating Point Add" },
+        { "faddp", "Floating Point Add and Pop" },
+        { "fchs", "Floating Point Change Sign" },
+        { "fcmovb", "Floating Point Conditional Move if Below" },
+        { "fcmove", "Floating Point Conditional Move if Equal" },
+        { "fcom", "Floating Point Compare" },
+        { "fcomi", "Floating Point Compare and Set Flags" },
+        { "fcomip", "Floating Point Compare, Set Flags and Pop" },
+        { "fcomp", "Floating Point Compare and Pop" },
+        { "fcos", "Floating Point Cosine" },
+        { "fdiv", "Floating Point Divide" },
+        { "fdivp", "Floating Point Divide and Pop" },
+        { "fdivr", "Floating Point Reverse Divide" },
+        { "fild", "Load Integer to Floating Point" },
+        { "fist", "Store Integer From Floating Point" },
+        { "fistp", "Store Integer From Floating Point and Pop" },
+        { "fisttp", "Store Integer With Truncation and Pop" },
+        { "fld", "Load Floating Point Value" },
+        { "fld1", "Load +1.0" },
+        { "fldcw", "Load x87 Control Word" },
+        { "fldz", "Load +0.0" },
+        { "fmul", "Floating Point Multiply" },
+        { "fmulp", "Floating Point Multiply and Pop" },
+        { "fnstcw", "Store x87 Control Word" },
+        { "fnstsw", "Store x87 Status Word" },
+        { "fprem", "Floating Point Partial Remainder" },
+        { "frndint", "Floating Point Round to Integer" },
+        { "fsin", "Floating Point Sine" },
+        { "fsqrt", "Floating Point Square Root" },
+        { "fst", "Store Floating Point Value" },
+        { "fstp", "Store Floating Point Value and Pop" },
+        { "fsub", "Floating Point Subtract" },
+        { "fsubp", "Floating Point Subtract and Pop" },
+        { "fsubr", "Floating Point Reverse Subtract" },
+        { "fucomi", "Floating Point Unordered Compare and Set Flags" },
+        { "fucomip", "Floating Point Unordered Compare, Set Flags and Pop" },
+        { "fxch", "Exchange Floating Point Registers" },
+        { "fxrstor", "Restore x87, MMX and SSE State" },
+        { "fxsave", "Save x87, MMX and SSE State" },
+        { "haddpd", "Horizontal Add Packed Double" },
+        { "haddps", "Horizontal Add Packed Single" },
+        { "hlt", "Halt" },
+        { "hsubpd", "Horizontal Subtract Packed Double" },
+        { "hsubps", "Horizontal Subtract Packed Single" },
+        { "idiv", "Signed Divide" },
+        { "idivb", "Signed Divide Byte (AT&T)" },
+        { "idivl", "Signed Divide Long (AT&T)" },
+        { "idivq", "Signed Divide Quad (AT&T)" },
+        { "idivw", "Signed Divide Word (AT&T)" },
+        { "imul", "Signed Multiply" },
+        { "imulb", "Signed Multiply Byte (AT&T)" },
+        { "imull", "Signed Multiply Long (AT&T)" },
+        { "imulq", "Signed Multiply Quad (AT&T)" },
+        { "imulw", "Signed Multiply Word (AT&T)" },
+        { "in", "Input From Port" },
+        { "inc", "Increment" },
+        { "incb", "Increment Byte (AT&T)" },
+        { "incl", "Increment Long (AT&T)" },
+        { "incq", "Increment Quad (AT&T)" },
+        { "incw", "Increment Word (AT&T)" },
+        { "insertps", "Insert Packed Single" },
+        { "int", "Call to Interrupt Procedure" },
+        { "int3", "Breakpoint" },
+        { "invlpg", "Invalidate TLB Entry" },
+        { "iret", "Interrupt Return" },
+        { "iretq", "Interrupt Return 64-bit" },
+        { "ja", "Jump if Above" },
+        { "jae", "Jump if Above or Equal" },
+        { "jb", "Jump if Below" },
+        { "jbe", "Jump if Below or Equal" },
+        { "jc", "Jump if Carry" },
+        { "je", "Jump if Equal" },
+        { "jg", "Jump if Greater" },
+        { "jge", "Jump if Greater or Equal" },
+        { "jl", "Jump if Less" },
+        { "jle", "Jump if Less or Equal" },
+        { "jmp", "Jump" },
+        { "jmpq", "Jump Quad (AT&T)" },
+        { "jna", "Jump if Not Above" },
+        { "jnae", "Jump if Not Above or Equal" },
+        { "jnb", "Jump if Not Below" },
+        { "jnbe", "Jump if Not Below or Equal" },
+        { "jnc", "Jump if Not Carry" },
+        { "jne", "Jump if Not Equal" },
+        { "jng", "Jump if Not Greater" },
+        { "jnge", "Jump if Not Greater or Equal" },
+        { "jnl", "Jump if Not Less" },
+        { "jnle", "Jump if Not Less or Equal" },
+        { "jno", "Jump if Not Overflow" },
+        { "jnp", "Jump if Not Parity" },
+        { "jns", "Jump if Not Sign" },
+        { "jnz", "Jump if Not Zero" },
+        { "jo", "Jump if Overflow" },
+        { "jp", "Jump if Parity" },
+        { "jpe", "Jump if Parity Even" },
+        { "jpo", "Jump if Parity Odd" },
+        { "jrcxz", "Jump if RCX Is Zero" },
+        { "js", "Jump if Sign" },
+        { "jz", "Jump if Zero" },
+        { "kandw", "Bitwise And Masks" },
+        { "kmovb", "Move Byte Mask" },
+        { "kmovd", "Move Doubleword Mask" },
+        { "kmovq", "Move Quadword Mask" },
+        { "kmovw", "Move Word Mask" },
+        { "knotw", "Not Mask" },
+        { "kortestw", "Or Masks and Set Flags" },
+        { "korw", "Bitwise Or Masks" },
+        { "kxorw", "Bitwise Exclusive Or Masks" },
+        { "lahf", "Load Status Flags Into AH" },
+        { "lddqu", "Load Unaligned Integer 128 Bits" },
+        { "ldmxcsr", "Load MXCSR Register" },
+        { "lea", "Load Effective Address" },
+        { "leal", "Load Effective Address Long (AT&T)" },
+        { "leaq", "Load Effective Address Quad (AT&T)" },
+        { "leave", "High Level Procedure Exit" },
+        { "lfence", "Load Fence" },
+        { "lgdt", "Load Global Descriptor Table" },
+        { "lidt", "Load Interrupt Descriptor Table" },
+        { "lock", "Assert Lock Prefix" },
+        { "lods", "Load String" },
+        { "lodsb", "Load String Byte" },
+        { "lodsd", "Load String Doubleword" },
+        { "lodsq", "Load String Quadword" },
+        { "lodsw", "Load String Word" },
+        { "loop", "Loop According to RCX" },
+        { "lzcnt", "Count Leading Zero Bits" },
+        { "maskmovdqu", "Store Selected Bytes of Double Quadword" },
+        { "maxpd", "Maximum of Packed Double" },
+        { "maxps", "Maximum of Packed Single" },
+        { "maxsd", "Maximum of Scalar Double" },
+        { "maxss", "Maximum of Scalar Single" },
+        { "mfence", "Memory Fence" },
+        { "minpd", "Minimum of Packed Double" },
+        { "minps", "Minimum of Packed Single" },
+        { "minsd", "Minimum of Scalar Double" },
+        { "minss", "Minimum of Scalar Single" },
+        { "monitor", "Set Up Monitor Address" },
+        { "mov", "Move" },
+        { "movabs", "Move 64-bit Immediate or Absolute Address" },
+        { "movapd", "Move Aligned Packed Double" },
+        { "movaps", "Move Aligned Packed Single" },
+        { "movb", "Move Byte (AT&T)" },
+        { "movbe", "Move Data After Swapping Bytes" },
+        { "movd", "Move Doubleword" },
+        { "movddup", "Replicate Double" },
+        { "movdqa", "Move Aligned Double Quadword" },
+        { "movdqu", "Move Unaligned Double Quadword" },
+        { "movhlps", "Move Packed Single High to Low" },
+        { "movhpd", "Move High Packed Double" },
+        { "movhps", "Move High Packed Single" },
+        { "movl", "Move Long (AT&T)" },
+        { "movlhps", "Move Packed Single Low to High" },
+        { "movlpd", "Move Low Packed Double" },
+        { "movlps", "Move Low Packed Single" },
+        { "movmskpd", "Extract Packed Double Sign Mask" },
+        { "movmskps", "Extract Packed Single Sign Mask" },
+        { "movntdq", "Store Double Quadword Non-Temporal" },
+        { "movntdqa", "Load Double Quadword Non-Temporal Aligned Hint" },
+        { "movnti", "Store Doubleword Non-Temporal" },
+        { "movntpd", "Store Packed Double Non-Temporal" },
+        { "movntps", "Store Packed Single Non-Temporal" },
+        { "movq", "Move Quadword" },
+        { "movs", "Move String" },
+        { "movsb", "Move String Byte" },
+        { "movsbl", "Move Sign-Extended Byte to Long (AT&T)" },
+        { "movsbq", "Move Sign-Extended Byte to Quad (AT&T)" },
+        { "movsbw", "Move Sign-Extended Byte to Word (AT&T)" },
+        { "movsd", "Move String Doubleword or Scalar Double" },
+        { "movshdup", "Replicate Single High" },
+        { "movsldup", "Replicate Single Low" },
+        { "movslq", "Move Sign-Extended Long to Quad (AT&T)" },
+        { "movsq", "Move String Quadword" },
+        { "movss", "Move Scalar Single" },
+        { "movsw", "Move String Word" },
+        { "movswl", "Move Sign-Extended Word to Long (AT&T)" },
+        { "movswq", "Move Sign-Extended Word to Quad (AT&T)" },
+        { "movsx", "Move With Sign Extension" },
+        { "movsxd", "Move With Sign Extension Doubleword" },
+        { "movupd", "Move Unaligned Packed Double" },
+        { "movups", "Move Unaligned Packed Single" },
+        { "movw", "Move Word (AT&T)" },
+        { "movzbl", "Move Zero-Extended Byte to Long (AT&T)" },
+        { "movzbq", "Move Zero-Extended Byte to Quad (AT&T)" },
+        { "movzbw", "Move Zero-Extended Byte to Word (AT&T)" },
+        { "movzwl", "Move Zero-Extended Word to Long (AT&T)" },
+        { "movzwq", "Move Zero-Extended Word to Quad (AT&T)" },
+        { "movzx", "Move With Zero Extension" },
+        { "mpsadbw", "Compute Multiple Packed Sums of Absolute Difference" },
+        { "mul", "Unsigned Multiply" },
+        { "mulb", "Unsigned Multiply Byte (AT&T)" },
+        { "mull", "Unsigned Multiply Long (AT&T)" },
+        { "mulpd", "Multiply Packed Double" },
+        { "mulps", "Multiply Packed Single" },
+        { "mulq", "Unsigned Multiply Quad (AT&T)" },
+        { "mulsd", "Multiply Scalar Double" },
+        { "mulss", "Multiply Scalar Single" },
+        { "mulw", "Unsigned Multiply Word (AT&T)" },
+        { "mulx", "Unsigned Multiply Without Affecting Flags" },
+        { "mwait", "Monitor Wait" },
+        { "neg", "Two's Complement Negation" },
+        { "negb", "Two's Complement Negation Byte (AT&T)" },
+        { "negl", "Two's Complement Negation Long (AT&T)" },
+        { "negq", "Two's Complement Negation Quad (AT&T)" },
+        { "negw", "Two's Complement Negation Word (AT&T)" },
+        { "nop", "No Operation" },
+        { "not", "One's Complement Negation" },
+        { "notb", "One's Complement Negation Byte (AT&T)" },
+        { "notl", "One's Complement Negation Long (AT&T)" },
+        { "notq", "One's Complement Negation Quad (AT&T)" },
+        { "notw", "One's Complement Negation Word (AT&T)" },
+        { "or", "Logical Inclusive Or" },
+        { "orb", "Logical Inclusive Or Byte (AT&T)" },
+        { "orl", "Logical Inclusive Or Long (AT&T)" },
+        { "orpd", "Bitwise Or Packed Double" },
+        { "orps", "Bitwise Or Packed Single" },
+        { "orq", "Logical Inclusive Or Quad (AT&T)" },
+        { "orw", "Logical Inclusive Or Word (AT&T)" },
+        { "out", "Output to Port" },
+        { "pabsb", "Packed Absolute Value Byte" },
+        { "pabsd", "Packed Absolute Value Doubleword" },
+        { "pabsw", "Packed Absolute Value Word" },
+        { "packssdw", "Pack With Signed Saturation Doubleword to Word" },
+        { "packsswb", "Pack With Signed Saturation Word to Byte" },
+        { "packusdw", "Pack With Unsigned Saturation Doubleword to Word" },
+        { "packuswb", "Pack With Unsigned Saturation Word to Byte" },
+        { "paddb", "Add Packed Byte" },
+        { "paddd", "Add Packed Doubleword" },
+        { "paddq", "Add Packed Quadword" },
+        { "paddsb", "Add Packed Signed Byte With Saturation" },
+        { "paddsw", "Add Packed Signed Word With Saturation" },
+        { "paddusb", "Add Packed Unsigned Byte With Saturation" },
+        { "paddusw", "Add Packed Unsigned Word With Saturation" },
+        { "paddw", "Add Packed Word" },
+        { "palignr", "Packed Align Right" },
+        { "pand", "Logical And" },
+        { "pandn", "Logical And Not" },
+        { "pause", "Spin Loop Hint" },
+        { "pavgb", "Average Packed Byte" },
+        { "pavgw", "Average Packed Word" },
+        { "pblendvb", "Variable Blend Packed Bytes" },
+        { "pblendw", "Blend Packed Words" },
+        { "pclmulqdq", "Carry-Less Multiplication Quadword" },
+        { "pcmpeqb", "Compare Packed Byte for Equal" },
+        { "pcmpeqd", "Compare Packed Doubleword for Equal" },
+        { "pcmpeqq", "Compare Packed Quadword for Equal" },
+        { "pcmpeqw", "Compare Packed Word for Equal" },
+        { "pcmpestri", "Packed Compare Explicit Length Strings, Return Index" },
+        { "pcmpestrm", "Packed Compare Explicit Length Strings, Return Mask" },
+        { "pcmpgtb", "Compare Packed Signed Byte for Greater Than" },
+        { "pcmpgtd", "Compare Packed Signed Doubleword for Greater Than" },
+        { "pcmpgtq", "Compare Packed Signed Quadword for Greater Than" },
+        { "pcmpgtw", "Compare Packed Signed Word for Greater Than" },
+        { "pcmpistri", "Packed Compare Implicit Length Strings, Return Index" },
+        { "pcmpistrm", "Packed Compare Implicit Length Strings, Return Mask" },
+        { "pdep", "Parallel Bits Deposit" },
+        { "pext", "Parallel Bits Extract" },
+        { "pextrb", "Extract Byte" },
+        { "pextrd", "Extract Doubleword" },
+        { "pextrq", "Extract Quadword" },
+        { "pextrw", "Extract Word" },
+        { "phaddd", "Packed Horizontal Add Doubleword" },
+        { "phaddw", "Packed Horizontal Add Word" },
+        { "phminposuw", "Packed Horizontal Word Minimum" },
+        { "phsubd", "Packed Horizontal Subtract Doubleword" },
+        { "phsubw", "Packed Horizontal Subtract Word" },
+        { "pinsrb", "Insert Byte" },
+        { "pinsrd", "Insert Doubleword" },
+        { "pinsrq", "Insert Quadword" },
+        { "pinsrw", "Insert Word" },
+        { "pmaddubsw", "Multiply and Add Packed Signed and Unsigned Bytes" },
+        { "pmaddwd", "Multiply and Add Packed Integers" },
+        { "pmaxsb", "Maximum of Packed Signed Byte" },
+        { "pmaxsd", "Maximum of Packed Signed Doubleword" },
+        { "pmaxsw", "Maximum of Packed Signed Word" },
+        { "pmaxub", "Maximum of Packed Unsigned Byte" },
+        { "pmaxud", "Maximum of Packed Unsigned Doubleword" },
+        { "pmaxuw", "Maximum of Packed Unsigned Word" },
+        { "pminsb", "Minimum of Packed Signed Byte" },
+        { "pminsd", "Minimum of Packed Signed Doubleword" },
+        { "pminsw", "Minimum of Packed Signed Word" },
+        { "pminub", "Minimum of Packed Unsigned Byte" },
+        { "pminud", "Minimum of Packed Unsigned Doubleword" },
+        { "pminuw", "Minimum of Packed Unsigned Word" },
+        { "pmovmskb", "Move Byte Mask" },
+        { "pmovsxbd", "Packed Move With Sign Extension Byte to Doubleword" },
+        { "pmovsxbw", "Packed Move With Sign Extension Byte to Word" },
+        { "pmovsxdq",
+          "Packed Move With Sign Extension Doubleword to Quadword" },
+        { "pmovsxwd", "Packed Move With Sign Extension Word to Doubleword" },
+        { "pmovzxbd", "Packed Move With Zero Extension Byte to Doubleword" },
+        { "pmovzxbw", "Packed Move With Zero Extension Byte to Word" },
+        { "pmovzxdq",
+          "Packed Move With Zero Extension Doubleword to Quadword" },
+        { "pmovzxwd", "Packed Move With Zero Extension Word to Doubleword" },
+        { "pmuldq", "Multiply Packed Signed Doubleword" },
+        { "pmulhrsw", "Packed Multiply High With Round and Scale" },
+        { "pmulhuw", "Multiply Packed Unsigned Word and Store High Result" },
+        { "pmulhw", "Multiply Packed Signed Word and Store High Result" },
+        { "pmulld", "Multiply Packed Signed Doubleword and Store Low Result" },
+        { "pmullw", "Multiply Packed Signed Word and Store Low Result" },
+        { "pmuludq", "Multiply Packed Unsigned Doubleword" },
+        { "pop", "Pop a Value From the Stack" },
+        { "popcnt", "Count Bits Set to 1" },
+        { "popf", "Pop Flags" },
+        { "popfq", "Pop RFLAGS" },
+        { "popl", "Pop a Value From the Stack Long (AT&T)" },
+        { "popq", "Pop a Value From the Stack Quad (AT&T)" },
+        { "popw", "Pop a Value From the Stack Word (AT&T)" },
+        { "por", "Bitwise Logical Or" },
+        { "prefetchnta", "Prefetch Non-Temporal" },
+        { "prefetcht0", "Prefetch to All Cache Levels" },
+        { "prefetcht1", "Prefetch to Level 2 Cache and Higher" },
+        { "prefetcht2", "Prefetch to Level 3 Cache and Higher" },
+        { "prefetchw", "Prefetch for Write" },
+        { "psadbw", "Compute Sum of Absolute Differences" },
+        { "pshufb", "Packed Shuffle Bytes" },
+        { "pshufd", "Shuffle Packed Doublewords" },
+        { "pshufhw", "Shuffle Packed High Words" },
+        { "pshuflw", "Shuffle Packed Low Words" },
+        { "psignb", "Packed Sign Byte" },
+        { "psignd", "Packed Sign Doubleword" },
+        { "psignw", "Packed Sign Word" },
+        { "pslld", "Shift Packed Doubleword Left Logical" },
+        { "pslldq", "Shift Double Quadword Left Logical" },
+        { "psllq", "Shift Packed Quadword Left Logical" },
+        { "psllw", "Shift Packed Word Left Logical" },
+        { "psrad", "Shift Packed Doubleword Right Arithmetic" },
+        { "psraw", "Shift Packed Word Right Arithmetic" },
+        { "psrld", "Shift Packed Doubleword Right Logical" },
+        { "psrldq", "Shift Double Quadword Right Logical" },
+        { "psrlq", "Shift Packed Quadword Right Logical" },
+        { "psrlw", "Shift Packed Word Right Logical" },
+        { "psubb", "Subtract Packed Byte" },
+        { "psubd", "Subtract Packed Doubleword" },
+        { "psubq", "Subtract Packed Quadword" },
+        { "psubsb", "Subtract Packed Signed Byte With Saturation" },
+        { "psubsw", "Subtract Packed Signed Word With Saturation" },
+        { "psubusb", "Subtract Packed Unsigned Byte With Saturation" },
+        { "psubusw", "Subtract Packed Unsigned Word With Saturation" },
+        { "psubw", "Subtract Packed Word" },
+        { "ptest", "Logical Compare" },
+        { "punpckhbw", "Unpack High Data Byte to Word" },
+        { "punpckhdq", "Unpack High Data Doubleword to Quadword" },
+        { "punpckhqdq", "Unpack High Data Quadword to Double Quadword" },
+        { "punpckhwd", "Unpack High Data Word to Doubleword" },
+        { "punpcklbw", "Unpack Low Data Byte to Word" },
+        { "punpckldq", "Unpack Low Data Doubleword to Quadword" },
+        { "punpcklqdq", "Unpack Low Data Quadword to Double Quadword" },
+        { "punpcklwd", "Unpack Low Data Word to Doubleword" },
+        { "push", "Push a Value Onto the Stack" },
+        { "pushf", "Push Flags" },
+        { "pushfq", "Push RFLAGS" },
+        { "pushl", "Push a Value Onto the Stack Long (AT&T)" },
+        { "pushq", "Push a Value Onto the Stack Quad (AT&T)" },
+        { "pushw", "Push a Value Onto the Stack Word (AT&T)" },
+        { "pxor", "Logical Exclusive Or" },
+        { "rcl", "Rotate Through Carry Left" },
+        { "rclb", "Rotate Through Carry Left Byte (AT&T)" },
+        { "rcll", "Rotate Through Carry Left Long (AT&T)" },
+        { "rclq", "Rotate Through Carry Left Quad (AT&T)" },
+        { "rclw", "Rotate Through Carry Left Word (AT&T)" },
+        { "rcpps", "Reciprocal of Packed Single" },
+        { "rcpss", "Reciprocal of Scalar Single" },
+        { "rcr", "Rotate Through Carry Right" },
+        { "rcrb", "Rotate Through Carry Right Byte (AT&T)" },
+        { "rcrl", "Rotate Through Carry Right Long (AT&T)" },
+        { "rcrq", "Rotate Through Carry Right Quad (AT&T)" },
+        { "rcrw", "Rotate Through Carry Right Word (AT&T)" },
+        { "rdmsr", "Read From Model Specific Register" },
+        { "rdpmc", "Read Performance Monitoring Counters" },
+        { "rdrand", "Read Random Number" },
+        { "rdseed", "Read Random Seed" },
+        { "rdtsc", "Read Time-Stamp Counter" },
+        { "rdtscp", "Read Time-Stamp Counter and Processor ID" },
+        { "rep", "Repeat String Operation Prefix" },
+        { "repe", "Repeat While Equal Prefix" },
+        { "repne", "Repeat While Not Equal Prefix" },
+        { "repnz", "Repeat While Not Zero Prefix" },
+        { "repz", "Repeat While Zero Prefix" },
+        { "ret", "Return From Procedure" },
+        { "retq", "Return From Procedure Quad (AT&T)" },
+        { "rol", "Rotate Left" },
+        { "rolb", "Rotate Left Byte (AT&T)" },
+        { "roll", "Rotate Left Long (AT&T)" },
+        { "rolq", "Rotate Left Quad (AT&T)" },
+        { "rolw", "Rotate Left Word (AT&T)" },
+        { "ror", "Rotate Right" },
+        { "rorb", "Rotate Right Byte (AT&T)" },
+        { "rorl", "Rotate Right Long (AT&T)" },
+        { "rorq", "Rotate Right Quad (AT&T)" },
+        { "rorw", "Rotate Right Word (AT&T)" },
+        { "rorx", "Rotate Right Logical Without Affecting Flags" },
+        { "roundpd", "Round Packed Double" },
+        { "roundps", "Round Packed Single" },
+        { "roundsd", "Round Scalar Double" },
+        { "roundss", "Round Scalar Single" },
+        { "rsqrtps", "Reciprocal Square Root of Packed Single" },
+        { "rsqrtss", "Reciprocal Square Root of Scalar Single" },
+        { "sahf", "Store AH Into Flags" },
+        { "sal", "Shift Arithmetic Left" },
+        { "salb", "Shift Arithmetic Left Byte (AT&T)" },
+        { "sall", "Shift Arithmetic Left Long (AT&T)" },
+        { "salq", "Shift Arithmetic Left Quad (AT&T)" },
+        { "salw", "Shift Arithmetic Left Word (AT&T)" },
+        { "sar", "Shift Arithmetic Right" },
+        { "sarb", "Shift Arithmetic Right Byte (AT&T)" },
+        { "sarl", "Shift Arithmetic Right Long (AT&T)" },
+        { "sarq", "Shift Arithmetic Right Quad (AT&T)" },
+        { "sarw", "Shift Arithmetic Right Word (AT&T)" },
+        { "sarx", "Shift Arithmetic Right Without Affecting Flags" },
+        { "sbb", "Integer Subtraction With Borrow" },
+        { "sbbb", "Integer Subtraction With Borrow Byte (AT&T)" },
+        { "sbbl", "Integer Subtraction With Borrow Long (AT&T)" },
+        { "sbbq", "Integer Subtraction With Borrow Quad (AT&T)" },
+        { "sbbw", "Integer Subtraction With Borrow Word (AT&T)" },
+        { "scas", "Scan String" },
+        { "scasb", "Scan String Byte" },
+        { "scasd", "Scan String Doubleword" },
+        { "scasq", "Scan String Quadword" },
+        { "scasw", "Scan String Word" },
+        { "seta", "Set Byte if Above" },
+        { "setae", "Set Byte if Above or Equal" },
+        { "setb", "Set Byte if Below" },
+        { "setbe", "Set Byte if Below or Equal" },
+        { "setc", "Set Byte if Carry" },
+        { "sete", "Set Byte if Equal" },
+        { "setg", "Set Byte if Greater" },
+        { "setge", "Set Byte if Greater or Equal" },
+        { "setl", "Set Byte if Less" },
+        { "setle", "Set Byte if Less or Equal" },
+        { "setna", "Set Byte if Not Above" },
+        { "setnae", "Set Byte if Not Above or Equal" },
+        { "setnb", "Set Byte if Not Below" },
+        { "setnbe", "Set Byte if Not Below or Equal" },
+        { "setnc", "Set Byte if Not Carry" },
+        { "setne", "Set Byte if Not Equal" },
+        { "setng", "Set Byte if Not Greater" },
+        { "setnge", "Set Byte if Not Greater or Equal" },
+        { "setnl", "Set Byte if Not Less" },
+        { "setnle", "Set Byte if Not Less or Equal" },
+        { "setno", "Set Byte if Not Overflow" },
+        { "setnp", "Set Byte if Not Parity" },
+        { "setns", "Set Byte if Not Sign" },
+        { "setnz", "Set Byte if Not Zero" },
+        { "seto", "Set Byte if Overflow" },
+        { "setp", "Set Byte if Parity" },
+        { "setpe", "Set Byte if Parity Even" },
+        { "setpo", "Set Byte if Parity Odd" },
+        { "sets", "Set Byte if Sign" },
+        { "setz", "Set Byte if Zero" },
+        { "sfence", "Store Fence" },
+        { "sha1msg1", "SHA1 Message Schedule 1" },
+        { "sha1msg2", "SHA1 Message Schedule 2" },
+        { "sha1nexte", "SHA1 Next State E" },
+        { "sha1rnds4", "SHA1 Four Rounds" },
+        { "sha256msg1", "SHA256 Message Schedule 1" },
+        { "sha256msg2", "SHA256 Message Schedule 2" },
+        { "sha256rnds2", "SHA256 Two Rounds" },
+        { "shl", "Shift Logical Left" },
+        { "shlb", "Shift Logical Left Byte (AT&T)" },
+        { "shld", "Double Precision Shift Left" },
+        { "shll", "Shift Logical Left Long (AT&T)" },
+        { "shlq", "Shift Logical Left Quad (AT&T)" },
+        { "shlw", "Shift Logical Left Word (AT&T)" },
+        { "shlx", "Shift Logical Left Without Affecting Flags" },
+        { "shr", "Shift Logical Right" },
+        { "shrb", "Shift Logical Right Byte (AT&T)" },
+        { "shrd", "Double Precision Shift Right" },
+        { "shrl", "Shift Logical Right Long (AT&T)" },
+        { "shrq", "Shift Logical Right Quad (AT&T)" },
+        { "shrw", "Shift Logical Right Word (AT&T)" },
+        { "shrx", "Shift Logical Right Without Affecting Flags" },
+        { "shufpd", "Shuffle Packed Double" },
+        { "shufps", "Shuffle Packed Single" },
+        { "sqrtpd", "Square Root of Packed Double" },
+        { "sqrtps", "Square Root of Packed Single" },
+        { "sqrtsd", "Square Root of Scalar Double" },
+        { "sqrtss", "Square Root of Scalar Single" },
+        { "stc", "Set Carry Flag" },
+        { "std", "Set Direction Flag" },
+        { "sti", "Set Interrupt Flag" },
+        { "stmxcsr", "Store MXCSR Register" },
+        { "stos", "Store String" },
+        { "stosb", "Store String Byte" },
+        { "stosd", "Store String Doubleword" },
+        { "stosq", "Store String Quadword" },
+        { "stosw", "Store String Word" },
+        { "sub", "Subtract" },
+        { "subb", "Subtract Byte (AT&T)" },
+        { "subl", "Subtract Long (AT&T)" },
+        { "subpd", "Subtract Packed Double" },
+        { "subps", "Subtract Packed Single" },
+        { "subq", "Subtract Quad (AT&T)" },
+        { "subsd", "Subtract Scalar Double" },
+        { "subss", "Subtract Scalar Single" },
+        { "subw", "Subtract Word (AT&T)" },
+        { "swapgs", "Swap GS Base Register" },
+        { "syscall", "Fast System Call" },
+        { "sysenter", "Fast System Call (Legacy)" },
+        { "sysexit", "Fast Return From System Call (Legacy)" },
+        { "sysret", "Return From Fast System Call" },
+        { "test", "Logical Compare" },
+        { "testb", "Logical Compare Byte (AT&T)" },
+        { "testl", "Logical Compare Long (AT&T)" },
+        { "testq", "Logical Compare Quad (AT&T)" },
+        { "testw", "Logical Compare Word (AT&T)" },
+        { "tzcnt", "Count Trailing Zero Bits" },
+        { "ucomisd", "Unordered Compare Scalar Double" },
+        { "ucomiss", "Unordered Compare Scalar Single" },
+        { "ud2", "Undefined Instruction" },
+        { "unpckhpd", "Unpack High Packed Double" },
+        { "unpckhps", "Unpack High Packed Single" },
+        { "unpcklpd", "Unpack Low Packed Double" },
+        { "unpcklps", "Unpack Low Packed Single" },
+        { "vaddpd", "Add Packed Double (VEX)" },
+        { "vaddps", "Add Packed Single (VEX)" },
+        { "vaddsd", "Add Scalar Double (VEX)" },
+        { "vaddss", "Add Scalar Single (VEX)" },
+        { "vaddsubpd", "Add and Subtract Packed Double (VEX)" },
+        { "vaddsubps", "Add and Subtract Packed Single (VEX)" },
+        { "vaesdec", "AES Decrypt Round (VEX)" },
+        { "vaesdeclast", "AES Decrypt Last Round (VEX)" },
+        { "vaesenc", "AES Encrypt Round (VEX)" },
+        { "vaesenclast", "AES Encrypt Last Round (VEX)" },
+        { "vaesimc", "AES Inverse Mix Columns (VEX)" },
+        { "vaeskeygenassist", "AES Round Key Generation Assist (VEX)" },
+        { "vandnpd", "Bitwise And Not Packed Double (VEX)" },
+        { "vandnps", "Bitwise And Not Packed Single (VEX)" },
+        { "vandpd", "Bitwise And Packed Double (VEX)" },
+        { "vandps", "Bitwise And Packed Single (VEX)" },
+        { "vblendpd", "Blend Packed Double (VEX)" },
+        { "vblendps", "Blend Packed Single (VEX)" },
+        { "vblendvpd", "Variable Blend Packed Double (VEX)" },
+        { "vblendvps", "Variable Blend Packed Single (VEX)" },
+        { "vbroadcastf128", "Broadcast 128 Bits of Floating Point Data" },
+        { "vbroadcastf32x4", "Broadcast 128 Bits of Packed Single" },
+        { "vbroadcasti128", "Broadcast 128 Bits of Integer Data" },
+        { "vbroadcasti32x4", "Broadcast 128 Bits of Packed Doublewords" },
+        { "vbroadcastsd", "Broadcast Double" },
+        { "vbroadcastss", "Broadcast Single" },
+        { "vcmppd", "Compare Packed Double (VEX)" },
+        { "vcmpps", "Compare Packed Single (VEX)" },
+        { "vcmpsd", "Compare Scalar Double (VEX)" },
+        { "vcmpss", "Compare Scalar Single (VEX)" },
+        { "vcomisd", "Compare Ordered Scalar Double (VEX)" },
+        { "vcomiss", "Compare Ordered Scalar Single (VEX)" },
+        { "vcompresspd", "Store Sparse Packed Double Into Dense Memory" },
+        { "vcompressps", "Store Sparse Packed Single Into Dense Memory" },
+        { "vcvtdq2pd", "Convert Packed Doubleword to Packed Double (VEX)" },
+        { "vcvtdq2ps", "Convert Packed Doubleword to Packed Single (VEX)" },
+        { "vcvtpd2dq", "Convert Packed Double to Packed Doubleword (VEX)" },
+        { "vcvtpd2ps", "Convert Packed Double to Packed Single (VEX)" },
+        { "vcvtph2ps", "Convert Packed Half to Packed Single" },
+        { "vcvtps2dq", "Convert Packed Single to Packed Doubleword (VEX)" },
+        { "vcvtps2pd", "Convert Packed Single to Packed Double (VEX)" },
+        { "vcvtps2ph", "Convert Packed Single to Packed Half" },
+        { "vcvtsd2si", "Convert Scalar Double to Integer (VEX)" },
+        { "vcvtsd2ss", "Convert Scalar Double to Scalar Single (VEX)" },
+        { "vcvtsi2sd", "Convert Integer to Scalar Double (VEX)" },
+        { "vcvtsi2ss", "Convert Integer to Scalar Single (VEX)" },
+        { "vcvtss2sd", "Convert Scalar Single to Scalar Double (VEX)" },
+        { "vcvtss2si", "Convert Scalar Single to Integer (VEX)" },
+        { "vcvttpd2dq",
+          "Convert With Truncation Packed Double to Packed Doubleword (VEX)" },
+        { "vcvttps2dq",
+          "Convert With Truncation Packed Single to Packed Doubleword (VEX)" },
+        { "vcvttsd2si",
+          "Convert With Truncation Scalar Double to Integer (VEX)" },
+        { "vcvttss2si",
+          "Convert With Truncation Scalar Single to Integer (VEX)" },
+        { "vdbpsadbw", "Double Block Packed Sum of Absolute Differences" },
+        { "vdivpd", "Divide Packed Double (VEX)" },
+        { "vdivps", "Divide Packed Single (VEX)" },
+        { "vdivsd", "Divide Scalar Double (VEX)" },
+        { "vdivss", "Divide Scalar Single (VEX)" },
+        { "vdppd", "Dot Product Packed Double (VEX)" },
+        { "vdpps", "Dot Product Packed Single (VEX)" },
+        { "vexpandpd", "Load Sparse Packed Double From Dense Memory" },
+        { "vexpandps", "Load Sparse Packed Single From Dense Memory" },
+        { "vextractf128", "Extract 128 Bits of Floating Point Data" },
+        { "vextractf32x4", "Extract 128 Bits of Packed Single" },
+        { "vextractf64x4", "Extract 256 Bits of Packed Double" },
+        { "vextracti128", "Extract 128 Bits of Integer Data" },
+        { "vextracti32x4", "Extract 128 Bits of Packed Doublewords" },
+        { "vextracti64x4", "Extract 256 Bits of Packed Quadwords" },
+        { "vextractps", "Extract Packed Single (VEX)" },
+        { "vfixupimmpd", "Fix Up Special Packed Double" },
+        { "vfixupimmps", "Fix Up Special Packed Single" },
+        { "vfmadd132pd", "Fused Multiply-Add Packed Double" },
+        { "vfmadd132ps", "Fused Multiply-Add Packed Single" },
+        { "vfmadd132sd", "Fused Multiply-Add Scalar Double" },
+        { "vfmadd132ss", "Fused Multiply-Add Scalar Single" },
+        { "vfmadd213pd", "Fused Multiply-Add Packed Double" },
+        { "vfmadd213ps", "Fused Multiply-Add Packed Single" },
+        { "vfmadd213sd", "Fused Multiply-Add Scalar Double" },
+        { "vfmadd213ss", "Fused Multiply-Add Scalar Single" },
+        { "vfmadd231pd", "Fused Multiply-Add Packed Double" },
+        { "vfmadd231ps", "Fused Multiply-Add Packed Single" },
+        { "vfmadd231sd", "Fused Multiply-Add Scalar Double" },
+        { "vfmadd231ss", "Fused Multiply-Add Scalar Single" },
+        { "vfmaddsub132pd",
+          "Fused Multiply-Alternating Add/Subtract Packed Double" },
+        { "vfmaddsub132ps",
+          "Fused Multiply-Alternating Add/Subtract Packed Single" },
+        { "vfmaddsub213pd",
+          "Fused Multiply-Alternating Add/Subtract Packed Double" },
+        { "vfmaddsub213ps",
+          "Fused Multiply-Alternating Add/Subtract Packed Single" },
+        { "vfmaddsub231pd",
+          "Fused Multiply-Alternating Add/Subtract Packed Double" },
+        { "vfmaddsub231ps",
+          "Fused Multiply-Alternating Add/Subtract Packed Single" },
+        { "vfmsub132pd", "Fused Multiply-Subtract Packed Double" },
+        { "vfmsub132ps", "Fused Multiply-Subtract Packed Single" },
+        { "vfmsub132sd", "Fused Multiply-Subtract Scalar Double" },
+        { "vfmsub132ss", "Fused Multiply-Subtract Scalar Single" },
+        { "vfmsub213pd", "Fused Multiply-Subtract Packed Double" },
+        { "vfmsub213ps", "Fused Multiply-Subtract Packed Single" },
+        { "vfmsub213sd", "Fused Multiply-Subtract Scalar Double" },
+        { "vfmsub213ss", "Fused Multiply-Subtract Scalar Single" },
+        { "vfmsub231pd", "Fused Multiply-Subtract Packed Double" },
+        { "vfmsub231ps", "Fused Multiply-Subtract Packed Single" },
+        { "vfmsub231sd", "Fused Multiply-Subtract Scalar Double" },
+        { "vfmsub231ss", "Fused Multiply-Subtract Scalar Single" },
+        { "vfmsubadd132pd",
+          "Fused Multiply-Alternating Subtract/Add Packed Double" },
+        { "vfmsubadd132ps",
+          "Fused Multiply-Alternating Subtract/Add Packed Single" },
+        { "vfmsubadd213pd",
+          "Fused Multiply-Alternating Subtract/Add Packed Double" },
+        { "vfmsubadd213ps",
+          "Fused Multiply-Alternating Subtract/Add Packed Single" },
+        { "vfmsubadd231pd",
+          "Fused Multiply-Alternating Subtract/Add Packed Double" },
+        { "vfmsubadd231ps",
+          "Fused Multiply-Alternating Subtract/Add Packed Single" },
+        { "vfnmadd132pd", "Fused Negative Multiply-Add Packed Double" },
+        { "vfnmadd132ps", "Fused Negative Multiply-Add Packed Single" },
+        { "vfnmadd132sd", "Fused Negative Multiply-Add Scalar Double" },
+        { "vfnmadd132ss", "Fused Negative Multiply-Add Scalar Single" },
+        { "vfnmadd213pd", "Fused Negative Multiply-Add Packed Double" },
+        { "vfnmadd213ps", "Fused Negative Multiply-Add Packed Single" },
+        { "vfnmadd213sd", "Fused Negative Multiply-Add Scalar Double" },
+        { "vfnmadd213ss", "Fused Negative Multiply-Add Scalar Single" },
+        { "vfnmadd231pd", "Fused Negative Multiply-Add Packed Double" },
+        { "vfnmadd231ps", "Fused Negative Multiply-Add Packed Single" },
+        { "vfnmadd231sd", "Fused Negative Multiply-Add Scalar Double" },
+        { "vfnmadd231ss", "Fused Negative Multiply-Add Scalar Single" },
+        { "vfnmsub132pd", "Fused Negative Multiply-Subtract Packed Double" },
+        { "vfnmsub132ps", "Fused Negative Multiply-Subtract Packed Single" },
+        { "vfnmsub132sd", "Fused Negative Multiply-Subtract Scalar Double" },
+        { "vfnmsub132ss", "Fused Negative Multiply-Subtract Scalar Single" },
+        { "vfnmsub213pd", "Fused Negative Multiply-Subtract Packed Double" },
+        { "vfnmsub213ps", "Fused Negative Multiply-Subtract Packed Single" },
+        { "vfnmsub213sd", "Fused Negative Multiply-Subtract Scalar Double" },
+        { "vfnmsub213ss", "Fused Negative Multiply-Subtract Scalar Single" },
+        { "vfnmsub231pd", "Fused Negative Multiply-Subtract Packed Double" },
+        { "vfnmsub231ps", "Fused Negative Multiply-Subtract Packed Single" },
+        { "vfnmsub231sd", "Fused Negative Multiply-Subtract Scalar Double" },
+        { "vfnmsub231ss", "Fused Negative Multiply-Subtract Scalar Single" },
+        { "vgatherdpd", "Gather Packed Double With Doubleword Indices" },
+        { "vgatherdps", "Gather Packed Single With Doubleword Indices" },
+        { "vgatherqpd", "Gather Packed Double With Quadword Indices" },
+        { "vgatherqps", "Gather Packed Single With Quadword Indices" },
+        { "vgetexppd", "Get Exponents of Packed Double" },
+        { "vgetexpps", "Get Exponents of Packed Single" },
+        { "vgetmantpd", "Get Mantissas of Packed Double" },
+        { "vgetmantps", "Get Mantissas of Packed Single" },
+        { "vhaddpd", "Horizontal Add Packed Double (VEX)" },
+        { "vhaddps", "Horizontal Add Packed Single (VEX)" },
+        { "vhsubpd", "Horizontal Subtract Packed Double (VEX)" },
+        { "vhsubps", "Horizontal Subtract Packed Single (VEX)" },
+        { "vinsertf128", "Insert 128 Bits of Floating Point Data" },
+        { "vinsertf32x4", "Insert 128 Bits of Packed Single" },
+        { "vinsertf64x4", "Insert 256 Bits of Packed Double" },
+        { "vinserti128", "Insert 128 Bits of Integer Data" },
+        { "vinserti32x4", "Insert 128 Bits of Packed Doublewords" },
+        { "vinserti64x4", "Insert 256 Bits of Packed Quadwords" },
+        { "vinsertps", "Insert Packed Single (VEX)" },
+        { "vlddqu", "Load Unaligned Integer 128 Bits (VEX)" },
+        { "vmaskmovdqu", "Store Selected Bytes of Double Quadword (VEX)" },
+        { "vmaskmovpd", "Conditional Move Packed Double" },
+        { "vmaskmovps", "Conditional Move Packed Single" },
+        { "vmaxpd", "Maximum of Packed Double (VEX)" },
+        { "vmaxps", "Maximum of Packed Single (VEX)" },
+        { "vmaxsd", "Maximum of Scalar Double (VEX)" },
+        { "vmaxss", "Maximum of Scalar Single (VEX)" },
+        { "vminpd", "Minimum of Packed Double (VEX)" },
+        { "vminps", "Minimum of Packed Single (VEX)" },
+        { "vminsd", "Minimum of Scalar Double (VEX)" },
+        { "vminss", "Minimum of Scalar Single (VEX)" },
+        { "vmovapd", "Move Aligned Packed Double (VEX)" },
+        { "vmovaps", "Move Aligned Packed Single (VEX)" },
+        { "vmovd", "Move Doubleword (VEX)" },
+        { "vmovddup", "Replicate Double (VEX)" },
+        { "vmovdqa", "Move Aligned Double Quadword (VEX)" },
+        { "vmovdqa32", "Move Aligned Packed Doublewords" },
+        { "vmovdqa64", "Move Aligned Packed Quadwords" },
+        { "vmovdqu", "Move Unaligned Double Quadword (VEX)" },
+        { "vmovdqu16", "Move Unaligned Packed Words" },
+        { "vmovdqu32", "Move Unaligned Packed Doublewords" },
+        { "vmovdqu64", "Move Unaligned Packed Quadwords" },
+        { "vmovdqu8", "Move Unaligned Packed Bytes" },
+        { "vmovhlps", "Move Packed Single High to Low (VEX)" },
+        { "vmovhpd", "Move High Packed Double (VEX)" },
+        { "vmovhps", "Move High Packed Single (VEX)" },
+        { "vmovlhps", "Move Packed Single Low to High (VEX)" },
+        { "vmovlpd", "Move Low Packed Double (VEX)" },
+        { "vmovlps", "Move Low Packed Single (VEX)" },
+        { "vmovmskpd", "Extract Packed Double Sign Mask (VEX)" },
+        { "vmovmskps", "Extract Packed Single Sign Mask (VEX)" },
+        { "vmovntdq", "Store Double Quadword Non-Temporal (VEX)" },
+        { "vmovntdqa", "Load Double Quadword Non-Temporal Aligned Hint (VEX)" },
+        { "vmovntpd", "Store Packed Double Non-Temporal (VEX)" },
+        { "vmovntps", "Store Packed Single Non-Temporal (VEX)" },
+        { "vmovq", "Move Quadword (VEX)" },
+        { "vmovsd", "Move Scalar Double (VEX)" },
+        { "vmovshdup", "Replicate Single High (VEX)" },
+        { "vmovsldup", "Replicate Single Low (VEX)" },
+        { "vmovss", "Move Scalar Single (VEX)" },
+        { "vmovupd", "Move Unaligned Packed Double (VEX)" },
+        { "vmovups", "Move Unaligned Packed Single (VEX)" },
+        { "vmpsadbw",
+          "Compute Multiple Packed Sums of Absolute Difference (VEX)" },
+        { "vmulpd", "Multiply Packed Double (VEX)" },
+        { "vmulps", "Multiply Packed Single (VEX)" },
+        { "vmulsd", "Multiply Scalar Double (VEX)" },
+        { "vmulss", "Multiply Scalar Single (VEX)" },
+        { "vorpd", "Bitwise Or Packed Double (VEX)" },
+        { "vorps", "Bitwise Or Packed Single (VEX)" },
+        { "vpabsb", "Packed Absolute Value Byte (VEX)" },
+        { "vpabsd", "Packed Absolute Value Doubleword (VEX)" },
+        { "vpabsq", "Packed Absolute Value Quadword" },
+        { "vpabsw", "Packed Absolute Value Word (VEX)" },
+        { "vpackssdw", "Pack With Signed Saturation Doubleword to Word (VEX)" },
+        { "vpacksswb", "Pack With Signed Saturation Word to Byte (VEX)" },
+        { "vpackusdw",
+          "Pack With Unsigned Saturation Doubleword to Word (VEX)" },
+        { "vpackuswb", "Pack With Unsigned Saturation Word to Byte (VEX)" },
+        { "vpaddb", "Add Packed Byte (VEX)" },
+        { "vpaddd", "Add Packed Doubleword (VEX)" },
+        { "vpaddq", "Add Packed Quadword (VEX)" },
+        { "vpaddsb", "Add Packed Signed Byte With Saturation (VEX)" },
+        { "vpaddsw", "Add Packed Signed Word With Saturation (VEX)" },
+        { "vpaddusb", "Add Packed Unsigned Byte With Saturation (VEX)" },
+        { "vpaddusw", "Add Packed Unsigned Word With Saturation (VEX)" },
+        { "vpaddw", "Add Packed Word (VEX)" },
+        { "vpalignr", "Packed Align Right (VEX)" },
+        { "vpand", "Logical And (VEX)" },
+        { "vpandd", "Bitwise And Packed Doublewords" },
+        { "vpandn", "Logical And Not (VEX)" },
+        { "vpandnd", "Bitwise And Not Packed Doublewords" },
+        { "vpandnq", "Bitwise And Not Packed Quadwords" },
+        { "vpandq", "Bitwise And Packed Quadwords" },
+        { "vpavgb", "Average Packed Byte (VEX)" },
+        { "vpavgw", "Average Packed Word (VEX)" },
+        { "vpblendd", "Blend Packed Doublewords" },
+        { "vpblendvb", "Variable Blend Packed Bytes (VEX)" },
+        { "vpblendw", "Blend Packed Words (VEX)" },
+        { "vpbroadcastb", "Broadcast Byte" },
+        { "vpbroadcastd", "Broadcast Doubleword" },
+        { "vpbroadcastq", "Broadcast Quadword" },
+        { "vpbroadcastw", "Broadcast Word" },
+        { "vpclmulqdq", "Carry-Less Multiplication Quadword (VEX)" },
+        { "vpcmpb", "Compare Packed Signed Bytes" },
+        { "vpcmpd", "Compare Packed Signed Doublewords" },
+        { "vpcmpeqb", "Compare Packed Byte for Equal (VEX)" },
+        { "vpcmpeqd", "Compare Packed Doubleword for Equal (VEX)" },
+        { "vpcmpeqq", "Compare Packed Quadword for Equal (VEX)" },
+        { "vpcmpeqw", "Compare Packed Word for Equal (VEX)" },
+        { "vpcmpestri",
+          "Packed Compare Explicit Length Strings, Return Index (VEX)" },
+        { "vpcmpestrm",
+          "Packed Compare Explicit Length Strings, Return Mask (VEX)" },
+        { "vpcmpgtb", "Compare Packed Signed Byte for Greater Than (VEX)" },
+        { "vpcmpgtd",
+          "Compare Packed Signed Doubleword for Greater Than (VEX)" },
+        { "vpcmpgtq", "Compare Packed Signed Quadword for Greater Than (VEX)" },
+        { "vpcmpgtw", "Compare Packed Signed Word for Greater Than (VEX)" },
+        { "vpcmpistri",
+          "Packed Compare Implicit Length Strings, Return Index (VEX)" },
+        { "vpcmpistrm",
+          "Packed Compare Implicit Length Strings, Return Mask (VEX)" },
+        { "vpcmpq", "Compare Packed Signed Quadwords" },
+        { "vpcmpub", "Compare Packed Unsigned Bytes" },
+        { "vpcmpud", "Compare Packed Unsigned Doublewords" },
+        { "vpcmpuq", "Compare Packed Unsigned Quadwords" },
+        { "vpcmpuw", "Compare Packed Unsigned Words" },
+        { "vpcmpw", "Compare Packed Signed Words" },
+        { "vpcompressd", "Store Sparse Packed Doublewords Into Dense Memory" },
+        { "vpcompressq", "Store Sparse Packed Quadwords Into Dense Memory" },
+        { "vpconflictd", "Detect Conflicts Within Packed Doublewords" },
+        { "vpconflictq", "Detect Conflicts Within Packed Quadwords" },
+        { "vpdpbusd", "Multiply and Add Unsigned and Signed Bytes" },
+        { "vpdpwssd", "Multiply and Add Signed Words" },
+        { "vperm2f128", "Permute Floating Point Values" },
+        { "vperm2i128", "Permute Integer Values" },
+        { "vpermd", "Permute Packed Doublewords" },
+        { "vpermi2d",
+          "Full Permute of Doublewords From Two Tables, Overwriting the "
+          "Index" },
+        { "vpermi2q",
+          "Full Permute of Quadwords From Two Tables, Overwriting the Index" },
+        { "vpermilpd", "Permute In-Lane Packed Double" },
+        { "vpermilps", "Permute In-Lane Packed Single" },
+        { "vpermpd", "Permute Packed Double" },
+        { "vpermps", "Permute Packed Single" },
+        { "vpermq", "Permute Packed Quadwords" },
+        { "vpermt2d", "Full Permute of Doublewords From Two Tables" },
+        { "vpermt2pd", "Full Permute of Double From Two Tables" },
+        { "vpermt2ps", "Full Permute of Single From Two Tables" },
+        { "vpermt2q", "Full Permute of Quadwords From Two Tables" },
+        { "vpexpandd", "Load Sparse Packed Doublewords From Dense Memory" },
+        { "vpexpandq", "Load Sparse Packed Quadwords From Dense Memory" },
+        { "vpextrb", "Extract Byte (VEX)" },
+        { "vpextrd", "Extract Doubleword (VEX)" },
+        { "vpextrq", "Extract Quadword (VEX)" },
+        { "vpextrw", "Extract Word (VEX)" },
+        { "vpgatherdd", "Gather Packed Doublewords With Doubleword Indices" },
+        { "vpgatherdq", "Gather Packed Quadwords With Doubleword Indices" },
+        { "vpgatherqd", "Gather Packed Doublewords With Quadword Indices" },
+        { "vpgatherqq", "Gather Packed Quadwords With Quadword Indices" },
+        { "vphaddd", "Packed Horizontal Add Doubleword (VEX)" },
+        { "vphaddw", "Packed Horizontal Add Word (VEX)" },
+        { "vphminposuw", "Packed Horizontal Word Minimum (VEX)" },
+        { "vphsubd", "Packed Horizontal Subtract Doubleword (VEX)" },
+        { "vphsubw", "Packed Horizontal Subtract Word (VEX)" },
+        { "vpinsrb", "Insert Byte (VEX)" },
+        { "vpinsrd", "Insert Doubleword (VEX)" },
+        { "vpinsrq", "Insert Quadword (VEX)" },
+        { "vpinsrw", "Insert Word (VEX)" },
+        { "vplzcntd", "Count Leading Zero Bits of Packed Doublewords" },
+        { "vplzcntq", "Count Leading Zero Bits of Packed Quadwords" },
+        { "vpmaddubsw",
+          "Multiply and Add Packed Signed and Unsigned Bytes (VEX)" },
+        { "vpmaddwd", "Multiply and Add Packed Integers (VEX)" },
+        { "vpmaskmovd", "Conditional Move Packed Doubleword" },
+        { "vpmaskmovq", "Conditional Move Packed Quadword" },
+        { "vpmaxsb", "Maximum of Packed Signed Byte (VEX)" },
+        { "vpmaxsd", "Maximum of Packed Signed Doubleword (VEX)" },
+        { "vpmaxsq", "Maximum of Packed Signed Quadword" },
+        { "vpmaxsw", "Maximum of Packed Signed Word (VEX)" },
+        { "vpmaxub", "Maximum of Packed Unsigned Byte (VEX)" },
+        { "vpmaxud", "Maximum of Packed Unsigned Doubleword (VEX)" },
+        { "vpmaxuq", "Maximum of Packed Unsigned Quadword" },
+        { "vpmaxuw", "Maximum of Packed Unsigned Word (VEX)" },
+        { "vpminsb", "Minimum of Packed Signed Byte (VEX)" },
+        { "vpminsd", "Minimum of Packed Signed Doubleword (VEX)" },
+        { "vpminsq", "Minimum of Packed Signed Quadword" },
+        { "vpminsw", "Minimum of Packed Signed Word (VEX)" },
+        { "vpminub", "Minimum of Packed Unsigned Byte (VEX)" },
+        { "vpminud", "Minimum of Packed Unsigned Doubleword (VEX)" },
+        { "vpminuq", "Minimum of Packed Unsigned Quadword" },
+        { "vpminuw", "Minimum of Packed Unsigned Word (VEX)" },
+        { "vpmovd2m", "Convert Doublewords to Mask" },
+        { "vpmovdb", "Truncate Doublewords to Bytes" },
+        { "vpmovdw", "Truncate Doublewords to Words" },
+        { "vpmovm2d", "Convert Mask to Doublewords" },
+        { "vpmovmskb", "Move Byte Mask (VEX)" },
+        { "vpmovqb", "Truncate Quadwords to Bytes" },
+        { "vpmovqd", "Truncate Quadwords to Doublewords" },
+        { "vpmovqw", "Truncate Quadwords to Words" },
+        { "vpmovsxbd",
+          "Packed Move With Sign Extension Byte to Doubleword (VEX)" },
+        { "vpmovsxbw", "Packed Move With Sign Extension Byte to Word (VEX)" },
+        { "vpmovsxdq",
+          "Packed Move With Sign Extension Doubleword to Quadword (VEX)" },
+        { "vpmovsxwd",
+          "Packed Move With Sign Extension Word to Doubleword (VEX)" },
+        { "vpmovwb", "Truncate Words to Bytes" },
+        { "vpmovzxbd",
+          "Packed Move With Zero Extension Byte to Doubleword (VEX)" },
+        { "vpmovzxbw", "Packed Move With Zero Extension Byte to Word (VEX)" },
+        { "vpmovzxdq",
+          "Packed Move With Zero Extension Doubleword to Quadword (VEX)" },
+        { "vpmovzxwd",
+          "Packed Move With Zero Extension Word to Doubleword (VEX)" },
+        { "vpmuldq", "Multiply Packed Signed Doubleword (VEX)" },
+        { "vpmulhrsw", "Packed Multiply High With Round and Scale (VEX)" },
+        { "vpmulhuw",
+          "Multiply Packed Unsigned Word and Store High Result (VEX)" },
+        { "vpmulhw",
+          "Multiply Packed Signed Word and Store High Result (VEX)" },
+        { "vpmulld",
+          "Multiply Packed Signed Doubleword and Store Low Result (VEX)" },
+        { "vpmullq", "Multiply Packed Quadwords and Store Low Result" },
+        { "vpmullw", "Multiply Packed Signed Word and Store Low Result (VEX)" },
+        { "vpmuludq", "Multiply Packed Unsigned Doubleword (VEX)" },
+        { "vpopcntd", "Count Set Bits of Packed Doublewords" },
+        { "vpopcntq", "Count Set Bits of Packed Quadwords" },
+        { "vpor", "Bitwise Logical Or (VEX)" },
+        { "vpord", "Bitwise Or Packed Doublewords" },
+        { "vporq", "Bitwise Or Packed Quadwords" },
+        { "vprold", "Rotate Packed Doublewords Left" },
+        { "vprolq", "Rotate Packed Quadwords Left" },
+        { "vprord", "Rotate Packed Doublewords Right" },
+        { "vprorq", "Rotate Packed Quadwords Right" },
+        { "vpsadbw", "Compute Sum of Absolute Differences (VEX)" },
+        { "vpscatterdd", "Scatter Packed Doublewords With Doubleword Indices" },
+        { "vpscatterdq", "Scatter Packed Quadwords With Doubleword Indices" },
+        { "vpshufb", "Packed Shuffle Bytes (VEX)" },
+        { "vpshufd", "Shuffle Packed Doublewords (VEX)" },
+        { "vpshufhw", "Shuffle Packed High Words (VEX)" },
+        { "vpshuflw", "Shuffle Packed Low Words (VEX)" },
+        { "vpsignb", "Packed Sign Byte (VEX)" },
+        { "vpsignd", "Packed Sign Doubleword (VEX)" },
+        { "vpsignw", "Packed Sign Word (VEX)" },
+        { "vpslld", "Shift Packed Doubleword Left Logical (VEX)" },
+        { "vpslldq", "Shift Double Quadword Left Logical (VEX)" },
+        { "vpsllq", "Shift Packed Quadword Left Logical (VEX)" },
+        { "vpsllvd", "Variable Shift Packed Doublewords Left Logical" },
+        { "vpsllvq", "Variable Shift Packed Quadwords Left Logical" },
+        { "vpsllw", "Shift Packed Word Left Logical (VEX)" },
+        { "vpsrad", "Shift Packed Doubleword Right Arithmetic (VEX)" },
+        { "vpsraq", "Shift Packed Quadword Right Arithmetic" },
+        { "vpsravd", "Variable Shift Packed Doublewords Right Arithmetic" },
+        { "vpsravq", "Variable Shift Packed Quadwords Right Arithmetic" },
+        { "vpsraw", "Shift Packed Word Right Arithmetic (VEX)" },
+        { "vpsrld", "Shift Packed Doubleword Right Logical (VEX)" },
+        { "vpsrldq", "Shift Double Quadword Right Logical (VEX)" },
+        { "vpsrlq", "Shift Packed Quadword Right Logical (VEX)" },
+        { "vpsrlvd", "Variable Shift Packed Doublewords Right Logical" },
+        { "vpsrlvq", "Variable Shift Packed Quadwords Right Logical" },
+        { "vpsrlw", "Shift Packed Word Right Logical (VEX)" },
+        { "vpsubb", "Subtract Packed Byte (VEX)" },
+        { "vpsubd", "Subtract Packed Doubleword (VEX)" },
+        { "vpsubq", "Subtract Packed Quadword (VEX)" },
+        { "vpsubsb", "Subtract Packed Signed Byte With Saturation (VEX)" },
+        { "vpsubsw", "Subtract Packed Signed Word With Saturation (VEX)" },
+        { "vpsubusb", "Subtract Packed Unsigned Byte With Saturation (VEX)" },
+        { "vpsubusw", "Subtract Packed Unsigned Word With Saturation (VEX)" },
+        { "vpsubw", "Subtract Packed Word (VEX)" },
+        { "vpternlogd", "Bitwise Ternary Logic Doublewords" },
+        { "vpternlogq", "Bitwise Ternary Logic Quadwords" },
+        { "vptest", "Logical Compare (VEX)" },
+        { "vpunpckhbw", "Unpack High Data Byte to Word (VEX)" },
+        { "vpunpckhdq", "Unpack High Data Doubleword to Quadword (VEX)" },
+        { "vpunpckhqdq", "Unpack High Data Quadword to Double Quadword (VEX)" },
+        { "vpunpckhwd", "Unpack High Data Word to Doubleword (VEX)" },
+        { "vpunpcklbw", "Unpack Low Data Byte to Word (VEX)" },
+        { "vpunpckldq", "Unpack Low Data Doubleword to Quadword (VEX)" },
+        { "vpunpcklqdq", "Unpack Low Data Quadword to Double Quadword (VEX)" },
+        { "vpunpcklwd", "Unpack Low Data Word to Doubleword (VEX)" },
+        { "vpxor", "Logical Exclusive Or (VEX)" },
+        { "vpxord", "Bitwise Exclusive Or Packed Doublewords" },
+        { "vpxorq", "Bitwise Exclusive Or Packed Quadwords" },
+        { "vrcp14pd", "Reciprocal of Packed Double" },
+        { "vrcp14ps", "Reciprocal of Packed Single" },
+        { "vrcpps", "Reciprocal of Packed Single (VEX)" },
+        { "vrcpss", "Reciprocal of Scalar Single (VEX)" },
+        { "vrndscalepd", "Round Packed Double to Scaled Integer" },
+        { "vrndscaleps", "Round Packed Single to Scaled Integer" },
+        { "vroundpd", "Round Packed Double (VEX)" },
+        { "vroundps", "Round Packed Single (VEX)" },
+        { "vroundsd", "Round Scalar Double (VEX)" },
+        { "vroundss", "Round Scalar Single (VEX)" },
+        { "vrsqrt14pd", "Reciprocal Square Root of Packed Double" },
+        { "vrsqrt14ps", "Reciprocal Square Root of Packed Single" },
+        { "vrsqrtps", "Reciprocal Square Root of Packed Single (VEX)" },
+        { "vrsqrtss", "Reciprocal Square Root of Scalar Single (VEX)" },
+        { "vscalefpd", "Scale Packed Double" },
+        { "vscalefps", "Scale Packed Single" },
+        { "vscatterdpd", "Scatter Packed Double With Doubleword Indices" },
+        { "vscatterdps", "Scatter Packed Single With Doubleword Indices" },
+        { "vshufpd", "Shuffle Packed Double (VEX)" },
+        { "vshufps", "Shuffle Packed Single (VEX)" },
+        { "vsqrtpd", "Square Root of Packed Double (VEX)" },
+        { "vsqrtps", "Square Root of Packed Single (VEX)" },
+        { "vsqrtsd", "Square Root of Scalar Double (VEX)" },
+        { "vsqrtss", "Square Root of Scalar Single (VEX)" },
+        { "vsubpd", "Subtract Packed Double (VEX)" },
+        { "vsubps", "Subtract Packed Single (VEX)" },
+        { "vsubsd", "Subtract Scalar Double (VEX)" },
+        { "vsubss", "Subtract Scalar Single (VEX)" },
+        { "vtestpd", "Packed Bit Test Double" },
+        { "vtestps", "Packed Bit Test Single" },
+        { "vucomisd", "Unordered Compare Scalar Double (VEX)" },
+        { "vucomiss", "Unordered Compare Scalar Single (VEX)" },
+        { "vunpckhpd", "Unpack High Packed Double (VEX)" },
+        { "vunpckhps", "Unpack High Packed Single (VEX)" },
+        { "vunpcklpd", "Unpack Low Packed Double (VEX)" },
+        { "vunpcklps", "Unpack Low Packed Single (VEX)" },
+        { "vxorpd", "Bitwise Exclusive Or Packed Double (VEX)" },
+        { "vxorps", "Bitwise Exclusive Or Packed Single (VEX)" },
+        { "vzeroall", "Zero All YMM Registers" },
+        { "vzeroupper", "Zero Upper Bits of YMM Registers" },
+        { "wbinvd", "Write Back and Invalidate Cache" },
+        { "wrmsr", "Write to Model Specific Register" },
+        { "xabort", "Transactional Abort" },
+        { "xadd", "Exchange and Add" },
+        { "xaddb", "Exchange and Add Byte (AT&T)" },
+        { "xaddl", "Exchange and Add Long (AT&T)" },
+        { "xaddq", "Exchange and Add Quad (AT&T)" },
+        { "xaddw", "Exchange and Add Word (AT&T)" },
+        { "xbegin", "Transactional Begin" },
+        { "xchg", "Exchange" },
+        { "xchgb", "Exchange Byte (AT&T)" },
+        { "xchgl", "Exchange Long (AT&T)" },
+        { "xchgq", "Exchange Quad (AT&T)" },
+        { "xchgw", "Exchange Word (AT&T)" },
+        { "xend", "Transactional End" },
+        { "xgetbv", "Get Value of Extended Control Register" },
+        { "xlat", "Table Look-up Translation" },
+        { "xor", "Logical Exclusive Or" },
+        { "xorb", "Logical Exclusive Or Byte (AT&T)" },
+        { "xorl", "Logical Exclusive Or Long (AT&T)" },
+        { "xorpd", "Bitwise Exclusive Or Packed Double" },
+        { "xorps", "Bitwise Exclusive Or Packed Single" },
+        { "xorq", "Logical Exclusive Or Quad (AT&T)" },
+        { "xorw", "Logical Exclusive Or Word (AT&T)" },
+        { "xrstor", "Restore Processor Extended States" },
+        { "xsave", "Save Processor Extended States" },
+        { "xsaveopt", "Save Processor Extended States Optimized" },
+        { "xtest", "Test if in Transactional Execution" },
+    };
+
+    // AArch64 base, floating point and Advanced SIMD instructions.
+    constexpr InstructionSet::Entry aarch64[]
+    {
+        { "abs", "Absolute Value" },
+        { "adc", "Add With Carry" },
+        { "adcs", "Add With Carry, Setting Flags" },
+        { "add", "Add" },
+        { "addg", "Add With Tag" },
+        { "addhn", "Add Returning High Narrow" },
+        { "addp", "Add Pairwise" },
+        { "adds", "Add, Setting Flags" },
+        { "addv", "Add Across Vector" },
+        { "adr", "Form PC-Relative Address" },
+        { "adrp", "Form PC-Relative Address to 4KB Page" },
+        { "aesd", "AES Single Round Decryption" },
+        { "aese", "AES Single Round Encryption" },
+        { "aesimc", "AES Inverse Mix Columns" },
+        { "aesmc", "AES Mix Columns" },
+        { "and", "Bitwise And" },
+        { "ands", "Bitwise And, Setting Flags" },
+        { "asr", "Arithmetic Shift Right" },
+        { "asrv", "Arithmetic Shift Right Variable" },
+        { "at", "Address Translate" },
+        { "autia", "Authenticate Instruction Address, Using Key A" },
+        { "autib", "Authenticate Instruction Address, Using Key B" },
+        { "b", "Branch" },
+        { "b.al", "Branch if Always" },
+        { "b.cc", "Branch if Carry Clear" },
+        { "b.cs", "Branch if Carry Set" },
+        { "b.eq", "Branch if Equal" },
+        { "b.ge", "Branch if Signed Greater Than or Equal" },
+        { "b.gt", "Branch if Signed Greater Than" },
+        { "b.hi", "Branch if Unsigned Higher" },
+        { "b.hs", "Branch if Unsigned Higher or Same" },
+        { "b.le", "Branch if Signed Less Than or Equal" },
+        { "b.lo", "Branch if Unsigned Lower" },
+        { "b.ls", "Branch if Unsigned Lower or Same" },
+        { "b.lt", "Branch if Signed Less Than" },
+        { "b.mi", "Branch if Negative" },
+        { "b.ne", "Branch if Not Equal" },
+        { "b.pl", "Branch if Positive or Zero" },
+        { "b.vc", "Branch if No Overflow" },
+        { "b.vs", "Branch if Overflow" },
+        { "bfc", "Bitfield Clear" },
+        { "bfi", "Bitfield Insert" },
+        { "bfm", "Bitfield Move" },
+        { "bfxil", "Bitfield Extract and Insert Low" },
+        { "bic", "Bitwise Bit Clear" },
+        { "bics", "Bitwise Bit Clear, Setting Flags" },
+        { "bif", "Bitwise Insert if False" },
+        { "bit", "Bitwise Insert if True" },
+        { "bl", "Branch With Link" },
+        { "blr", "Branch With Link to Register" },
+        { "blraa",
+          "Branch With Link to Register, With Pointer Authentication" },
+        { "br", "Branch to Register" },
+        { "brk", "Breakpoint" },
+        { "bsl", "Bitwise Select" },
+        { "bti", "Branch Target Identification" },
+        { "cas", "Compare and Swap Word or Doubleword" },
+        { "casa", "Compare and Swap, Acquire" },
+        { "casal", "Compare and Swap, Acquire and Release" },
+        { "casb", "Compare and Swap Byte" },
+        { "cash", "Compare and Swap Halfword" },
+        { "casl", "Compare and Swap, Release" },
+        { "casp", "Compare and Swap Pair" },
+        { "cbnz", "Compare and Branch on Nonzero" },
+        { "cbz", "Compare and Branch on Zero" },
+        { "ccmn", "Conditional Compare Negative" },
+        { "ccmp", "Conditional Compare" },
+        { "cinc", "Conditional Increment" },
+        { "cinv", "Conditional Invert" },
+        { "clrex", "Clear Exclusive" },
+        { "cls", "Count Leading Sign Bits" },
+        { "clz", "Count Leading Zeros" },
+        { "cmeq", "Compare Bitwise Equal" },
+        { "cmge", "Compare Signed Greater Than or Equal" },
+        { "cmgt", "Compare Signed Greater Than" },
+        { "cmhi", "Compare Unsigned Higher" },
+        { "cmhs", "Compare Unsigned Higher or Same" },
+        { "cmle", "Compare Signed Less Than or Equal to Zero" },
+        { "cmlt", "Compare Signed Less Than Zero" },
+        { "cmn", "Compare Negative" },
+        { "cmp", "Compare" },
+        { "cmtst", "Compare Bitwise Test Bits Nonzero" },
+        { "cneg", "Conditional Negate" },
+        { "cnt", "Population Count per Byte" },
+        { "crc32b", "CRC32 Checksum Byte" },
+        { "crc32cb", "CRC32C Checksum Byte" },
+        { "crc32ch", "CRC32C Checksum Halfword" },
+        { "crc32cw", "CRC32C Checksum Word" },
+        { "crc32cx", "CRC32C Checksum Doubleword" },
+        { "crc32h", "CRC32 Checksum Halfword" },
+        { "crc32w", "CRC32 Checksum Word" },
+        { "crc32x", "CRC32 Checksum Doubleword" },
+        { "csel", "Conditional Select" },
+        { "cset", "Conditional Set" },
+        { "csetm", "Conditional Set Mask" },
+        { "csinc", "Conditional Select Increment" },
+        { "csinv", "Conditional Select Invert" },
+        { "csneg", "Conditional Select Negation" },
+        { "dc", "Data Cache Operation" },
+        { "dmb", "Data Memory Barrier" },
+        { "drps", "Debug Restore Process State" },
+        { "dsb", "Data Synchronization Barrier" },
+        { "dup", "Duplicate Vector Element" },
+        { "eon", "Bitwise Exclusive Or Not" },
+        { "eor", "Bitwise Exclusive Or" },
+        { "eret", "Exception Return" },
+        { "ext", "Extract Vector From Pair of Vectors" },
+        { "extr", "Extract Register" },
+        { "fabd", "Floating Point Absolute Difference" },
+        { "fabs", "Floating Point Absolute Value" },
+        { "facge", "Floating Point Absolute Compare Greater Than or Equal" },
+        { "facgt", "Floating Point Absolute Compare Greater Than" },
+        { "fadd", "Floating Point Add" },
+        { "faddp", "Floating Point Add Pairwise" },
+        { "fccmp", "Floating Point Conditional Quiet Compare" },
+        { "fccmpe", "Floating Point Conditional Signaling Compare" },
+        { "fcmeq", "Floating Point Compare Equal" },
+        { "fcmge", "Floating Point Compare Greater Than or Equal" },
+        { "fcmgt", "Floating Point Compare Greater Than" },
+        { "fcmle", "Floating Point Compare Less Than or Equal to Zero" },
+        { "fcmlt", "Floating Point Compare Less Than Zero" },
+        { "fcmp", "Floating Point Quiet Compare" },
+        { "fcmpe", "Floating Point Signaling Compare" },
+        { "fcsel", "Floating Point Conditional Select" },
+        { "fcvt", "Floating Point Convert Precision" },
+        { "fcvtas",
+          "Floating Point Convert to Signed Integer, Rounding to Nearest "
+          "With Ties Away" },
+        { "fcvtau",
+          "Floating Point Convert to Unsigned Integer, Rounding to Nearest "
+          "With Ties Away" },
+        { "fcvtl", "Floating Point Convert to Higher Precision Long" },
+        { "fcvtms",
+          "Floating Point Convert to Signed Integer, Rounding Toward Minus "
+          "Infinity" },
+        { "fcvtmu",
+          "Floating Point Convert to Unsigned Integer, Rounding Toward Minus "
+          "Infinity" },
+        { "fcvtn", "Floating Point Convert to Lower Precision Narrow" },
+        { "fcvtns",
+          "Floating Point Convert to Signed Integer, Rounding to Nearest "
+          "With Ties to Even" },
+        { "fcvtnu",
+          "Floating Point Convert to Unsigned Integer, Rounding to Nearest "
+          "With Ties to Even" },
+        { "fcvtps",
+          "Floating Point Convert to Signed Integer, Rounding Toward Plus "
+          "Infinity" },
+        { "fcvtpu",
+          "Floating Point Convert to Unsigned Integer, Rounding Toward Plus "
+          "Infinity" },
+        { "fcvtzs",
+          "Floating Point Convert to Signed Integer, Rounding Toward Zero" },
+        { "fcvtzu",
+          "Floating Point Convert to Unsigned Integer, Rounding Toward Zero" },
+        { "fdiv", "Floating Point Divide" },
+        { "fmadd", "Floating Point Fused Multiply-Add" },
+        { "fmax", "Floating Point Maximum" },
+        { "fmaxnm", "Floating Point Maximum Number" },
+        { "fmaxnmp", "Floating Point Maximum Number Pairwise" },
+        { "fmaxnmv", "Floating Point Maximum Number Across Vector" },
+        { "fmaxp", "Floating Point Maximum Pairwise" },
+        { "fmaxv", "Floating Point Maximum Across Vector" },
+        { "fmin", "Floating Point Minimum" },
+        { "fminnm", "Floating Point Minimum Number" },
+        { "fminnmp", "Floating Point Minimum Number Pairwise" },
+        { "fminnmv", "Floating Point Minimum Number Across Vector" },
+        { "fminp", "Floating Point Minimum Pairwise" },
+        { "fminv", "Floating Point Minimum Across Vector" },
+        { "fmla", "Floating Point Fused Multiply-Add to Accumulator" },
+        { "fmls", "Floating Point Fused Multiply-Subtract From Accumulator" },
+        { "fmov", "Floating Point Move" },
+        { "fmsub", "Floating Point Fused Multiply-Subtract" },
+        { "fmul", "Floating Point Multiply" },
+        { "fmulx", "Floating Point Multiply Extended" },
+        { "fneg", "Floating Point Negate" },
+        { "fnmadd", "Floating Point Negated Fused Multiply-Add" },
+        { "fnmsub", "Floating Point Negated Fused Multiply-Subtract" },
+        { "fnmul", "Floating Point Multiply-Negate" },
+        { "frecpe", "Floating Point Reciprocal Estimate" },
+        { "frecps", "Floating Point Reciprocal Step" },
+        { "frinta",
+          "Floating Point Round to Integral, to Nearest With Ties Away" },
+        { "frinti",
+          "Floating Point Round to Integral, Using Current Rounding Mode" },
+        { "frintm", "Floating Point Round to Integral, Toward Minus Infinity" },
+        { "frintn",
+          "Floating Point Round to Integral, to Nearest With Ties to Even" },
+        { "frintp", "Floating Point Round to Integral, Toward Plus Infinity" },
+        { "frintx", "Floating Point Round to Integral Exact" },
+        { "frintz", "Floating Point Round to Integral, Toward Zero" },
+        { "frsqrte", "Floating Point Reciprocal Square Root Estimate" },
+        { "frsqrts", "Floating Point Reciprocal Square Root Step" },
+        { "fsqrt", "Floating Point Square Root" },
+        { "fsub", "Floating Point Subtract" },
+        { "hint", "Hint" },
+        { "hlt", "Halt" },
+        { "hvc", "Hypervisor Call" },
+        { "ic", "Instruction Cache Operation" },
+        { "ins", "Insert Vector Element" },
+        { "isb", "Instruction Synchronization Barrier" },
+        { "ld1", "Load Multiple Single-Element Structures" },
+        { "ld1r", "Load One Single-Element Structure and Replicate" },
+        { "ld2", "Load Multiple 2-Element Structures" },
+        { "ld2r", "Load Single 2-Element Structure and Replicate" },
+        { "ld3", "Load Multiple 3-Element Structures" },
+        { "ld3r", "Load Single 3-Element Structure and Replicate" },
+        { "ld4", "Load Multiple 4-Element Structures" },
+        { "ld4r", "Load Single 4-Element Structure and Replicate" },
+        { "ldadd", "Atomic Add on Word or Doubleword" },
+        { "ldadda", "Atomic Add, Acquire" },
+        { "ldaddal", "Atomic Add, Acquire and Release" },
+        { "ldaddl", "Atomic Add, Release" },
+        { "ldapr", "Load-Acquire RCpc Register" },
+        { "ldar", "Load-Acquire Register" },
+        { "ldarb", "Load-Acquire Register Byte" },
+        { "ldarh", "Load-Acquire Register Halfword" },
+        { "ldaxp", "Load-Acquire Exclusive Pair of Registers" },
+        { "ldaxr", "Load-Acquire Exclusive Register" },
+        { "ldaxrb", "Load-Acquire Exclusive Register Byte" },
+        { "ldaxrh", "Load-Acquire Exclusive Register Halfword" },
+        { "ldclr", "Atomic Bit Clear" },
+        { "ldeor", "Atomic Exclusive Or" },
+        { "ldnp", "Load Pair of Registers, With Non-Temporal Hint" },
+        { "ldp", "Load Pair of Registers" },
+        { "ldpsw", "Load Pair of Registers Signed Word" },
+        { "ldr", "Load Register" },
+        { "ldrb", "Load Register Byte" },
+        { "ldrh", "Load Register Halfword" },
+        { "ldrsb", "Load Register Signed Byte" },
+        { "ldrsh", "Load Register Signed Halfword" },
+        { "ldrsw", "Load Register Signed Word" },
+        { "ldset", "Atomic Bit Set" },
+        { "ldsmax", "Atomic Signed Maximum" },
+        { "ldsmin", "Atomic Signed Minimum" },
+        { "ldtr", "Load Register, Unprivileged" },
+        { "ldumax", "Atomic Unsigned Maximum" },
+        { "ldumin", "Atomic Unsigned Minimum" },
+        { "ldur", "Load Register, Unscaled" },
+        { "ldurb", "Load Register Byte, Unscaled" },
+        { "ldurh", "Load Register Halfword, Unscaled" },
+        { "ldursb", "Load Register Signed Byte, Unscaled" },
+        { "ldursh", "Load Register Signed Halfword, Unscaled" },
+        { "ldursw", "Load Register Signed Word, Unscaled" },
+        { "ldxp", "Load Exclusive Pair of Registers" },
+        { "ldxr", "Load Exclusive Register" },
+        { "ldxrb", "Load Exclusive Register Byte" },
+        { "ldxrh", "Load Exclusive Register Halfword" },
+        { "lsl", "Logical Shift Left" },
+        { "lslv", "Logical Shift Left Variable" },
+        { "lsr", "Logical Shift Right" },
+        { "lsrv", "Logical Shift Right Variable" },
+        { "madd", "Multiply-Add" },
+        { "mla", "Multiply-Add to Accumulator" },
+        { "mls", "Multiply-Subtract From Accumulator" },
+        { "mneg", "Multiply-Negate" },
+        { "mov", "Move" },
+        { "movi", "Move Immediate" },
+        { "movk", "Move Wide With Keep" },
+        { "movn", "Move Wide With Not" },
+        { "movz", "Move Wide With Zero" },
+        { "mrs", "Move System Register to Register" },
+        { "msr", "Move Register to System Register" },
+        { "msub", "Multiply-Subtract" },
+        { "mul", "Multiply" },
+        { "mvn", "Bitwise Not" },
+        { "mvni", "Move Inverted Immediate" },
+        { "neg", "Negate" },
+        { "negs", "Negate, Setting Flags" },
+        { "ngc", "Negate With Carry" },
+        { "ngcs", "Negate With Carry, Setting Flags" },
+        { "nop", "No Operation" },
+        { "not", "Bitwise Not" },
+        { "orn", "Bitwise Or Not" },
+        { "orr", "Bitwise Or" },
+        { "pacia",
+          "Pointer Authentication Code for Instruction Address, Using Key A" },
+        { "paciasp",
+          "Pointer Authentication Code for the Link Register, Using Key A "
+          "and SP" },
+        { "pacibsp",
+          "Pointer Authentication Code for the Link Register, Using Key B "
+          "and SP" },
+        { "pmul", "Polynomial Multiply" },
+        { "pmull", "Polynomial Multiply Long" },
+        { "pmull2", "Polynomial Multiply Long (Upper Half)" },
+        { "prfm", "Prefetch Memory" },
+        { "raddhn", "Rounding Add Returning High Narrow" },
+        { "rbit", "Reverse Bits" },
+        { "ret", "Return From Subroutine" },
+        { "retaa", "Return From Subroutine, With Pointer Authentication" },
+        { "rev", "Reverse Bytes" },
+        { "rev16", "Reverse Bytes in Halfwords" },
+        { "rev32", "Reverse Bytes in Words" },
+        { "ror", "Rotate Right" },
+        { "rorv", "Rotate Right Variable" },
+        { "rshrn", "Rounding Shift Right Narrow" },
+        { "rsubhn", "Rounding Subtract Returning High Narrow" },
+        { "saba", "Signed Absolute Difference and Accumulate" },
+        { "sabal", "Signed Absolute Difference and Accumulate Long" },
+        { "sabd", "Signed Absolute Difference" },
+        { "sabdl", "Signed Absolute Difference Long" },
+        { "sadalp", "Signed Add and Accumulate Long Pairwise" },
+        { "saddl", "Signed Add Long" },
+        { "saddlp", "Signed Add Long Pairwise" },
+        { "saddlv", "Signed Add Long Across Vector" },
+        { "saddw", "Signed Add Wide" },
+        { "sbc", "Subtract With Carry" },
+        { "sbcs", "Subtract With Carry, Setting Flags" },
+        { "sbfiz", "Signed Bitfield Insert in Zeros" },
+        { "sbfm", "Signed Bitfield Move" },
+        { "sbfx", "Signed Bitfield Extract" },
+        { "scvtf", "Signed Integer Convert to Floating Point" },
+        { "sdiv", "Signed Divide" },
+        { "sev", "Send Event" },
+        { "sevl", "Send Event Local" },
+        { "sha1c", "SHA1 Hash Update (Choose)" },
+        { "sha1h", "SHA1 Fixed Rotate" },
+        { "sha1m", "SHA1 Hash Update (Majority)" },
+        { "sha1p", "SHA1 Hash Update (Parity)" },
+        { "sha1su0", "SHA1 Schedule Update 0" },
+        { "sha1su1", "SHA1 Schedule Update 1" },
+        { "sha256h", "SHA256 Hash Update (Part 1)" },
+        { "sha256h2", "SHA256 Hash Update (Part 2)" },
+        { "sha256su0", "SHA256 Schedule Update 0" },
+        { "sha256su1", "SHA256 Schedule Update 1" },
+        { "shadd", "Signed Halving Add" },
+        { "shl", "Shift Left" },
+        { "shll", "Shift Left Long" },
+        { "shrn", "Shift Right Narrow" },
+        { "shsub", "Signed Halving Subtract" },
+        { "sli", "Shift Left and Insert" },
+        { "smaddl", "Signed Multiply-Add Long" },
+        { "smax", "Signed Maximum" },
+        { "smaxp", "Signed Maximum Pairwise" },
+        { "smaxv", "Signed Maximum Across Vector" },
+        { "smc", "Secure Monitor Call" },
+        { "smin", "Signed Minimum" },
+        { "sminp", "Signed Minimum Pairwise" },
+        { "sminv", "Signed Minimum Across Vector" },
+        { "smlal", "Signed Multiply-Add Long" },
+        { "smlsl", "Signed Multiply-Subtract Long" },
+        { "smnegl", "Signed Multiply-Negate Long" },
+        { "smov", "Signed Move Vector Element to General Register" },
+        { "smsubl", "Signed Multiply-Subtract Long" },
+        { "smulh", "Signed Multiply High" },
+        { "smull", "Signed Multiply Long" },
+        { "sqabs", "Signed Saturating Absolute Value" },
+        { "sqadd", "Signed Saturating Add" },
+        { "sqdmulh",
+          "Signed Saturating Doubling Multiply Returning High Half" },
+        { "sqdmull", "Signed Saturating Doubling Multiply Long" },
+        { "sqneg", "Signed Saturating Negate" },
+        { "sqrdmulh",
+          "Signed Saturating Rounding Doubling Multiply Returning High Half" },
+        { "sqrshl", "Signed Saturating Rounding Shift Left" },
+        { "sqrshrn", "Signed Saturating Rounded Shift Right Narrow" },
+        { "sqshl", "Signed Saturating Shift Left" },
+        { "sqshrn", "Signed Saturating Shift Right Narrow" },
+        { "sqshrun", "Signed Saturating Shift Right Unsigned Narrow" },
+        { "sqsub", "Signed Saturating Subtract" },
+        { "sqxtn", "Signed Saturating Extract Narrow" },
+        { "sqxtun", "Signed Saturating Extract Unsigned Narrow" },
+        { "srhadd", "Signed Rounding Halving Add" },
+        { "sri", "Shift Right and Insert" },
+        { "srshl", "Signed Rounding Shift Left" },
+        { "srshr", "Signed Rounding Shift Right" },
+        { "srsra", "Signed Rounding Shift Right and Accumulate" },
+        { "sshl", "Signed Shift Left" },
+        { "sshll", "Signed Shift Left Long" },
+        { "sshr", "Signed Shift Right" },
+        { "ssra", "Signed Shift Right and Accumulate" },
+        { "ssubl", "Signed Subtract Long" },
+        { "ssubw", "Signed Subtract Wide" },
+        { "st1", "Store Multiple Single-Element Structures" },
+        { "st2", "Store Multiple 2-Element Structures" },
+        { "st3", "Store Multiple 3-Element Structures" },
+        { "st4", "Store Multiple 4-Element Structures" },
+        { "stadd", "Atomic Add Without Return" },
+        { "stclr", "Atomic Bit Clear Without Return" },
+        { "steor", "Atomic Exclusive Or Without Return" },
+        { "stlr", "Store-Release Register" },
+        { "stlrb", "Store-Release Register Byte" },
+        { "stlrh", "Store-Release Register Halfword" },
+        { "stlxp", "Store-Release Exclusive Pair of Registers" },
+        { "stlxr", "Store-Release Exclusive Register" },
+        { "stlxrb", "Store-Release Exclusive Register Byte" },
+        { "stlxrh", "Store-Release Exclusive Register Halfword" },
+        { "stnp", "Store Pair of Registers, With Non-Temporal Hint" },
+        { "stp", "Store Pair of Registers" },
+        { "str", "Store Register" },
+        { "strb", "Store Register Byte" },
+        { "strh", "Store Register Halfword" },
+        { "stset", "Atomic Bit Set Without Return" },
+        { "sttr", "Store Register, Unprivileged" },
+        { "stur", "Store Register, Unscaled" },
+        { "sturb", "Store Register Byte, Unscaled" },
+        { "sturh", "Store Register Halfword, Unscaled" },
+        { "stxp", "Store Exclusive Pair of Registers" },
+        { "stxr", "Store Exclusive Register" },
+        { "stxrb", "Store Exclusive Register Byte" },
+        { "stxrh", "Store Exclusive Register Halfword" },
+        { "sub", "Subtract" },
+        { "subhn", "Subtract Returning High Narrow" },
+        { "subs", "Subtract, Setting Flags" },
+        { "suqadd", "Signed Saturating Accumulate of Unsigned Value" },
+        { "svc", "Supervisor Call" },
+        { "swp", "Swap Word or Doubleword" },
+        { "swpa", "Swap, Acquire" },
+        { "swpal", "Swap, Acquire and Release" },
+        { "swpl", "Swap, Release" },
+        { "sxtb", "Signed Extend Byte" },
+        { "sxth", "Signed Extend Halfword" },
+        { "sxtl", "Signed Extend Long" },
+        { "sxtw", "Signed Extend Word" },
+        { "sys", "System Instruction" },
+        { "sysl", "System Instruction With Result" },
+        { "tbl", "Table Vector Lookup" },
+        { "tbnz", "Test Bit and Branch if Nonzero" },
+        { "tbx", "Table Vector Lookup Extension" },
+        { "tbz", "Test Bit and Branch if Zero" },
+        { "tlbi", "TLB Invalidate Operation" },
+        { "trn1", "Transpose Vectors (Primary)" },
+        { "trn2", "Transpose Vectors (Secondary)" },
+        { "tst", "Test Bits" },
+        { "uaba", "Unsigned Absolute Difference and Accumulate" },
+        { "uabal", "Unsigned Absolute Difference and Accumulate Long" },
+        { "uabd", "Unsigned Absolute Difference" },
+        { "uabdl", "Unsigned Absolute Difference Long" },
+        { "uadalp", "Unsigned Add and Accumulate Long Pairwise" },
+        { "uaddl", "Unsigned Add Long" },
+        { "uaddlp", "Unsigned Add Long Pairwise" },
+        { "uaddlv", "Unsigned Add Long Across Vector" },
+        { "uaddw", "Unsigned Add Wide" },
+        { "ubfiz", "Unsigned Bitfield Insert in Zeros" },
+        { "ubfm", "Unsigned Bitfield Move" },
+        { "ubfx", "Unsigned Bitfield Extract" },
+        { "ucvtf", "Unsigned Integer Convert to Floating Point" },
+        { "udf", "Permanently Undefined" },
+        { "udiv", "Unsigned Divide" },
+        { "uhadd", "Unsigned Halving Add" },
+        { "uhsub", "Unsigned Halving Subtract" },
+        { "umaddl", "Unsigned Multiply-Add Long" },
+        { "umax", "Unsigned Maximum" },
+        { "umaxp", "Unsigned Maximum Pairwise" },
+        { "umaxv", "Unsigned Maximum Across Vector" },
+        { "umin", "Unsigned Minimum" },
+        { "uminp", "Unsigned Minimum Pairwise" },
+        { "uminv", "Unsigned Minimum Across Vector" },
+        { "umlal", "Unsigned Multiply-Add Long" },
+        { "umlsl", "Unsigned Multiply-Subtract Long" },
+        { "umnegl", "Unsigned Multiply-Negate Long" },
+        { "umov", "Unsigned Move Vector Element to General Register" },
+        { "umsubl", "Unsigned Multiply-Subtract Long" },
+        { "umulh", "Unsigned Multiply High" },
+        { "umull", "Unsigned Multiply Long" },
+        { "uqadd", "Unsigned Saturating Add" },
+        { "uqrshl", "Unsigned Saturating Rounding Shift Left" },
+        { "uqrshrn", "Unsigned Saturating Rounded Shift Right Narrow" },
+        { "uqshl", "Unsigned Saturating Shift Left" },
+        { "uqshrn", "Unsigned Saturating Shift Right Narrow" },
+        { "uqsub", "Unsigned Saturating Subtract" },
+        { "uqxtn", "Unsigned Saturating Extract Narrow" },
+        { "urecpe", "Unsigned Reciprocal Estimate" },
+        { "urhadd", "Unsigned Rounding Halving Add" },
+        { "urshl", "Unsigned Rounding Shift Left" },
+        { "urshr", "Unsigned Rounding Shift Right" },
+        { "ursqrte", "Unsigned Reciprocal Square Root Estimate" },
+        { "ursra", "Unsigned Rounding Shift Right and Accumulate" },
+        { "ushl", "Unsigned Shift Left" },
+        { "ushll", "Unsigned Shift Left Long" },
+        { "ushr", "Unsigned Shift Right" },
+        { "usqadd", "Unsigned Saturating Accumulate of Signed Value" },
+        { "usra", "Unsigned Shift Right and Accumulate" },
+        { "usubl", "Unsigned Subtract Long" },
+        { "usubw", "Unsigned Subtract Wide" },
+        { "uxtb", "Unsigned Extend Byte" },
+        { "uxth", "Unsigned Extend Halfword" },
+        { "uxtl", "Unsigned Extend Long" },
+        { "uzp1", "Unzip Vectors (Primary)" },
+        { "uzp2", "Unzip Vectors (Secondary)" },
+        { "wfe", "Wait for Event" },
+        { "wfi", "Wait for Interrupt" },
+        { "xpaclri", "Strip Pointer Authentication Code" },
+        { "xtn", "Extract Narrow" },
+        { "yield", "Yield" },
+        { "zip1", "Zip Vectors (Primary)" },
+        { "zip2", "Zip Vectors (Secondary)" },
+    };
+
+    // RV64GC with the Zba and Zbb extensions and the standard
+    // pseudoinstructions.
+    constexpr InstructionSet::Entry riscv[]
+    {
+        { "add", "Add" },
+        { "add.uw", "Add Unsigned Word" },
+        { "addi", "Add Immediate" },
+        { "addiw", "Add Word Immediate" },
+        { "addw", "Add Word" },
+        { "amoadd.d", "Atomic Add Doubleword" },
+        { "amoadd.w", "Atomic Add Word" },
+        { "amoand.d", "Atomic And Doubleword" },
+        { "amoand.w", "Atomic And Word" },
+        { "amomax.d", "Atomic Maximum Doubleword" },
+        { "amomax.w", "Atomic Maximum Word" },
+        { "amomaxu.d", "Atomic Maximum Unsigned Doubleword" },
+        { "amomaxu.w", "Atomic Maximum Unsigned Word" },
+        { "amomin.d", "Atomic Minimum Doubleword" },
+        { "amomin.w", "Atomic Minimum Word" },
+        { "amominu.d", "Atomic Minimum Unsigned Doubleword" },
+        { "amominu.w", "Atomic Minimum Unsigned Word" },
+        { "amoor.d", "Atomic Or Doubleword" },
+        { "amoor.w", "Atomic Or Word" },
+        { "amoswap.d", "Atomic Swap Doubleword" },
+        { "amoswap.w", "Atomic Swap Word" },
+        { "amoxor.d", "Atomic Exclusive Or Doubleword" },
+        { "amoxor.w", "Atomic Exclusive Or Word" },
+        { "and", "And" },
+        { "andi", "And Immediate" },
+        { "andn", "And Inverted" },
+        { "auipc", "Add Upper Immediate to PC" },
+        { "beq", "Branch if Equal" },
+        { "beqz", "Branch if Equal to Zero (Pseudo)" },
+        { "bge", "Branch if Greater Than or Equal" },
+        { "bgeu", "Branch if Greater Than or Equal Unsigned" },
+        { "bgez", "Branch if Greater Than or Equal to Zero (Pseudo)" },
+        { "bgt", "Branch if Greater Than (Pseudo)" },
+        { "bgtu", "Branch if Greater Than Unsigned (Pseudo)" },
+        { "bgtz", "Branch if Greater Than Zero (Pseudo)" },
+        { "ble", "Branch if Less Than or Equal (Pseudo)" },
+        { "bleu", "Branch if Less Than or Equal Unsigned (Pseudo)" },
+        { "blez", "Branch if Less Than or Equal to Zero (Pseudo)" },
+        { "blt", "Branch if Less Than" },
+        { "bltu", "Branch if Less Than Unsigned" },
+        { "bltz", "Branch if Less Than Zero (Pseudo)" },
+        { "bne", "Branch if Not Equal" },
+        { "bnez", "Branch if Not Equal to Zero (Pseudo)" },
+        { "c.add", "Compressed Add" },
+        { "c.addi", "Compressed Add Immediate" },
+        { "c.addi16sp",
+          "Compressed Add Immediate, Scaled by 16, to Stack Pointer" },
+        { "c.addi4spn",
+          "Compressed Add Immediate, Scaled by 4, to Stack Pointer, Nonzero" },
+        { "c.addiw", "Compressed Add Word Immediate" },
+        { "c.addw", "Compressed Add Word" },
+        { "c.and", "Compressed And" },
+        { "c.andi", "Compressed And Immediate" },
+        { "c.beqz", "Compressed Branch if Equal to Zero" },
+        { "c.bnez", "Compressed Branch if Not Equal to Zero" },
+        { "c.ebreak", "Compressed Environment Breakpoint" },
+        { "c.fld", "Compressed Floating Point Load Double" },
+        { "c.fldsp",
+          "Compressed Floating Point Load Double, Stack-Pointer Based" },
+        { "c.fsd", "Compressed Floating Point Store Double" },
+        { "c.fsdsp",
+          "Compressed Floating Point Store Double, Stack-Pointer Based" },
+        { "c.j", "Compressed Jump" },
+        { "c.jalr", "Compressed Jump and Link Register" },
+        { "c.jr", "Compressed Jump Register" },
+        { "c.ld", "Compressed Load Doubleword" },
+        { "c.ldsp", "Compressed Load Doubleword, Stack-Pointer Based" },
+        { "c.li", "Compressed Load Immediate" },
+        { "c.lui", "Compressed Load Upper Immediate" },
+        { "c.lw", "Compressed Load Word" },
+        { "c.lwsp", "Compressed Load Word, Stack-Pointer Based" },
+        { "c.mv", "Compressed Move" },
+        { "c.nop", "Compressed No Operation" },
+        { "c.or", "Compressed Or" },
+        { "c.sd", "Compressed Store Doubleword" },
+        { "c.sdsp", "Compressed Store Doubleword, Stack-Pointer Based" },
+        { "c.slli", "Compressed Shift Left Logical Immediate" },
+        { "c.srai", "Compressed Shift Right Arithmetic Immediate" },
+        { "c.srli", "Compressed Shift Right Logical Immediate" },
+        { "c.sub", "Compressed Subtract" },
+        { "c.subw", "Compressed Subtract Word" },
+        { "c.sw", "Compressed Store Word" },
+        { "c.swsp", "Compressed Store Word, Stack-Pointer Based" },
+        { "c.xor", "Compressed Exclusive Or" },
+        { "call", "Call Far-Away Subroutine (Pseudo)" },
+        { "clz", "Count Leading Zeros" },
+        { "cpop", "Count Set Bits" },
+        { "csrc", "Clear Bits in CSR (Pseudo)" },
+        { "csrci", "Clear Bits in CSR Immediate (Pseudo)" },
+        { "csrr", "Read CSR (Pseudo)" },
+        { "csrrc", "Atomic Read and Clear Bits in CSR" },
+        { "csrrci", "Atomic Read and Clear Bits in CSR Immediate" },
+        { "csrrs", "Atomic Read and Set Bits in CSR" },
+        { "csrrsi", "Atomic Read and Set Bits in CSR Immediate" },
+        { "csrrw", "Atomic Read/Write CSR" },
+        { "csrrwi", "Atomic Read/Write CSR Immediate" },
+        { "csrs", "Set Bits in CSR (Pseudo)" },
+        { "csrsi", "Set Bits in CSR Immediate (Pseudo)" },
+        { "csrw", "Write CSR (Pseudo)" },
+        { "csrwi", "Write CSR Immediate (Pseudo)" },
+        { "ctz", "Count Trailing Zeros" },
+        { "div", "Divide" },
+        { "divu", "Divide Unsigned" },
+        { "divuw", "Divide Word Unsigned" },
+        { "divw", "Divide Word" },
+        { "ebreak", "Environment Breakpoint" },
+        { "ecall", "Environment Call" },
+        { "fabs.d", "Double-Precision Absolute Value (Pseudo)" },
+        { "fabs.s", "Single-Precision Absolute Value (Pseudo)" },
+        { "fadd.d", "Double-Precision Add" },
+        { "fadd.s", "Single-Precision Add" },
+        { "fclass.d", "Double-Precision Classify" },
+        { "fclass.s", "Single-Precision Classify" },
+        { "fcvt.d.l", "Convert Long to Double-Precision" },
+        { "fcvt.d.lu", "Convert Unsigned Long to Double-Precision" },
+        { "fcvt.d.s", "Convert Single-Precision to Double-Precision" },
+        { "fcvt.d.w", "Convert Word to Double-Precision" },
+        { "fcvt.d.wu", "Convert Unsigned Word to Double-Precision" },
+        { "fcvt.l.d", "Convert Double-Precision to Long" },
+        { "fcvt.l.s", "Convert Single-Precision to Long" },
+        { "fcvt.lu.d", "Convert Double-Precision to Unsigned Long" },
+        { "fcvt.lu.s", "Convert Single-Precision to Unsigned Long" },
+        { "fcvt.s.d", "Convert Double-Precision to Single-Precision" },
+        { "fcvt.s.l", "Convert Long to Single-Precision" },
+        { "fcvt.s.lu", "Convert Unsigned Long to Single-Precision" },
+        { "fcvt.s.w", "Convert Word to Single-Precision" },
+        { "fcvt.s.wu", "Convert Unsigned Word to Single-Precision" },
+        { "fcvt.w.d", "Convert Double-Precision to Word" },
+        { "fcvt.w.s", "Convert Single-Precision to Word" },
+        { "fcvt.wu.d", "Convert Double-Precision to Unsigned Word" },
+        { "fcvt.wu.s", "Convert Single-Precision to Unsigned Word" },
+        { "fdiv.d", "Double-Precision Divide" },
+        { "fdiv.s", "Single-Precision Divide" },
+        { "fence", "Fence Memory and I/O" },
+        { "fence.i", "Fence Instruction Stream" },
+        { "feq.d", "Double-Precision Equal" },
+        { "feq.s", "Single-Precision Equal" },
+        { "fld", "Floating Point Load Doubleword" },
+        { "fle.d", "Double-Precision Less Than or Equal" },
+        { "fle.s", "Single-Precision Less Than or Equal" },
+        { "flt.d", "Double-Precision Less Than" },
+        { "flt.s", "Single-Precision Less Than" },
+        { "flw", "Floating Point Load Word" },
+        { "fmadd.d", "Double-Precision Fused Multiply-Add" },
+        { "fmadd.s", "Single-Precision Fused Multiply-Add" },
+        { "fmax.d", "Double-Precision Maximum" },
+        { "fmax.s", "Single-Precision Maximum" },
+        { "fmin.d", "Double-Precision Minimum" },
+        { "fmin.s", "Single-Precision Minimum" },
+        { "fmsub.d", "Double-Precision Fused Multiply-Subtract" },
+        { "fmsub.s", "Single-Precision Fused Multiply-Subtract" },
+        { "fmul.d", "Double-Precision Multiply" },
+        { "fmul.s", "Single-Precision Multiply" },
+        { "fmv.d", "Copy Double-Precision Register (Pseudo)" },
+        { "fmv.d.x", "Move Integer to Double-Precision" },
+        { "fmv.s", "Copy Single-Precision Register (Pseudo)" },
+        { "fmv.w.x", "Move Integer to Single-Precision" },
+        { "fmv.x.d", "Move Double-Precision to Integer" },
+        { "fmv.x.w", "Move Single-Precision to Integer" },
+        { "fneg.d", "Double-Precision Negate (Pseudo)" },
+        { "fneg.s", "Single-Precision Negate (Pseudo)" },
+        { "fnmadd.d", "Double-Precision Negated Fused Multiply-Add" },
+        { "fnmadd.s", "Single-Precision Negated Fused Multiply-Add" },
+        { "fnmsub.d", "Double-Precision Negated Fused Multiply-Subtract" },
+        { "fnmsub.s", "Single-Precision Negated Fused Multiply-Subtract" },
+        { "frcsr", "Read Floating Point Control and Status Register (Pseudo)" },
+        { "frflags", "Read Floating Point Exception Flags (Pseudo)" },
+        { "frrm", "Read Floating Point Rounding Mode (Pseudo)" },
+        { "fscsr", "Swap Floating Point Control and Status Register (Pseudo)" },
+        { "fsd", "Floating Point Store Doubleword" },
+        { "fsflags", "Swap Floating Point Exception Flags (Pseudo)" },
+        { "fsgnj.d", "Double-Precision Sign Inject" },
+        { "fsgnj.s", "Single-Precision Sign Inject" },
+        { "fsgnjn.d", "Double-Precision Sign Inject Negated" },
+        { "fsgnjn.s", "Single-Precision Sign Inject Negated" },
+        { "fsgnjx.d", "Double-Precision Sign Inject Exclusive Or" },
+        { "fsgnjx.s", "Single-Precision Sign Inject Exclusive Or" },
+        { "fsqrt.d", "Double-Precision Square Root" },
+        { "fsqrt.s", "Single-Precision Square Root" },
+        { "fsrm", "Swap Floating Point Rounding Mode (Pseudo)" },
+        { "fsub.d", "Double-Precision Subtract" },
+        { "fsub.s", "Single-Precision Subtract" },
+        { "fsw", "Floating Point Store Word" },
+        { "j", "Jump (Pseudo)" },
+        { "jal", "Jump and Link" },
+        { "jalr", "Jump and Link Register" },
+        { "jr", "Jump Register (Pseudo)" },
+        { "la", "Load Address (Pseudo)" },
+        { "lb", "Load Byte" },
+        { "lbu", "Load Byte Unsigned" },
+        { "ld", "Load Doubleword" },
+        { "lh", "Load Halfword" },
+        { "lhu", "Load Halfword Unsigned" },
+        { "li", "Load Immediate (Pseudo)" },
+        { "lla", "Load Local Address (Pseudo)" },
+        { "lr.d", "Load-Reserved Doubleword" },
+        { "lr.w", "Load-Reserved Word" },
+        { "lui", "Load Upper Immediate" },
+        { "lw", "Load Word" },
+        { "lwu", "Load Word Unsigned" },
+        { "max", "Maximum" },
+        { "maxu", "Maximum Unsigned" },
+        { "min", "Minimum" },
+        { "minu", "Minimum Unsigned" },
+        { "mret", "Machine-Mode Trap Return" },
+        { "mul", "Multiply" },
+        { "mulh", "Multiply High Signed" },
+        { "mulhsu", "Multiply High Signed-Unsigned" },
+        { "mulhu", "Multiply High Unsigned" },
+        { "mulw", "Multiply Word" },
+        { "mv", "Copy Register (Pseudo)" },
+        { "neg", "Two's Complement (Pseudo)" },
+        { "negw", "Two's Complement Word (Pseudo)" },
+        { "nop", "No Operation (Pseudo)" },
+        { "not", "One's Complement (Pseudo)" },
+        { "or", "Or" },
+        { "orc.b", "Bitwise Or-Combine Byte" },
+        { "ori", "Or Immediate" },
+        { "orn", "Or Inverted" },
+        { "rem", "Remainder" },
+        { "remu", "Remainder Unsigned" },
+        { "remuw", "Remainder Word Unsigned" },
+        { "remw", "Remainder Word" },
+        { "ret", "Return From Subroutine (Pseudo)" },
+        { "rev8", "Byte Reverse" },
+        { "rol", "Rotate Left" },
+        { "ror", "Rotate Right" },
+        { "rori", "Rotate Right Immediate" },
+        { "sb", "Store Byte" },
+        { "sc.d", "Store-Conditional Doubleword" },
+        { "sc.w", "Store-Conditional Word" },
+        { "sd", "Store Doubleword" },
+        { "seqz", "Set if Equal to Zero (Pseudo)" },
+        { "sext.b", "Sign Extend Byte" },
+        { "sext.h", "Sign Extend Halfword" },
+        { "sext.w", "Sign Extend Word (Pseudo)" },
+        { "sfence.vma", "Supervisor Memory-Management Fence" },
+        { "sgtz", "Set if Greater Than Zero (Pseudo)" },
+        { "sh", "Store Halfword" },
+        { "sh1add", "Shift Left by 1 and Add" },
+        { "sh2add", "Shift Left by 2 and Add" },
+        { "sh3add", "Shift Left by 3 and Add" },
+        { "sll", "Shift Left Logical" },
+        { "slli", "Shift Left Logical Immediate" },
+        { "slliw", "Shift Left Logical Word Immediate" },
+        { "sllw", "Shift Left Logical Word" },
+        { "slt", "Set if Less Than" },
+        { "slti", "Set if Less Than Immediate" },
+        { "sltiu", "Set if Less Than Immediate Unsigned" },
+        { "sltu", "Set if Less Than Unsigned" },
+        { "sltz", "Set if Less Than Zero (Pseudo)" },
+        { "snez", "Set if Not Equal to Zero (Pseudo)" },
+        { "sra", "Shift Right Arithmetic" },
+        { "srai", "Shift Right Arithmetic Immediate" },
+        { "sraiw", "Shift Right Arithmetic Word Immediate" },
+        { "sraw", "Shift Right Arithmetic Word" },
+        { "sret", "Supervisor-Mode Trap Return" },
+        { "srl", "Shift Right Logical" },
+        { "srli", "Shift Right Logical Immediate" },
+        { "srliw", "Shift Right Logical Word Immediate" },
+        { "srlw", "Shift Right Logical Word" },
+        { "sub", "Subtract" },
+        { "subw", "Subtract Word" },
+        { "sw", "Store Word" },
+        { "tail", "Tail Call Far-Away Subroutine (Pseudo)" },
+        { "wfi", "Wait for Interrupt" },
+        { "xnor", "Exclusive Nor" },
+        { "xor", "Exclusive Or" },
+        { "xori", "Exclusive Or Immediate" },
+        { "zext.b", "Zero Extend Byte (Pseudo)" },
+        { "zext.h", "Zero Extend Halfword" },
+    };
+
+    /// @brief Compares two mnemonics byte by byte, the same as strcmp.
+    constexpr bool Less(const char* left, const char* right)
+    {
+        while (*left != '\0' && *left == *right)
+        {
+            left++;
+            right++;
+        }
+
+        return static_cast<unsigned char>(*left) <
+            static_cast<unsigned char>(*right);
+    }
+
+    /// @brief Determines if a table is sorted by mnemonic with no mnemonic
+    /// in it twice.
+    template <std::size_t N>
+    constexpr bool IsSorted(const InstructionSet::Entry (&table)[N])
+    {
+        for (std::size_t i = 1; i < N; i++)
+        {
+            if (!Less(table[i - 1].mnemonic, table[i].mnemonic))
+                return false;
+        }
+
+        return true;
+    }
+
+    static_assert(IsSorted(mips1), "mips1 must be sorted and unique");
+    static_assert(IsSorted(mips2), "mips2 must be sorted and unique");
+    static_assert(IsSorted(mips3), "mips3 must be sorted and unique");
+    static_assert(IsSorted(mips4), "mips4 must be sorted and unique");
+    static_assert(IsSorted(x86_64), "x86_64 must be sorted and unique");
+    static_assert(IsSorted(aarch64), "aarch64 must be sorted and unique");
+    static_assert(IsSorted(riscv), "riscv must be sorted and unique");
+
+    template <std::size_t N>
+    Span<InstructionSet::Entry> TableOf(
+        const InstructionSet::Entry (&table)[N])
+    {
+        return Span<InstructionSet::Entry>{ table, N };
+    }
+}
+
+std::optional<InstructionSet> InstructionSet::FromName(const wxString& name)
+{
+    for (Kind candidate : kinds)
+    {
+        InstructionSet instructionSet{ candidate };
+
+        if (name.Lower() == wxString{ instructionSet.Name() })
+            return instructionSet;
+    }
+
+    return std::nullopt;
+}
+
+const char* InstructionSet::Name() const
+{
+    switch (kind)
+    {
+    case Kind::Mips1:
+        return "mips1";
+    case Kind::Mips2:
+        return "mips2";
+    case Kind::Mips3:
+        return "mips3";
+    case Kind::Mips4:
+        return "mips4";
+    case Kind::X86_64:
+        return "x86-64";
+    case Kind::AArch64:
+        return "aarch64";
+    default:
+        return "riscv";
+    }
+}
+
+const char* InstructionSet::Label() const
+{
+    switch (kind)
+    {
+    case Kind::Mips1:
+        return "MIPS I";
+    case Kind::Mips2:
+        return "MIPS II";
+    case Kind::Mips3:
+        return "MIPS III";
+    case Kind::Mips4:
+        return "MIPS IV";
+    case Kind::X86_64:
+        return "x86-64";
+    case Kind::AArch64:
+        return "AArch64";
+    default:
+        return "RISC-V (RV64GC)";
+    }
+}
+
+std::vector<InstructionSet::Entry> InstructionSet::Entries() const
+{
+    std::vector<Span<Entry>> tables;
+
+    switch (kind)
+    {
+    case Kind::Mips4:
+        tables.push_back(TableOf(mips4));
+        [[fallthrough]];
+    case Kind::Mips3:
+        tables.push_back(TableOf(mips3));
+        [[fallthrough]];
+    case Kind::Mips2:
+        tables.push_back(TableOf(mips2));
+        [[fallthrough]];
+    case Kind::Mips1:
+        tables.push_back(TableOf(mips1));
+        break;
+    case Kind::X86_64:
+        tables.push_back(TableOf(x86_64));
+        break;
+    case Kind::AArch64:
+        tables.push_back(TableOf(aarch64));
+        break;
+    case Kind::RiscV:
+        tables.push_back(TableOf(riscv));
+        break;
+    }
+
+    // Each MIPS level only lists what it added, so the levels are merged
+    // to keep the whole set sorted.
+    auto less = [](const Entry& left, const Entry& right) {
+        return Less(left.mnemonic, right.mnemonic);
+    };
+
+    std::vector<Entry> entries;
+
+    for (Span<Entry> table : tables)
+    {
+        std::vector<Entry> merged;
+        merged.reserve(entries.size() + table.size());
+        std::merge(entries.begin(), entries.end(), table.begin(), table.end(),
+                   std::back_inserter(merged), less);
+        entries.swap(merged);
+    }
+
+    return entries;
+}
+
+std::vector<Instruction> InstructionSet::Instructions() const
+{
+    std::vector<Entry> entries = Entries();
+    std::vector<Instruction> instructions;
+    instructions.reserve(entries.size());
+
+    for (const Entry& entry : entries)
+    {
+        instructions.push_back(Instruction{ wxString{ entry.mnemonic },
+                                            wxString{ entry.description } });
+    }
+
+    return instructions;
+}
@@ -0,0 +1,95 @@
+// InstructionSet.h - Declares the InstructionSet class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INSTRUCTION_SET_H
+#define INSTRUCTION_SET_H
+
+#include <optional>
+#include <vector>
+#include <wx/string.h>
+#include "Instruction.h"
+
+/// @brief A ready-made list of the mnemonics of an instruction set
+/// architecture.
+///
+/// The lists are compiled into the program as tables sorted by mnemonic,
+/// which is checked while compiling, so adding a whole instruction set
+/// reads no file and parses nothing. Each MIPS level includes the levels
+/// before it.
+class InstructionSet
+{
+public:
+    /// @brief Identifies an instruction set.
+    enum class Kind
+    {
+        Mips1,
+        Mips2,
+        Mips3,
+        Mips4,
+        X86_64,
+        AArch64,
+        RiscV
+    };
+
+    /// @brief Every instruction set, in the order they are offered to the
+    /// user.
+    static constexpr Kind kinds[]{ Kind::Mips1, Kind::Mips2, Kind::Mips3,
+                                   Kind::Mips4, Kind::X86_64, Kind::AArch64,
+                                   Kind::RiscV };
+
+    /// @brief A mnemonic and its description.
+    struct Entry
+    {
+        const char* mnemonic;
+        const char* description;
+    };
+
+    /// @brief Constructor; creates a new instance of InstructionSet.
+    /// @param kind The instruction set.
+    explicit InstructionSet(Kind kind) : kind{ kind } {}
+
+    /// @brief Finds an instruction set by the name Name() gives it.
+    /// @param name The name, in any case.
+    /// @return The instruction set, or nothing if there is none with the
+    /// name.
+    static std::optional<InstructionSet> FromName(const wxString& name);
+
+    /// @brief Gets which instruction set this is.
+    /// @return The kind of instruction set.
+    Kind GetKind() const { return kind; }
+
+    /// @brief Gets the short name of the instruction set, as used on the
+    /// command line.
+    /// @return The name, such as "mips3".
+    const char* Name() const;
+
+    /// @brief Gets the name of the instruction set to show to the user.
+    /// @return The name, such as "MIPS III".
+    const char* Label() const;
+
+    /// @brief Gets every mnemonic of the instruction set.
+    /// @return The mnemonics and their descriptions, sorted by mnemonic.
+    std::vector<Entry> Entries() const;
+
+    /// @brief Gets every mnemonic of the instruction set as instructions to
+    /// search for.
+    /// @return The instructions, sorted by name.
+    std::vector<Instruction> Instructions() const;
+private:
+    Kind kind;
+};
+
+#endif
@@ -15,6 +15,7 @@
 // limitations under the License.
 
 #include "Line.h"
+#include "Instruction.h"
 
 Line::Line(int number, wxString text) : number{ number}, text{ text }
 {
@@ -26,7 +27,6 @@ Line::Line(int number, wxString text) : number{ number}, text{ text }
     // only need to obtain the first token for comparison to the instruction.
     if (tokenizer.HasMoreTokens())
     {
-        firstToken = tokenizer.NextToken();
-        firstToken.LowerCase();
+        firstToken = Instruction::FoldCase(tokenizer.NextToken());
     }
-}
\ No newline at end of file
+}
@@ -17,7 +17,7 @@
 #ifndef LINE_H
 #define LINE_H
 
-#include <wx/wx.h>
+#include <wx/string.h>
 #include <wx/tokenzr.h>
 
 /// @brief Represents a line from an assembly language source file.
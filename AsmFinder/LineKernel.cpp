@@ -0,0 +1,266 @@
+// LineKernel.cpp - Defines the LineKernel class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "LineKernel.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#define LINE_KERNEL_X86
+#endif
+
+// SSE2 is part of every x86-64 processor, so it only has to be checked for
+// when the compiler is told it can use it on 32-bit builds.
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LINE_KERNEL_SSE2
+#include <emmintrin.h>
+#endif
+
+// AVX2 isn't part of the baseline, so it is compiled for each function that
+// uses it and only called after checking the processor supports it.
+#if defined(LINE_KERNEL_X86) && defined(LINE_KERNEL_SSE2)
+#define LINE_KERNEL_AVX2
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define AVX2_TARGET
+#endif
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace
+{
+    bool IsLineEnd(char c)
+    {
+        return c == '\n' || c == '\r';
+    }
+
+    bool IsBlank(char c)
+    {
+        return c == ' ' || c == '\t';
+    }
+
+    const char* ScalarFindLineEnd(const char* position, const char* end)
+    {
+        while (position != end && !IsLineEnd(*position))
+            position++;
+
+        return position;
+    }
+
+    const char* ScalarSkipBlanks(const char* position, const char* end)
+    {
+        while (position != end && IsBlank(*position))
+            position++;
+
+        return position;
+    }
+
+    const char* ScalarFindBlank(const char* position, const char* end)
+    {
+        while (position != end && !IsBlank(*position))
+            position++;
+
+        return position;
+    }
+
+#ifdef LINE_KERNEL_SSE2
+    int CountTrailingZeros(unsigned mask)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+    // The vector loops only load whole vectors that fit before end, so they
+    // never read past the buffer. The scalar versions finish the rest.
+
+    const char* Sse2FindLineEnd(const char* position, const char* end)
+    {
+        const __m128i newline = _mm_set1_epi8('\n');
+        const __m128i carriageReturn = _mm_set1_epi8('\r');
+
+        while (end - position >= 16)
+        {
+            __m128i bytes = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(position));
+            __m128i found = _mm_or_si128(_mm_cmpeq_epi8(bytes, newline),
+                                         _mm_cmpeq_epi8(bytes, carriageReturn));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(found));
+
+            if (mask != 0)
+                return position + CountTrailingZeros(mask);
+
+            position += 16;
+        }
+
+        return ScalarFindLineEnd(position, end);
+    }
+
+    unsigned Sse2BlankMask(const char* position)
+    {
+        __m128i bytes = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(position));
+        __m128i blank = _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(' ')),
+                                     _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\t')));
+        return static_cast<unsigned>(_mm_movemask_epi8(blank));
+    }
+
+    const char* Sse2SkipBlanks(const char* position, const char* end)
+    {
+        while (end - position >= 16)
+        {
+            unsigned mask = ~Sse2BlankMask(position) & 0xFFFF;
+
+            if (mask != 0)
+                return position + CountTrailingZeros(mask);
+
+            position += 16;
+        }
+
+        return ScalarSkipBlanks(position, end);
+    }
+
+    const char* Sse2FindBlank(const char* position, const char* end)
+    {
+        while (end - position >= 16)
+        {
+            unsigned mask = Sse2BlankMask(position);
+
+            if (mask != 0)
+                return position + CountTrailingZeros(mask);
+
+            position += 16;
+        }
+
+        return ScalarFindBlank(position, end);
+    }
+#endif
+
+#ifdef LINE_KERNEL_AVX2
+    AVX2_TARGET const char* Avx2FindLineEnd(const char* position,
+                                            const char* end)
+    {
+        const __m256i newline = _mm256_set1_epi8('\n');
+        const __m256i carriageReturn = _mm256_set1_epi8('\r');
+
+        while (end - position >= 32)
+        {
+            __m256i bytes = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(position));
+            __m256i found = _mm256_or_si256(
+                _mm256_cmpeq_epi8(bytes, newline),
+                _mm256_cmpeq_epi8(bytes, carriageReturn));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(found));
+
+            if (mask != 0)
+                return position + CountTrailingZeros(mask);
+
+            position += 32;
+        }
+
+        return Sse2FindLineEnd(position, end);
+    }
+#endif
+}
+
+const LineKernel& LineKernel::Best()
+{
+    static const LineKernel& best = []() -> const LineKernel& {
+        if (const LineKernel* kernel = Get(Kind::Avx2))
+            return *kernel;
+
+        if (const LineKernel* kernel = Get(Kind::Sse2))
+            return *kernel;
+
+        return *Get(Kind::Scalar);
+    }();
+
+    return best;
+}
+
+const LineKernel* LineKernel::Get(Kind kind)
+{
+    static const LineKernel scalar{ Kind::Scalar, "Scalar", ScalarFindLineEnd,
+                                    ScalarSkipBlanks, ScalarFindBlank };
+
+#ifdef LINE_KERNEL_SSE2
+    static const LineKernel sse2{ Kind::Sse2, "SSE2", Sse2FindLineEnd,
+                                  Sse2SkipBlanks, Sse2FindBlank };
+#endif
+
+#ifdef LINE_KERNEL_AVX2
+    // Whitespace runs and tokens are short, so only the search for the end
+    // of the line gains anything from the wider vectors.
+    static const LineKernel avx2{ Kind::Avx2, "AVX2", Avx2FindLineEnd,
+                                  Sse2SkipBlanks, Sse2FindBlank };
+    static const bool hasAvx2 = HasAvx2();
+#endif
+
+    switch (kind)
+    {
+    case Kind::Scalar:
+        return &scalar;
+#ifdef LINE_KERNEL_SSE2
+    case Kind::Sse2:
+        return &sse2;
+#endif
+#ifdef LINE_KERNEL_AVX2
+    case Kind::Avx2:
+        return hasAvx2 ? &avx2 : nullptr;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+bool LineKernel::HasAvx2()
+{
+#if !defined(LINE_KERNEL_AVX2)
+    return false;
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+
+    if (info[0] < 7)
+        return false;
+
+    // The processor has to support AVX and the operating system has to save
+    // the AVX registers when it switches threads before AVX2 can be used.
+    __cpuid(info, 1);
+    constexpr int osxsave{ 1 << 27 };
+    constexpr int avx{ 1 << 28 };
+
+    if ((info[2] & (osxsave | avx)) != (osxsave | avx))
+        return false;
+
+    if ((_xgetbv(0) & 0x6) != 0x6)
+        return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
@@ -0,0 +1,108 @@
+// LineKernel.h - Declares the LineKernel class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LINE_KERNEL_H
+#define LINE_KERNEL_H
+
+/// @brief Finds line endings and whitespace in raw text.
+///
+/// There is an implementation for each instruction set that can speed up
+/// the search. They all return the same results, so the scanner uses the
+/// fastest one the processor supports unless it is told otherwise.
+class LineKernel
+{
+public:
+    /// @brief Identifies an implementation of the kernel.
+    enum class Kind
+    {
+        Scalar,
+        Sse2,
+        Avx2
+    };
+
+    /// @brief Gets the fastest kernel the processor supports.
+    /// @return The kernel, which is detected the first time it is used.
+    static const LineKernel& Best();
+
+    /// @brief Gets a specific kernel.
+    /// @param kind The kernel to get.
+    /// @return The kernel, or nullptr if the processor or the compiler
+    /// doesn't support it.
+    static const LineKernel* Get(Kind kind);
+
+    /// @brief Gets which implementation the kernel is.
+    /// @return The kind of kernel.
+    Kind GetKind() const { return kind; }
+
+    /// @brief Gets the name of the kernel to show to the user.
+    /// @return The name, such as "AVX2".
+    const char* Name() const { return name; }
+
+    /// @brief Finds the end of the line that contains position.
+    /// @param position The first byte to check.
+    /// @param end One past the last byte to check.
+    /// @return The first "\n" or "\r" at or after position, or end if there
+    /// is none.
+    const char* FindLineEnd(const char* position, const char* end) const
+    {
+        return findLineEnd(position, end);
+    }
+
+    /// @brief Skips spaces and tabs.
+    /// @param position The first byte to check.
+    /// @param end One past the last byte to check.
+    /// @return The first byte that isn't a space or tab, or end if there is
+    /// none.
+    const char* SkipBlanks(const char* position, const char* end) const
+    {
+        return skipBlanks(position, end);
+    }
+
+    /// @brief Finds the next space or tab.
+    /// @param position The first byte to check.
+    /// @param end One past the last byte to check.
+    /// @return The first space or tab, or end if there is none.
+    const char* FindBlank(const char* position, const char* end) const
+    {
+        return findBlank(position, end);
+    }
+private:
+    using Finder = const char* (*)(const char*, const char*);
+
+    Kind kind;
+    const char* name;
+    Finder findLineEnd;
+    Finder skipBlanks;
+    Finder findBlank;
+
+    /// @brief Constructor; creates a new instance of LineKernel.
+    /// @param kind Which implementation the kernel is.
+    /// @param name The name of the kernel.
+    /// @param findLineEnd Implements FindLineEnd().
+    /// @param skipBlanks Implements SkipBlanks().
+    /// @param findBlank Implements FindBlank().
+    LineKernel(Kind kind, const char* name, Finder findLineEnd,
+               Finder skipBlanks, Finder findBlank)
+        : kind{ kind }, name{ name }, findLineEnd{ findLineEnd },
+          skipBlanks{ skipBlanks }, findBlank{ findBlank }
+    {}
+
+    /// @brief Determines if the processor supports AVX2.
+    /// @return True if AVX2 code can run, otherwise false.
+    static bool HasAvx2();
+};
+
+#endif
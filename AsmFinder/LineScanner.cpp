@@ -0,0 +1,101 @@
+// LineScanner.cpp - Defines the LineScanner class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "LineScanner.h"
+
+LineScanner::LineScanner(const char* data, std::size_t size,
+                         const LineKernel& kernel)
+    : LineScanner{ data, 0, size, kernel }
+{}
+
+LineScanner::LineScanner(const char* data, std::size_t from, std::size_t to,
+                         const LineKernel& kernel)
+    : kernel{ &kernel }, data{ data }, end{ data + to }, cursor{ data + from },
+      lineBegin{ data + from }, lineEnd{ data + from }
+{
+    // wxTextFile drops a UTF-8 byte order mark, so the scanner does too. It
+    // can only appear at the very start of the file.
+    if (from == 0 && to >= 3 &&
+        static_cast<unsigned char>(data[0]) == 0xEF &&
+        static_cast<unsigned char>(data[1]) == 0xBB &&
+        static_cast<unsigned char>(data[2]) == 0xBF)
+    {
+        cursor += 3;
+    }
+}
+
+bool LineScanner::CanScan(const char* data, std::size_t size)
+{
+    if (size < 2)
+        return true;
+
+    auto byte = [data](std::size_t i) {
+        return static_cast<unsigned char>(data[i]);
+    };
+
+    if ((byte(0) == 0xFF && byte(1) == 0xFE) ||
+        (byte(0) == 0xFE && byte(1) == 0xFF))
+    {
+        return false;
+    }
+
+    if (size >= 4 && byte(0) == 0 && byte(1) == 0 && byte(2) == 0xFE &&
+        byte(3) == 0xFF)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool LineScanner::Next()
+{
+    if (cursor == end)
+        return false;
+
+    const char* position = kernel->FindLineEnd(cursor, end);
+
+    lineBegin = cursor;
+    lineEnd = position;
+
+    if (position != end)
+    {
+        if (*position == '\r' && position + 1 != end && position[1] == '\n')
+            position += 2;
+        else
+            position++;
+    }
+
+    cursor = position;
+    number++;
+    return true;
+}
+
+std::string_view LineScanner::Text() const
+{
+    return std::string_view(lineBegin, lineEnd - lineBegin);
+}
+
+std::string_view LineScanner::FirstToken() const
+{
+    // These are the same delimiters wxStringTokenizer uses by default. The
+    // line ending characters can't appear inside a line, so only spaces and
+    // tabs need to be skipped.
+    const char* tokenBegin = kernel->SkipBlanks(lineBegin, lineEnd);
+    const char* tokenEnd = kernel->FindBlank(tokenBegin, lineEnd);
+
+    return std::string_view(tokenBegin, tokenEnd - tokenBegin);
+}
@@ -0,0 +1,87 @@
+// LineScanner.h - Declares the LineScanner class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LINE_SCANNER_H
+#define LINE_SCANNER_H
+
+#include <cstddef>
+#include <string_view>
+#include "LineKernel.h"
+
+/// @brief Walks the lines of a UTF-8 text buffer without copying them.
+///
+/// Lines end at "\n", "\r\n" or a lone "\r", the same as wxTextFile, and a
+/// final line without a line ending still counts as a line. The bytes are
+/// checked with the fastest LineKernel the processor supports.
+class LineScanner
+{
+public:
+    /// @brief Constructor; creates a new instance of LineScanner.
+    /// @param data The text to scan. Must outlive the scanner.
+    /// @param size The size of the text in bytes.
+    /// @param kernel The kernel that checks the bytes.
+    LineScanner(const char* data, std::size_t size,
+                const LineKernel& kernel = LineKernel::Best());
+
+    /// @brief Constructor; creates a LineScanner for part of a buffer.
+    /// @param data The whole text. Must outlive the scanner.
+    /// @param from The offset of the first byte to scan, which must be the
+    /// start of a line.
+    /// @param to The offset one past the last byte to scan.
+    /// @param kernel The kernel that checks the bytes.
+    /// @post Number() counts lines from the first one scanned and Offset()
+    /// is relative to data.
+    LineScanner(const char* data, std::size_t from, std::size_t to,
+                const LineKernel& kernel = LineKernel::Best());
+
+    /// @brief Determines if a buffer holds text the scanner can read.
+    /// @param data The text to check.
+    /// @param size The size of the text in bytes.
+    /// @return False if the text has a UTF-16 or UTF-32 byte order mark,
+    /// otherwise true.
+    static bool CanScan(const char* data, std::size_t size);
+
+    /// @brief Advances to the next line.
+    /// @return True if there was another line, otherwise false.
+    bool Next();
+
+    /// @brief Gets the number of the current line, starting from 1.
+    /// @return An integer representing the line number in the file.
+    int Number() const { return number; }
+
+    /// @brief Gets the position of the current line in the buffer.
+    /// @return The offset of the first byte of the line.
+    std::size_t Offset() const { return lineBegin - data; }
+
+    /// @brief Gets the text of the current line.
+    /// @return A view of the line, excluding its line ending.
+    std::string_view Text() const;
+
+    /// @brief Gets the first whitespace-delimited token of the current line.
+    /// @return A view of the token as it appears in the buffer, which is
+    /// empty if the line is blank.
+    std::string_view FirstToken() const;
+private:
+    const LineKernel* kernel;
+    const char* data;
+    const char* end;
+    const char* cursor;
+    const char* lineBegin;
+    const char* lineEnd;
+    int number{ 0 };
+};
+
+#endif
@@ -0,0 +1,86 @@
+// LineTable.cpp - Defines the LineTable class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "LineTable.h"
+
+#include <algorithm>
+#include "LineScanner.h"
+
+void LineTable::Clear()
+{
+    checkpoints.clear();
+    lineCount = 0;
+}
+
+void LineTable::Add(std::uint64_t begin,
+                    const std::vector<std::size_t>& offsets,
+                    std::uint32_t lineCount)
+{
+    if (lineCount == 0)
+        return;
+
+    // The first line of a piece is kept as well, so no line is more than
+    // interval - 1 lines after a kept one even where two pieces meet.
+    checkpoints.push_back(Checkpoint{ this->lineCount + 1, begin });
+
+    std::uint32_t line{ this->lineCount };
+
+    for (std::size_t offset : offsets)
+    {
+        line += interval;
+        checkpoints.push_back(Checkpoint{ line, offset });
+    }
+
+    this->lineCount += lineCount;
+}
+
+void LineTable::Build(const SourceFile& source)
+{
+    Clear();
+
+    std::vector<std::size_t> offsets;
+    LineScanner scanner{ source.Data(), source.Size() };
+
+    while (scanner.Next())
+    {
+        if (scanner.Number() % interval == 0)
+            offsets.push_back(scanner.Offset());
+    }
+
+    Add(0, offsets, static_cast<std::uint32_t>(scanner.Number()));
+}
+
+std::uint64_t LineTable::OffsetOf(const SourceFile& source,
+                                  std::uint32_t line) const
+{
+    if (line == 0 || line > lineCount)
+        return npos;
+
+    auto after = [](std::uint32_t line, const Checkpoint& kept) {
+        return line < kept.line;
+    };
+    auto next = std::upper_bound(checkpoints.begin(), checkpoints.end(), line,
+                                 after);
+    const Checkpoint& kept = *(next - 1);
+
+    LineScanner scanner{ source.Data(), static_cast<std::size_t>(kept.offset),
+                         source.Size() };
+
+    for (std::uint32_t i = kept.line; i <= line; i++)
+        scanner.Next();
+
+    return scanner.Offset();
+}
@@ -0,0 +1,84 @@
+// LineTable.h - Declares the LineTable class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LINE_TABLE_H
+#define LINE_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "SourceFile.h"
+
+/// @brief Finds where a line starts in a source file from its number.
+///
+/// Keeping the offset of every line would cost more than the matches, so
+/// only the offset of every 64th line is kept, along with the first line of
+/// each piece of the file a search scanned. A line is found by looking up
+/// the closest one kept before it and reading forward from there, which
+/// reads at most 63 lines however large the file is.
+class LineTable
+{
+public:
+    /// @brief The number of lines between the lines that are kept.
+    static constexpr int interval{ 64 };
+
+    /// @brief The offset returned for a line that isn't in the file.
+    static constexpr std::uint64_t npos{
+        std::numeric_limits<std::uint64_t>::max() };
+
+    /// @brief Removes all the lines.
+    /// @post LineCount() is zero.
+    void Clear();
+
+    /// @brief Adds the lines of a piece of the file after the lines of the
+    /// pieces before it.
+    /// @param begin The offset of the first line of the piece.
+    /// @param offsets The offset of every interval-th line of the piece,
+    /// counting from its first line.
+    /// @param lineCount The number of lines in the piece.
+    void Add(std::uint64_t begin, const std::vector<std::size_t>& offsets,
+             std::uint32_t lineCount);
+
+    /// @brief Builds the table by reading every line of a file, for a file
+    /// that wasn't scanned by a search.
+    /// @param source The source file.
+    void Build(const SourceFile& source);
+
+    /// @brief Gets the number of lines added.
+    /// @return The number of lines in the file, once every piece of it has
+    /// been added.
+    std::uint32_t LineCount() const { return lineCount; }
+
+    /// @brief Finds the start of a line.
+    /// @param source The file the table was built from.
+    /// @param line The number of the line, starting from 1.
+    /// @return The offset of the first byte of the line, or npos if the
+    /// file doesn't have that many lines.
+    std::uint64_t OffsetOf(const SourceFile& source, std::uint32_t line) const;
+private:
+    /// @brief A line whose offset is kept.
+    struct Checkpoint
+    {
+        std::uint32_t line;
+        std::uint64_t offset;
+    };
+
+    std::vector<Checkpoint> checkpoints;
+    std::uint32_t lineCount{ 0 };
+};
+
+#endif
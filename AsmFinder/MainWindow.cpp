@@ -16,6 +16,25 @@
 
 #include "MainWindow.h"
 
+#include <algorithm>
+#include <iterator>
+#include "ComparisonDialog.h"
+#include "HistogramDialog.h"
+#include "ScopeDialog.h"
+#include "ScopedTimer.h"
+#include "StatisticsDialog.h"
+
+namespace
+{
+    // A build writes a file in many pieces, so the file is only searched
+    // again once it has stopped changing for this long.
+    constexpr int watchDelay{ 500 };
+
+    // The preview shows this many lines before and after the line it is
+    // showing.
+    constexpr std::uint32_t previewContext{ 5 };
+}
+
 MainWindow::MainWindow() : wxFrame(nullptr, wxID_ANY, "AsmFinder")
 {
     panel = new wxPanel(this);
@@ -30,6 +49,11 @@ MainWindow::MainWindow() : wxFrame(nullptr, wxID_ANY, "AsmFinder")
     UpdateControls();
 }
 
+MainWindow::~MainWindow()
+{
+    StopSearch();
+}
+
 void MainWindow::InitVersion()
 {
     version << 'v' << VERSION_MAJOR << "." << VERSION_MINOR;
@@ -44,19 +68,48 @@ void MainWindow::InitMenuBar()
     wxMenu *fileMenu = new wxMenu;
     fileMenu->Append(ID::Open, "&Open...\tCtrlO",
                     "Open an assembly source file");
+    fileMenu->Append(ID::OpenFolder, "Open &Folder...",
+                    "Open a folder of assembly source files");
     fileMenu->Append(ID::Save, "&Save...\tCtrlO",
                     "Saves the results as an assembly source file");
     fileMenu->Append(ID::Import, "&Import...\tCtrlI",
                     "Imports a list of instructions");
     fileMenu->Append(ID::Export, "&Export...\tCtrlE",
                     "Exports a list of instructions");
+    fileMenu->Append(ID::Compare, "&Compare With Baseline...",
+                     "Compares the open file with an earlier build of it");
+
+    wxMenu* instructionSetMenu = new wxMenu;
+
+    int instructionSetId{ ID::FirstInstructionSet };
+
+    for (InstructionSet::Kind kind : InstructionSet::kinds)
+    {
+        InstructionSet instructionSet{ kind };
+        wxString help;
+        help << "Adds every " << instructionSet.Label() << " instruction";
+        instructionSetMenu->Append(instructionSetId++, instructionSet.Label(),
+                                   help);
+    }
+
+    fileMenu->AppendSubMenu(instructionSetMenu, "Add Instruction &Set",
+                            "Adds every instruction of an instruction set");
     fileMenu->Append(wxID_EXIT);
  
+    wxMenu* viewMenu = new wxMenu;
+    viewMenu->Append(ID::GoToLine, "&Go to Line...\tCtrl+G",
+                     "Show a line of the file in the preview");
+    viewMenu->Append(ID::Scopes, "Matches by &Function...",
+                     "Show how many matches are in each function and section");
+    viewMenu->Append(ID::Statistics, "Search &Statistics...",
+                     "Show where the time of the last search went");
+
     wxMenu *helpMenu = new wxMenu;
     helpMenu->Append(wxID_ABOUT);
  
     wxMenuBar *menuBar = new wxMenuBar;
     menuBar->Append(fileMenu, "&File");
+    menuBar->Append(viewMenu, "&View");
     menuBar->Append(helpMenu, "&Help");
  
     SetMenuBar(menuBar);
@@ -64,8 +117,17 @@ void MainWindow::InitMenuBar()
 
 void MainWindow::InitStatusBar()
 {
-    CreateStatusBar();
+    constexpr int progressWidth{ 200 };
+    const int widths[]{ -1, progressWidth };
+
+    CreateStatusBar(2);
+    SetStatusWidths(2, widths);
     SetStatusText("Ready");
+
+    // The gauge sits in the second field of the status bar and is moved
+    // back into place whenever the status bar is resized.
+    progressGauge = new wxGauge{ GetStatusBar(), wxID_ANY, 1000 };
+    GetStatusBar()->Bind(wxEVT_SIZE, &MainWindow::OnStatusBarSize, this);
 }
 
 void MainWindow::InitControls()
@@ -73,20 +135,60 @@ void MainWindow::InitControls()
     nameLabel = new wxStaticText{ panel, wxID_ANY, "Instruction" };
     descriptionLabel = new wxStaticText{ panel, wxID_ANY, "Description" };
     fileLabel = new wxStaticText { panel, wxID_ANY, "Current File: <None>" };
+    threadsLabel = new wxStaticText{ panel, wxID_ANY, "Threads" };
+    dialectLabel = new wxStaticText{ panel, wxID_ANY, "Dialect" };
+    includeLabel = new wxStaticText{ panel, wxID_ANY, "Include" };
+    excludeLabel = new wxStaticText{ panel, wxID_ANY, "Exclude" };
 
     nameTextCtrl = new wxTextCtrl(panel, wxID_ANY);
     descriptionTextCtrl = new wxTextCtrl(panel, wxID_ANY);
+
+    // The patterns choose which files in a folder are searched. They are
+    // only used when a folder is open.
+    includeTextCtrl = new wxTextCtrl(panel, wxID_ANY, "*.s;*.S;*.asm");
+    excludeTextCtrl = new wxTextCtrl(panel, wxID_ANY);
     addButton = new wxButton(panel, ID::Add, "Add");
     searchButton = new wxButton(panel, ID::Search, "Search");
+    analyzeButton = new wxButton(panel, ID::Analyze, "Analyze");
+    cancelButton = new wxButton(panel, ID::Cancel, "Cancel");
+
+    // Searching with a single thread matches lines one after another, the
+    // same as before the search engine was parallel.
+    int threads = static_cast<int>(searchEngine.ThreadCount());
+    threadsSpinCtrl = new wxSpinCtrl(panel, wxID_ANY, wxEmptyString,
+                                     wxDefaultPosition, wxDefaultSize,
+                                     wxSP_ARROW_KEYS, 1, 256, threads);
 
-    instructionListView = new wxListView{ panel, wxID_ANY, wxDefaultPosition };
-    instructionListView->AppendColumn("Instruction");
-    instructionListView->AppendColumn("Description", wxLIST_FORMAT_LEFT, 300);
-    instructionListView->AppendColumn("Found");
+    // The index is saved next to the file being searched, so it is only
+    // written when asked for.
+    indexCheckBox = new wxCheckBox{ panel, wxID_ANY, "Use index" };
+    indexCheckBox->SetValue(searchEngine.UsesIndex());
 
-    resultListView = new wxListView{ panel, wxID_ANY };
-    resultListView->AppendColumn("Line");
-    resultListView->AppendColumn("Text", wxLIST_FORMAT_LEFT, 400);
+    // The dialect decides which part of each line is the instruction. The
+    // first word of the line is the default, as it always has been.
+    dialectChoice = new wxChoice{ panel, ID::ChooseDialect };
+
+    for (Dialect::Kind kind : Dialect::kinds)
+        dialectChoice->Append(Dialect{ kind }.Label());
+
+    dialectChoice->SetSelection(0);
+
+    // Watching searches the file again whenever it changes, reading only
+    // the parts that changed.
+    watchCheckBox = new wxCheckBox{ panel, ID::Watch, "Watch file" };
+
+    instructionListView = new InstructionListView{ panel, instructions,
+                                                   matches };
+    resultListView = new ResultListView{ panel, matches, sources,
+                                         sourceNames };
+
+    // The preview reads the lines around the selected result from the
+    // file when it is selected, so the results never hold any text.
+    previewTextCtrl = new wxTextCtrl{ panel, wxID_ANY, wxEmptyString,
+                                      wxDefaultPosition, wxDefaultSize,
+                                      wxTE_MULTILINE | wxTE_READONLY |
+                                      wxTE_RICH2 | wxTE_DONTWRAP };
+    previewTextCtrl->SetFont(wxFontInfo{}.Family(wxFONTFAMILY_TELETYPE));
 }
 
 void MainWindow::ConfigureLayout()
@@ -106,16 +208,40 @@ void MainWindow::ConfigureLayout()
     searchInstructionSizer = new wxBoxSizer{ wxHORIZONTAL };
     searchInstructionSizer->Add(searchButton, 0, 
                                 wxALL | wxALIGN_CENTER_VERTICAL, 5);
+    searchInstructionSizer->Add(analyzeButton, 0,
+                                wxALL | wxALIGN_CENTER_VERTICAL, 5);
+    searchInstructionSizer->Add(cancelButton, 0,
+                                wxALL | wxALIGN_CENTER_VERTICAL, 5);
+    searchInstructionSizer->Add(threadsLabel, 0,
+                                wxALL | wxALIGN_CENTER_VERTICAL, 5);
+    searchInstructionSizer->Add(threadsSpinCtrl, 0,
+                                wxALL | wxALIGN_CENTER_VERTICAL, 5);
+    searchInstructionSizer->Add(dialectLabel, 0,
+                                wxALL | wxALIGN_CENTER_VERTICAL, 5);
+    searchInstructionSizer->Add(dialectChoice, 0,
+                                wxALL | wxALIGN_CENTER_VERTICAL, 5);
+    searchInstructionSizer->Add(indexCheckBox, 0,
+                                wxALL | wxALIGN_CENTER_VERTICAL, 5);
+    searchInstructionSizer->Add(watchCheckBox, 0,
+                                wxALL | wxALIGN_CENTER_VERTICAL, 5);
     searchInstructionSizer->Add(fileLabel, 0,
                                 wxALL | wxALIGN_CENTER_VERTICAL, 5);
 
+    filterSizer = new wxBoxSizer{ wxHORIZONTAL };
+    filterSizer->Add(includeLabel, addInstructionSizerFlags);
+    filterSizer->Add(includeTextCtrl, 1, wxALIGN_CENTER_VERTICAL, 5);
+    filterSizer->Add(excludeLabel, addInstructionSizerFlags);
+    filterSizer->Add(excludeTextCtrl, 1, wxALIGN_CENTER_VERTICAL, 5);
+
     topSizer = new wxStaticBoxSizer{ wxVERTICAL, panel, "Search" };
     topSizer->Add(addInstructionSizer, 0, wxEXPAND);
     topSizer->Add(instructionListView, 1, wxALL | wxEXPAND, 5);
     topSizer->Add(searchInstructionSizer);
+    topSizer->Add(filterSizer, 0, wxEXPAND);
     
     bottomSizer = new wxStaticBoxSizer{ wxVERTICAL, panel, "Results" };
-    bottomSizer->Add(resultListView, 1, wxALL | wxEXPAND, 5);
+    bottomSizer->Add(resultListView, 2, wxALL | wxEXPAND, 5);
+    bottomSizer->Add(previewTextCtrl, 1, wxALL | wxEXPAND, 5);
 
     panelSizer = new wxBoxSizer{ wxVERTICAL };
     panelSizer->Add(topSizer, 1, wxALL | wxEXPAND, 10);
@@ -127,18 +253,37 @@ void MainWindow::ConfigureLayout()
 void MainWindow::InitEventBindings()
 {
     Bind(wxEVT_MENU, &MainWindow::OnOpen, this, ID::Open);
+    Bind(wxEVT_MENU, &MainWindow::OnOpenFolder, this, ID::OpenFolder);
     Bind(wxEVT_MENU, &MainWindow::OnSave, this, ID::Save);
     Bind(wxEVT_MENU, &MainWindow::OnImport, this, ID::Import);
     Bind(wxEVT_MENU, &MainWindow::OnExport, this, ID::Export);
+    Bind(wxEVT_MENU, &MainWindow::OnCompare, this, ID::Compare);
+    Bind(wxEVT_MENU, &MainWindow::OnGoToLine, this, ID::GoToLine);
+    Bind(wxEVT_MENU, &MainWindow::OnScopes, this, ID::Scopes);
+    Bind(wxEVT_MENU, &MainWindow::OnStatistics, this, ID::Statistics);
+    Bind(wxEVT_MENU, &MainWindow::OnInstructionSet, this,
+         ID::FirstInstructionSet,
+         ID::FirstInstructionSet +
+             static_cast<int>(std::size(InstructionSet::kinds)) - 1);
     Bind(wxEVT_MENU, &MainWindow::OnAbout, this, wxID_ABOUT);
     Bind(wxEVT_MENU, &MainWindow::OnExit, this, wxID_EXIT);
     Bind(wxEVT_BUTTON, &MainWindow::OnAdd, this, ID::Add);
     Bind(wxEVT_BUTTON, &MainWindow::OnSearch, this, ID::Search);
+    Bind(wxEVT_BUTTON, &MainWindow::OnAnalyze, this, ID::Analyze);
+    Bind(wxEVT_BUTTON, &MainWindow::OnCancel, this, ID::Cancel);
+    Bind(wxEVT_CHOICE, &MainWindow::OnDialect, this, ID::ChooseDialect);
+    Bind(wxEVT_CHECKBOX, &MainWindow::OnWatch, this, ID::Watch);
+    Bind(wxEVT_FSWATCHER, &MainWindow::OnFileSystemChange, this);
+    resultListView->Bind(wxEVT_LIST_ITEM_SELECTED,
+                         &MainWindow::OnResultSelected, this);
+
+    watchTimer.SetOwner(this);
+    Bind(wxEVT_TIMER, &MainWindow::OnWatchTimer, this, watchTimer.GetId());
 }
 
 void MainWindow::UpdateControls()
 {
-    if (path == "")
+    if (path == "" || searching)
     {
         EnableControls(false);
     }
@@ -157,124 +302,135 @@ void MainWindow::EnableControls(bool enabled)
     descriptionTextCtrl->Enable(enabled);
     addButton->Enable(enabled);
     searchButton->Enable(enabled);
+    analyzeButton->Enable(enabled);
+    threadsSpinCtrl->Enable(enabled);
+    indexCheckBox->Enable(enabled);
+    dialectChoice->Enable(enabled);
+    watchCheckBox->Enable(enabled && !pathIsFolder);
+    includeTextCtrl->Enable(enabled && pathIsFolder);
+    excludeTextCtrl->Enable(enabled && pathIsFolder);
     instructionListView->Enable(enabled);
     resultListView->Enable(enabled);
-}
-
-void MainWindow::UpdateInstructionListView()
-{
-    constexpr int descIndex{ 1 };
-    constexpr int foundIndex{ 2 };
-
-    int itemIndex{ 0 };
+    GetMenuBar()->Enable(ID::Compare, enabled);
+    GetMenuBar()->Enable(ID::Open, !searching);
+    GetMenuBar()->Enable(ID::OpenFolder, !searching);
 
-    instructionListView->DeleteAllItems();
+    // The results are shown as they are found, so the result list stays
+    // usable while a search is running.
+    if (searching)
+        resultListView->Enable();
 
-    for (auto& i : instructions)
-    {
-        wxString name = i.Name();
-        wxString desc = i.Description();
-        wxString found;
-        found << i.MatchingLines().size();
-        instructionListView->InsertItem(itemIndex, i.Name());
-        instructionListView->SetItem(itemIndex, descIndex, desc);
-        instructionListView->SetItem(itemIndex, foundIndex, found);
-        itemIndex++;
-    }
+    cancelButton->Enable(searching);
 }
 
-void MainWindow::UpdateResultListView()
+void MainWindow::UpdateInstructionListView()
 {
-    constexpr int textIndex{ 1 };
-    int itemIndex{ 0 };
-
-    resultListView->DeleteAllItems();
-
-    for (auto& r : results)
-    {
-        wxString lineNumber;
-        lineNumber << r.Number();
-        resultListView->InsertItem(itemIndex, lineNumber);
-        resultListView->SetItem(itemIndex, textIndex, r.Text());
-        itemIndex++;
-    }
+    instructionListView->UpdateItems();
 }
 
-void MainWindow::MatchInstructions(const Line& line)
+void MainWindow::UpdateResultListView()
 {
-    for (auto& instruction : instructions)
-    {
-        if (instruction.Match(line))
-        {
-            results.push_back(line);
-            break;
-        }
-    }
+    resultListView->UpdateItems();
 }
 
-void MainWindow::ParseInstructionDefinition(wxString line)
+void MainWindow::StopSearch()
 {
-    int commaPosition = line.Find(',');
-
-    if (commaPosition != wxNOT_FOUND)
+    if (searchThread.joinable())
     {
-        size_t nameFrom{ 0 };
-        size_t nameTo{ static_cast<size_t>(commaPosition) - 1 };
-        size_t descFrom{ static_cast<size_t>(commaPosition) + 1 };
-        size_t descTo{ line.Length() - 1 };
-        wxString name = line.SubString(nameFrom, nameTo);
-        wxString desc = line.SubString(descFrom, descTo);
-        Instruction i{ name, desc };
-        instructions.push_back(i);
+        cancelSearch = true;
+        searchThread.join();
     }
 }
 
 void MainWindow::ClearInstructionCounts()
 {
-    for (auto& instruction : instructions)
-        instruction.ClearMatches();
+    matches.Reset(instructions.size());
+    lineTables.clear();
+    scopeTables.clear();
+    previewTextCtrl->Clear();
+
+    // The matches can only be updated in place while they are from the
+    // same instructions and the same file as the signature.
+    signature = FileSignature{};
 }
 
 void MainWindow::OnOpen(wxCommandEvent& event)
 {
+    // The search thread is still reading the files that are open.
+    if (searching)
+        return;
+
     wxFileDialog dialog(this);
 
     if(dialog.ShowModal() != wxID_OK) 
         return;
 
+    StopWatching();
+
+    // The old matches and their signature are of the old file, so a change
+    // to the new one must not be spliced into them.
+    ClearInstructionCounts();
+    sources.clear();
+
     path = dialog.GetPath();
+    pathIsFolder = false;
     fileLabel->SetLabelText("Current File: " + path);
     UpdateControls();  
 }
 
+void MainWindow::OnOpenFolder(wxCommandEvent& event)
+{
+    // The search thread is still reading the files that are open.
+    if (searching)
+        return;
+
+    wxDirDialog dialog(this);
+
+    if (dialog.ShowModal() != wxID_OK)
+        return;
+
+    StopWatching();
+
+    // The old matches and their signature are of the old file, so a change
+    // to the new one must not be spliced into them.
+    ClearInstructionCounts();
+    sources.clear();
+
+    path = dialog.GetPath();
+    pathIsFolder = true;
+    fileLabel->SetLabelText("Current Folder: " + path);
+    UpdateControls();
+}
+
 void MainWindow::OnSave(wxCommandEvent& event)
 {
-    wxFileDialog saveFileDialog(this, _("Save Result ASM file"), "", "",
-                                "ASM Files (*.s)|*.s", 
+    wxString wildcard;
+
+    for (auto format : ResultWriter::formats)
+    {
+        if (!wildcard.empty())
+            wildcard += '|';
+
+        wxString extension = ResultWriter::Extension(format);
+        wildcard += wxString{ ResultWriter::FormatLabel(format) } +
+            " (*." + extension + ")|*." + extension;
+    }
+
+    wxFileDialog saveFileDialog(this, _("Save Results"), "", "", wildcard,
                                 wxFD_SAVE|wxFD_OVERWRITE_PROMPT);
  
     if (saveFileDialog.ShowModal() == wxID_CANCEL)
         return;
 
-    wxTextFile resultsFile;
-    resultsFile.Create(saveFileDialog.GetPath());
+    wxBusyCursor busy;
+    ResultWriter writer{
+        ResultWriter::formats[saveFileDialog.GetFilterIndex()] };
 
-    for (auto& i : instructions)
+    if (!writer.Write(saveFileDialog.GetPath(), sources, sourceNames,
+                      instructions, matches))
     {
-        for (auto& line : i.MatchingLines())
-        {
-            wxString lineToSave;
-            lineToSave << line.Text();
-            lineToSave << " # Line ";
-            lineToSave << line.Number();
-            lineToSave << ", ";
-            lineToSave << i.Description();
-            resultsFile.AddLine(lineToSave);
-        }
-    }
-
-    if (!resultsFile.Write())
         wxMessageBox("Unable to write to disk", "AsmFinder", wxOK | wxICON_ERROR);
+    }
 }
 
 void MainWindow::OnImport(wxCommandEvent& event)
@@ -284,18 +440,42 @@ void MainWindow::OnImport(wxCommandEvent& event)
     if(dialog.ShowModal() != wxID_OK) 
         return;
 
-    wxString path = dialog.GetPath();
-    wxTextFile instructionFile;
-    instructionFile.Open(path);
+    std::vector<Instruction> imported;
+
+    if (!Instruction::ReadFile(dialog.GetPath(), imported))
+    {
+        wxMessageBox("Unable to read " + dialog.GetPath(), "AsmFinder",
+                     wxOK | wxICON_ERROR);
+    }
+
+    // Patterns that don't compile would never match anything, so they are
+    // left out rather than searched for.
+    wxString invalid;
 
-    ParseInstructionDefinition(instructionFile.GetFirstLine());
+    auto isInvalid = [&](const Instruction& instruction) {
+        wxString error;
 
-    while (!instructionFile.Eof())
+        if (Pattern::IsPattern(instruction.Name()) &&
+            !Pattern::Parse(instruction.Name(), &error))
+        {
+            invalid << instruction.Name() << ": " << error << "\n";
+            return true;
+        }
+
+        return false;
+    };
+
+    imported.erase(std::remove_if(imported.begin(), imported.end(),
+                                  isInvalid),
+                   imported.end());
+
+    if (!invalid.empty())
     {
-        ParseInstructionDefinition(instructionFile.GetNextLine());
+        wxMessageBox("These patterns aren't valid and were skipped:\n\n" +
+                     invalid, "AsmFinder", wxOK | wxICON_WARNING);
     }
 
-    UpdateControls();
+    AddInstructions(imported);
 }
 
 void MainWindow::OnExport(wxCommandEvent& event)
@@ -303,11 +483,49 @@ void MainWindow::OnExport(wxCommandEvent& event)
     wxMessageBox("Under Construction", "AsmFinder", wxOK | wxICON_INFORMATION);
 }
 
+void MainWindow::OnInstructionSet(wxCommandEvent& event)
+{
+    std::size_t i = static_cast<std::size_t>(event.GetId() -
+                                             ID::FirstInstructionSet);
+    AddInstructions(InstructionSet{ InstructionSet::kinds[i] }.Instructions());
+}
+
+void MainWindow::AddInstructions(const std::vector<Instruction>& added)
+{
+    std::size_t addedCount = Instruction::AddUnique(instructions, added);
+
+    wxString status;
+    status << "Added " << addedCount << " instructions";
+
+    if (addedCount < added.size())
+        status << ", skipping " << added.size() - addedCount << " duplicates";
+
+    SetStatusText(status);
+
+    if (addedCount == 0)
+        return;
+
+    // The new instructions haven't been searched for yet, so their counts
+    // stay at zero until the next search.
+    signature = FileSignature{};
+    UpdateControls();
+}
+
 void MainWindow::OnAdd(wxCommandEvent& event)
 {
     Instruction i{ nameTextCtrl->GetLineText(0), 
                    descriptionTextCtrl->GetLineText(0) };
+    wxString error;
+
+    if (Pattern::IsPattern(i.Name()) && !Pattern::Parse(i.Name(), &error))
+    {
+        wxMessageBox(i.Name() + " isn't a valid pattern: " + error,
+                     "AsmFinder", wxOK | wxICON_ERROR);
+        return;
+    }
+
     instructions.push_back(i);
+    signature = FileSignature{};
     UpdateControls();
 }
 
@@ -319,33 +537,707 @@ void MainWindow::OnSearch(wxCommandEvent& event)
                      "AsmFinder", wxOK | wxICON_INFORMATION);
         return;
     }
-        
-    EnableControls(false);
+
+    StartSearch(SearchMode::Search);
+}
+
+void MainWindow::OnCompare(wxCommandEvent& event)
+{
+    // A comparison is a search of its own, which can't start while another
+    // one is still reading the files.
+    if (searching)
+        return;
+
+    if (path.IsEmpty() || pathIsFolder)
+    {
+        wxMessageBox("Open the file of the current build first. Its "
+                     "functions are compared with the same functions of the "
+                     "baseline.", "AsmFinder", wxOK | wxICON_INFORMATION);
+        return;
+    }
+
+    if (instructions.size() == 0)
+    {
+        wxMessageBox("You must add at least one instruction to search for.",
+                     "AsmFinder", wxOK | wxICON_INFORMATION);
+        return;
+    }
+
+    wxFileDialog dialog{ this, "Choose the Baseline Build" };
+
+    if (dialog.ShowModal() != wxID_OK)
+        return;
+
+    baselinePath = dialog.GetPath();
+    StartSearch(SearchMode::Compare);
+}
+
+void MainWindow::OnGoToLine(wxCommandEvent& event)
+{
+    // The line tables are filled in by the search thread.
+    if (searching || sources.empty())
+        return;
+
+    // The line is looked up in the file of the selected result, which is
+    // the first file if none is selected.
+    long selected = resultListView->GetFirstSelected();
+    std::uint32_t file{ 0 };
+    long line{ 1 };
+
+    if (selected != -1)
+    {
+        file = matches.FileId(static_cast<std::size_t>(selected));
+        line = matches.LineNumber(static_cast<std::size_t>(selected));
+    }
+
+    // Files answered from their index, or changed since they were
+    // searched, have no table until now.
+    lineTables.resize(sources.size());
+    LineTable& lineTable = lineTables[file];
+
+    if (lineTable.LineCount() == 0)
+    {
+        wxBusyCursor busy;
+        lineTable.Build(sources[file]);
+    }
+
+    if (lineTable.LineCount() == 0)
+        return;
+
+    wxString prompt;
+    prompt << "Line number (1 to " << lineTable.LineCount() << "):";
+    line = wxGetNumberFromUser(prompt, wxEmptyString, "Go to Line", line, 1,
+                               lineTable.LineCount(), this);
+
+    if (line < 1)
+        return;
+
+    std::uint32_t number = static_cast<std::uint32_t>(line);
+    ShowPreview(file, number, lineTable.OffsetOf(sources[file], number));
+
+    // The first result from the line on is scrolled to without selecting
+    // it, which would show it in the preview instead.
+    std::size_t row = matches.FindLine(file, number);
+
+    if (row < matches.Size())
+        resultListView->Focus(static_cast<long>(row));
+}
+
+void MainWindow::OnScopes(wxCommandEvent& event)
+{
+    // The scope tables are filled in by the search thread.
+    if (searching || sources.empty())
+        return;
+
+    // Files changed since they were searched have no table until now.
+    if (scopeTables.size() != sources.size())
+    {
+        wxBusyCursor busy;
+        scopeTables.resize(sources.size());
+
+        for (std::size_t i = 0; i < sources.size(); i++)
+            scopeTables[i].Build(sources[i], searchEngine.GetDialect());
+    }
+
+    ScopeSummary summary;
+    summary.Summarize(matches, scopeTables);
+
+    if (summary.Sections().empty())
+    {
+        wxMessageBox("There are no matches to show.", "AsmFinder",
+                     wxOK | wxICON_INFORMATION);
+        return;
+    }
+
+    ScopeDialog dialog{ this, summary, instructions, sourceNames };
+
+    if (dialog.ShowModal() != wxID_OK)
+        return;
+
+    std::size_t row = dialog.ChosenRow();
+
+    // Selecting the match shows it in the preview.
+    if (row < matches.Size())
+    {
+        long item = static_cast<long>(row);
+
+        for (long selected = resultListView->GetFirstSelected();
+             selected != -1;
+             selected = resultListView->GetNextSelected(selected))
+        {
+            resultListView->Select(selected, false);
+        }
+
+        resultListView->Select(item);
+        resultListView->Focus(item);
+    }
+}
+
+void MainWindow::OnResultSelected(wxListEvent& event)
+{
+    std::size_t row = static_cast<std::size_t>(event.GetIndex());
+
+    if (row < matches.Size())
+    {
+        ShowPreview(matches.FileId(row), matches.LineNumber(row),
+                    matches.Offset(row));
+    }
+}
+
+void MainWindow::ShowPreview(std::uint32_t file, std::uint32_t line,
+                             std::uint64_t offset)
+{
+    const SourceFile& source = sources[file];
+
+    // The lines before are found by reading back from the line itself, so
+    // a preview only ever reads the few lines it shows.
+    std::uint64_t begin{ offset };
+    std::uint32_t number{ line };
+
+    while (number > 1 && line - number < previewContext)
+    {
+        begin = source.LineBefore(begin);
+        number--;
+    }
+
+    wxString text;
+    long highlightBegin{ 0 };
+    long highlightEnd{ 0 };
+
+    // The preview stops at the end of the text that is ready, so it never
+    // waits for a compressed file that is still being decompressed.
+    for (; number <= line + previewContext && begin < source.ReadySize();
+         number++)
+    {
+        if (number == line)
+            highlightBegin = static_cast<long>(text.length());
+
+        text << wxString::Format("%8u  ", number) << source.LineText(begin);
+
+        if (number == line)
+            highlightEnd = static_cast<long>(text.length());
+
+        text << '\n';
+        begin = source.LineAfter(begin);
+    }
+
+    previewTextCtrl->ChangeValue(text);
+    previewTextCtrl->SetStyle(highlightBegin, highlightEnd,
+                              wxTextAttr{ *wxBLACK, *wxYELLOW });
+    previewTextCtrl->ShowPosition(highlightBegin);
+}
+
+void MainWindow::OnStatistics(wxCommandEvent& event)
+{
+    StatisticsDialog dialog{ this, statistics };
+    dialog.ShowModal();
+}
+
+void MainWindow::OnAnalyze(wxCommandEvent& event)
+{
+    StartSearch(SearchMode::Analyze);
+}
+
+void MainWindow::StartSearch(SearchMode mode)
+{
+    if (mode != SearchMode::Compare)
+        baselinePath.clear();
+
+    // The old matches point into the old files, so they are cleared before
+    // the files are opened again.
     ClearInstructionCounts();
+    UpdateControls();
+    statistics.Reset();
+
+    {
+        ScopedTimer timer{ &statistics, SearchStatistics::Phase::Open };
+
+        if (!OpenSources())
+            return;
+    }
+
+    searching = true;
+    cancelSearch = false;
+    UpdateControls();
+    progressGauge->SetValue(0);
+    SetStatusText("Searching...");
+
+    searchEngine.SetThreadCount(threadsSpinCtrl->GetValue());
+    searchEngine.SetUseIndex(indexCheckBox->GetValue());
+    searchEngine.SetDialect(
+        Dialect{ Dialect::kinds[dialectChoice->GetSelection()] });
+    searchEngine.SetCancelFlag(&cancelSearch);
+    searchEngine.SetStatistics(&statistics);
+
+    // The search fills in its own match table while the window keeps using
+    // its own. The new matches are posted back to the window as each part
+    // of the files is done, which is how they show up before the search
+    // finishes. The source files aren't changed until the next search, so
+    // both threads can read them.
+    SearchEngine engine{ searchEngine };
+    std::vector<Instruction> searchInstructions{ instructions };
+
+    // The line and scope tables are only read once the search is done.
+    // Updates of a watched file don't keep them, since their lines move.
+    engine.SetLineTables(&lineTables);
+    engine.SetScopeTables(&scopeTables);
+
+    engine.SetProgressCallback([this](const SearchProgress& progress,
+                                      const MatchTable& found,
+                                      std::size_t firstRow) {
+        MatchTable newMatches;
+        newMatches.Append(found, firstRow);
+        CallAfter([this, progress, newMatches]() {
+            OnSearchProgress(progress, newMatches);
+        });
+    });
+
+    // The signature of a watched file is taken while it is still in memory
+    // from the search, so later changes can be found by comparing to it.
+    // A comparison searches the baseline first, so it has no signature and
+    // the first change searches the open file on its own again.
+    bool watch = watchCheckBox->GetValue() && !pathIsFolder &&
+        mode != SearchMode::Compare;
+
+    searchThread = std::thread{ [this, engine, searchInstructions, watch,
+                                 mode]() {
+        MatchTable found;
+        MnemonicHistogram counted;
+        UsageComparison compared;
+
+        if (mode == SearchMode::Analyze)
+            engine.Analyze(sources, searchInstructions, found, counted);
+        else
+            engine.Search(sources, searchInstructions, found);
+
+        if (mode == SearchMode::Compare && !cancelSearch)
+        {
+            compared.Compare(found, searchInstructions.size(),
+                             scopeTables[0], scopeTables[1]);
+        }
+
+        FileSignature searched;
+
+        if (watch && !cancelSearch)
+        {
+            searched.Compute(sources[0].Data(), sources[0].Size(),
+                             engine.ThreadCount());
+        }
+
+        CallAfter([this, searched, mode, counted, compared]() {
+            signature = searched;
+            histogram = counted;
+            comparison = compared;
+            OnSearchFinished();
+
+            if (mode == SearchMode::Analyze && !cancelSearch)
+                ShowHistogram();
+            else if (mode == SearchMode::Compare && !cancelSearch)
+                ShowComparison();
+        });
+    } };
+}
+
+bool MainWindow::OpenSources()
+{
+    std::vector<wxString> paths;
+
+    if (!pathIsFolder)
+    {
+        if (!baselinePath.IsEmpty())
+            paths.push_back(baselinePath);
+
+        paths.push_back(path);
+    }
+    else
+    {
+        wxBusyCursor busy;
+        SetStatusText("Finding files...");
+
+        FileFinder finder;
+        finder.SetIncludePatterns(includeTextCtrl->GetValue());
+        finder.SetExcludePatterns(excludeTextCtrl->GetValue());
+
+        if (!finder.Find(path, paths) || paths.empty())
+        {
+            SetStatusText("Ready");
+            wxMessageBox("No files to search were found in " + path,
+                         "AsmFinder", wxOK | wxICON_INFORMATION);
+            return false;
+        }
+    }
+
+    // The files are opened in place, since they can't be moved once open.
+    // A watched file is read rather than mapped, since a build can truncate
+    // it while its results are shown, and on Windows a mapped file can't be
+    // truncated or replaced at all.
+    bool watch = watchCheckBox->GetValue() && !pathIsFolder;
+    sources = std::vector<SourceFile>(paths.size());
+    sourceNames.clear();
+    std::size_t failed{ 0 };
+    wxString unreadable;
+
+    for (std::size_t i = 0; i < paths.size(); i++)
+    {
+        wxFileName name{ paths[i] };
+
+        if (pathIsFolder)
+            name.MakeRelativeTo(path);
+
+        sourceNames.push_back(name.GetFullPath());
+
+        if (!sources[i].Open(paths[i], !watch))
+        {
+            unreadable = paths[i];
+            failed++;
+        }
+    }
+
+    if (!pathIsFolder && failed > 0)
+    {
+        wxMessageBox("Unable to read " + unreadable, "AsmFinder",
+                     wxOK | wxICON_ERROR);
+        return false;
+    }
+
+    // A file that can't be read is searched as if it were empty, so the
+    // rest of the folder is still searched.
+    if (failed > 0)
+    {
+        wxString message;
+        message << "Unable to read " << failed << " of " << paths.size();
+        message << " files. The rest will be searched.";
+        wxMessageBox(message, "AsmFinder", wxOK | wxICON_WARNING);
+    }
+
+    return true;
+}
+
+void MainWindow::OnSearchProgress(const SearchProgress& progress,
+                                  const MatchTable& newMatches)
+{
+    ScopedTimer timer{ &statistics, SearchStatistics::Phase::Display };
+    statistics.Add(SearchStatistics::Counter::Updates);
+    matches.Append(newMatches);
+    UpdateInstructionListView();
+    UpdateResultListView();
+
+    if (progress.totalBytes > 0)
+    {
+        // The size of a compressed file is only a guess until all of it
+        // has been read, so the fraction can briefly pass the end.
+        double fraction = std::min(
+            static_cast<double>(progress.bytesScanned) / progress.totalBytes,
+            1.0);
+        progressGauge->SetValue(static_cast<int>(fraction * 1000));
+    }
+    else
+    {
+        progressGauge->Pulse();
+    }
+
+    wxString status;
+    status << "Searching... " << progress.linesScanned << " lines, ";
+    status << progress.matchCount << " matches";
+
+    if (progress.fileCount > 1)
+    {
+        status << ", " << progress.filesScanned << " of ";
+        status << progress.fileCount << " files";
+    }
+
+    SetStatusText(status);
+}
+
+void MainWindow::OnSearchFinished()
+{
+    searchThread.join();
+    searching = false;
+    statistics.Finish();
+    EnableControls();
+
+    wxString status;
+
+    if (cancelSearch)
+    {
+        status << "Search cancelled with " << matches.Size();
+        status << " matches found so far";
+    }
+    else
+    {
+        status << "Search complete with " << matches.Size() << " matches";
+
+        if (sources.size() > 1)
+            status << " in " << sources.size() << " files";
+
+        progressGauge->SetValue(progressGauge->GetRange());
+    }
+
+    status << ", " << statistics.Summary();
+    SetStatusText(status);
+
+    // A damaged compressed file is searched up to the damage, which is
+    // only known once all of it has been read.
+    std::size_t damaged{ 0 };
+
+    for (std::size_t i = 0; i < sources.size() && !cancelSearch; i++)
+    {
+        if (sources[i].HasReadError())
+            damaged++;
+    }
+
+    if (damaged > 0)
+    {
+        wxString message;
+        message << "Unable to read all of " << damaged << " compressed ";
+        message << (damaged == 1 ? "file" : "files");
+        message << ". The results only include the lines before the damage.";
+        wxMessageBox(message, "AsmFinder", wxOK | wxICON_WARNING);
+    }
+
+    if (watchCheckBox->GetValue() && !pathIsFolder)
+        StartWatching();
+}
 
-    wxTextFile asmFile;
-    asmFile.Open(path);
+void MainWindow::ShowHistogram()
+{
+    HistogramDialog dialog{ this, histogram, sourceNames };
+
+    if (dialog.ShowModal() != wxID_OK)
+        return;
 
-    std::vector<Line> lines;
-    int currentLineNum{ 1 };
-    Line currentLine{ currentLineNum, asmFile.GetFirstLine() };
-    lines.push_back(currentLine);
+    std::vector<Instruction> chosen;
 
-    while (!asmFile.Eof())
+    for (const wxString& mnemonic : dialog.ChosenMnemonics())
     {
-        currentLineNum++;
-        currentLine = Line{ currentLineNum, asmFile.GetNextLine() };
-        lines.push_back(currentLine);
+        // A mnemonic is escaped if it has a character that would make it a
+        // pattern, so it is still only matched as it is.
+        wxString name;
+
+        for (wxUniChar c : mnemonic)
+        {
+            if (wxString{ "*?[|\\" }.Find(c) != wxNOT_FOUND)
+                name << '\\';
+
+            name << c;
+        }
+
+        chosen.push_back(Instruction{ name, wxString{} });
     }
 
-    asmFile.Close();
+    AddInstructions(chosen);
+}
 
-    for (auto& line : lines)
-        MatchInstructions(line);
+void MainWindow::ShowComparison()
+{
+    ComparisonDialog dialog{ this, comparison, instructions, sourceNames[0],
+                             sourceNames[1] };
+    dialog.ShowModal();
+}
+
+void MainWindow::StartWatching()
+{
+    if (!watcher)
+    {
+        watcher = std::make_unique<wxFileSystemWatcher>();
+        watcher->SetOwner(this);
+    }
+
+    // Builds often write a new file and rename it over the old one, which
+    // is only seen by watching the folder the file is in.
+    watcher->RemoveAll();
+    watcher->Add(wxFileName::DirName(wxFileName{ path }.GetPath()),
+                 wxFSW_EVENT_CREATE | wxFSW_EVENT_MODIFY |
+                 wxFSW_EVENT_RENAME);
+}
+
+void MainWindow::StopWatching()
+{
+    if (watcher)
+        watcher->RemoveAll();
+
+    watchTimer.Stop();
+}
 
+void MainWindow::StartUpdate()
+{
+    if (instructions.empty())
+        return;
+
+    // The matches aren't from the file as it was last signed, or not from
+    // the current instructions, so the whole file is searched again.
+    if (!signature.IsValid())
+    {
+        wxCommandEvent event;
+        OnSearch(event);
+        return;
+    }
+
+    // The new version is read alongside the old one, which the results
+    // keep showing until the update is done. Both are copies, so the build
+    // writing the file again changes neither.
+    pendingSources = std::vector<SourceFile>(1);
+
+    if (!pendingSources[0].Open(path, false))
+    {
+        SetStatusText("Waiting for " + path);
+        return;
+    }
+
+    searching = true;
+    cancelSearch = false;
     UpdateControls();
+    progressGauge->Pulse();
+    SetStatusText("Updating...");
+    statistics.Reset();
+
+    SearchEngine engine{ searchEngine };
+    engine.SetThreadCount(threadsSpinCtrl->GetValue());
+    engine.SetCancelFlag(&cancelSearch);
+    std::vector<Instruction> searchInstructions{ instructions };
+    FileSignature before{ signature };
+
+    searchThread = std::thread{ [this, engine, searchInstructions,
+                                 before]() {
+        const SourceFile& source = pendingSources[0];
+        FileSignature after;
+        after.Compute(source.Data(), source.Size(), engine.ThreadCount());
+
+        FileChange change;
+        bool changed = before.Compare(after, source.Data(), change);
+        MatchTable rows;
+
+        if (changed)
+        {
+            engine.Search(source, change.begin, change.newEnd,
+                          change.firstLine, searchInstructions, rows);
+        }
+
+        CallAfter([this, changed, change, rows, after]() {
+            OnUpdateFinished(changed, change, rows, after);
+        });
+    } };
+}
+
+void MainWindow::OnUpdateFinished(bool changed, const FileChange& change,
+                                  const MatchTable& rows,
+                                  const FileSignature& after)
+{
+    searchThread.join();
+    searching = false;
+    statistics.Finish();
+    EnableControls();
+
+    // A cancelled update leaves the old results, which the next change
+    // updates from.
+    if (cancelSearch)
+    {
+        pendingSources.clear();
+        SetStatusText("Update cancelled");
+        return;
+    }
+
+    sources.swap(pendingSources);
+    pendingSources.clear();
+    signature = after;
+
+    if (changed)
+    {
+        Span<std::uint64_t> offsets = matches.Offsets();
+        std::size_t first = std::lower_bound(offsets.begin(), offsets.end(),
+                                             change.begin) - offsets.begin();
+        std::size_t last = std::lower_bound(offsets.begin(), offsets.end(),
+                                            change.oldEnd) - offsets.begin();
+        matches.Splice(first, last, rows, change.lineShift,
+                       change.offsetShift);
+
+        // The lines of the file moved, so its line table is built again
+        // the next time it is needed.
+        lineTables.clear();
+        scopeTables.clear();
+    }
+
+    UpdateInstructionListView();
+    UpdateResultListView();
+    progressGauge->SetValue(progressGauge->GetRange());
+
+    wxString status;
+
+    if (changed)
+    {
+        status << "Updated " << change.newEnd - change.begin << " of ";
+        status << after.Size() << " bytes with " << matches.Size();
+        status << " matches";
+    }
+    else
+    {
+        status << "File unchanged with " << matches.Size() << " matches";
+    }
+
+    status << ", " << statistics.Summary();
+    SetStatusText(status);
+}
+
+void MainWindow::OnDialect(wxCommandEvent& event)
+{
+    // The matches were found with the old dialect, so a change to the
+    // watched file is searched in full.
+    signature = FileSignature{};
+}
+
+void MainWindow::OnWatch(wxCommandEvent& event)
+{
+    // Until the file has been searched with watching on there is nothing
+    // to compare a change to, so the first change searches all of it. The
+    // results keep showing the file until then, so its text is copied out
+    // of the mapping before the build can change it.
+    if (watchCheckBox->GetValue() && !pathIsFolder && !path.IsEmpty())
+    {
+        for (SourceFile& source : sources)
+            source.Detach();
+
+        StartWatching();
+    }
+    else
+    {
+        StopWatching();
+    }
+}
+
+void MainWindow::OnFileSystemChange(wxFileSystemWatcherEvent& event)
+{
+    wxFileName file{ path };
+
+    if (event.GetPath().SameAs(file) || event.GetNewPath().SameAs(file))
+        watchTimer.StartOnce(watchDelay);
+}
+
+void MainWindow::OnWatchTimer(wxTimerEvent& event)
+{
+    // A change during a search is picked up once the search is done.
+    if (searching)
+    {
+        watchTimer.StartOnce(watchDelay);
+        return;
+    }
+
+    StartUpdate();
+}
+
+void MainWindow::OnCancel(wxCommandEvent& event)
+{
+    cancelSearch = true;
+    SetStatusText("Cancelling...");
+}
+
+void MainWindow::OnStatusBarSize(wxSizeEvent& event)
+{
+    wxRect rect;
+
+    if (GetStatusBar()->GetFieldRect(1, rect))
+        progressGauge->SetSize(rect);
 
-    wxMessageBox("Complete", "AsmFinder", wxOK | wxICON_INFORMATION);
+    event.Skip();
 }
 
 void MainWindow::OnAbout(wxCommandEvent& event)
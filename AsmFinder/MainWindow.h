@@ -17,11 +17,30 @@
 #ifndef MAIN_WINDOW_H
 #define MAIN_WINDOW_H
 
+#include <atomic>
+#include <memory>
+#include <thread>
 #include <vector>
 #include <wx/wx.h>
+#include <wx/filename.h>
+#include <wx/fswatcher.h>
 #include <wx/listctrl.h>
-#include <wx/textfile.h>
+#include <wx/spinctrl.h>
+#include "FileFinder.h"
+#include "FileSignature.h"
 #include "Instruction.h"
+#include "InstructionListView.h"
+#include "InstructionSet.h"
+#include "LineTable.h"
+#include "MnemonicHistogram.h"
+#include "Pattern.h"
+#include "ResultListView.h"
+#include "ResultWriter.h"
+#include "ScopeSummary.h"
+#include "ScopeTable.h"
+#include "SearchEngine.h"
+#include "SearchStatistics.h"
+#include "UsageComparison.h"
 #include "Version.h"
 
 enum ID
@@ -31,7 +50,17 @@ enum ID
     Import = 3,
     Export = 4,
     Add = 5,
-    Search = 6
+    Search = 6,
+    Cancel = 7,
+    OpenFolder = 8,
+    Watch = 9,
+    ChooseDialect = 10,
+    Analyze = 11,
+    Statistics = 12,
+    GoToLine = 13,
+    Compare = 14,
+    Scopes = 15,
+    FirstInstructionSet = 100
 };
 
 /// @brief Represents the main window of the application.
@@ -40,26 +69,69 @@ class MainWindow : public wxFrame
 public:
     /// @brief Default constructor; creates a new instance of MainWindow.
     MainWindow();
+
+    /// @brief Destructor; stops a search that is still running.
+    ~MainWindow() override;
 private:
+    /// @brief What a search does besides finding the instructions.
+    enum class SearchMode
+    {
+        Search,
+        Analyze,
+        Compare
+    };
+
     wxString version;
     wxString path;
+    wxString baselinePath;
+    bool pathIsFolder{ false };
     wxPanel* panel;
     wxStaticText* nameLabel;
     wxStaticText* descriptionLabel;
     wxStaticText* fileLabel;
-    wxListView* instructionListView;
-    wxListView* resultListView;
+    wxStaticText* threadsLabel;
+    wxStaticText* dialectLabel;
+    wxStaticText* includeLabel;
+    wxStaticText* excludeLabel;
+    InstructionListView* instructionListView;
+    ResultListView* resultListView;
     wxTextCtrl *nameTextCtrl;
     wxTextCtrl *descriptionTextCtrl;
+    wxTextCtrl* includeTextCtrl;
+    wxTextCtrl* excludeTextCtrl;
+    wxTextCtrl* previewTextCtrl;
     wxButton *addButton;
     wxButton *searchButton;
+    wxButton* analyzeButton;
+    wxButton *cancelButton;
+    wxSpinCtrl *threadsSpinCtrl;
+    wxCheckBox* indexCheckBox;
+    wxChoice* dialectChoice;
+    wxCheckBox* watchCheckBox;
     wxBoxSizer* addInstructionSizer;
     wxBoxSizer* searchInstructionSizer;
+    wxBoxSizer* filterSizer;
     wxStaticBoxSizer* topSizer;
     wxStaticBoxSizer* bottomSizer;
     wxBoxSizer* panelSizer;
+    wxGauge* progressGauge;
     std::vector<Instruction> instructions;
-    std::vector<Line> results;
+    SearchStatistics statistics;
+    SearchEngine searchEngine;
+    std::vector<SourceFile> sources;
+    std::vector<wxString> sourceNames;
+    MatchTable matches;
+    std::vector<LineTable> lineTables;
+    std::vector<ScopeTable> scopeTables;
+    MnemonicHistogram histogram;
+    UsageComparison comparison;
+    std::unique_ptr<wxFileSystemWatcher> watcher;
+    wxTimer watchTimer;
+    FileSignature signature;
+    std::vector<SourceFile> pendingSources;
+    std::thread searchThread;
+    std::atomic<bool> cancelSearch{ false };
+    bool searching{ false };
 
     /// @brief Initializes the version string for use in the title and about. 
     void InitVersion();
@@ -92,15 +164,60 @@ private:
     /// @brief Updates the results list view with the latest info.
     void UpdateResultListView();
 
-    /// @brief Matches the line to any matching instructions.
-    /// @param line The line to attempt to match.
-    void MatchInstructions(const Line& line);
+    /// @brief Stops the search thread if one is running.
+    /// @post The search thread has finished.
+    void StopSearch();
+
+    /// @brief Searches the files on the search thread.
+    /// @param mode Search to only find the instructions, Analyze to also
+    /// count every mnemonic in the files, or Compare to search the baseline
+    /// along with the open file and compare them. The mnemonics or the
+    /// comparison are shown once the search is done.
+    void StartSearch(SearchMode mode);
+
+    /// @brief Opens the files to search, with the baseline first when
+    /// comparing.
+    /// @return True if there is at least one file to search, otherwise
+    /// false.
+    bool OpenSources();
+
+    /// @brief Adds matches reported by the search thread to the results.
+    /// @param progress How far the search has got.
+    /// @param newMatches The matches found since the last report.
+    void OnSearchProgress(const SearchProgress& progress,
+                          const MatchTable& newMatches);
+
+    /// @brief Finishes a search once the search thread is done.
+    void OnSearchFinished();
+
+    /// @brief Shows the mnemonics counted by an analysis and adds the ones
+    /// the user chooses to the instructions.
+    void ShowHistogram();
+
+    /// @brief Shows how the count of each instruction changed from the
+    /// baseline to the open file.
+    void ShowComparison();
+
+    /// @brief Starts watching the open file for changes.
+    void StartWatching();
+
+    /// @brief Stops watching the open file for changes.
+    void StopWatching();
+
+    /// @brief Searches the parts of the open file that changed since the
+    /// last search on the search thread.
+    void StartUpdate();
 
-    /// @brief Parses instruction definitions read from a file.
-    /// @param line The line to parse.
-    void ParseInstructionDefinition(wxString line);
+    /// @brief Puts the matches in the changed parts of the file in place of
+    /// the old ones once the search thread is done.
+    /// @param changed True if the file changed, otherwise false.
+    /// @param change The lines that changed.
+    /// @param rows The matches in the lines that changed.
+    /// @param after The signature of the file as it is now.
+    void OnUpdateFinished(bool changed, const FileChange& change,
+                          const MatchTable& rows, const FileSignature& after);
 
-    /// @brief Clears any previously matches lines from each instruction.
+    /// @brief Clears the matches of a previous search.
     void ClearInstructionCounts();
 
     /// @brief Event handler for the Help -> About menu item.
@@ -111,6 +228,10 @@ private:
     /// @param event The triggering event.
     void OnOpen(wxCommandEvent& event);
 
+    /// @brief Event handler for the File -> Open Folder menu item.
+    /// @param event The triggering event.
+    void OnOpenFolder(wxCommandEvent& event);
+
     /// @brief Event handler for the File -> Import menu item.
     /// @param event The triggering event.
     void OnImport(wxCommandEvent& event);
@@ -119,6 +240,44 @@ private:
     /// @param event The triggering event.
     void OnExport(wxCommandEvent& event);
 
+    /// @brief Event handler for the File -> Compare With Baseline menu
+    /// item.
+    /// @param event The triggering event.
+    void OnCompare(wxCommandEvent& event);
+
+    /// @brief Event handler for the View -> Search Statistics menu item.
+    /// @param event The triggering event.
+    void OnStatistics(wxCommandEvent& event);
+
+    /// @brief Event handler for the View -> Matches by Function menu item.
+    /// @param event The triggering event.
+    void OnScopes(wxCommandEvent& event);
+
+    /// @brief Event handler for the View -> Go to Line menu item.
+    /// @param event The triggering event.
+    void OnGoToLine(wxCommandEvent& event);
+
+    /// @brief Event handler for selecting a row of the result list.
+    /// @param event The triggering event.
+    void OnResultSelected(wxListEvent& event);
+
+    /// @brief Shows a line of a file in the preview, between the lines
+    /// around it.
+    /// @param file The position of the file in the files searched.
+    /// @param line The number of the line.
+    /// @param offset The offset of the first byte of the line.
+    void ShowPreview(std::uint32_t file, std::uint32_t line,
+                     std::uint64_t offset);
+
+    /// @brief Event handler for the File -> Add Instruction Set menu items.
+    /// @param event The triggering event.
+    void OnInstructionSet(wxCommandEvent& event);
+
+    /// @brief Adds instructions that aren't already in the list and shows
+    /// them all at once.
+    /// @param added The instructions to add.
+    void AddInstructions(const std::vector<Instruction>& added);
+
     /// @brief Event handler for the Add button.
     /// @param event The triggering event.
     void OnAdd(wxCommandEvent& event);
@@ -127,6 +286,35 @@ private:
     /// @param event The triggering event.
     void OnSearch(wxCommandEvent& event);
 
+    /// @brief Event handler for the Analyze button.
+    /// @param event The triggering event.
+    void OnAnalyze(wxCommandEvent& event);
+
+    /// @brief Event handler for the Dialect choice.
+    /// @param event The triggering event.
+    void OnDialect(wxCommandEvent& event);
+
+    /// @brief Event handler for the Watch check box.
+    /// @param event The triggering event.
+    void OnWatch(wxCommandEvent& event);
+
+    /// @brief Event handler for changes in the open file's folder.
+    /// @param event The triggering event.
+    void OnFileSystemChange(wxFileSystemWatcherEvent& event);
+
+    /// @brief Event handler for the timer that waits for a changed file to
+    /// stop changing.
+    /// @param event The triggering event.
+    void OnWatchTimer(wxTimerEvent& event);
+
+    /// @brief Event handler for the Cancel button.
+    /// @param event The triggering event.
+    void OnCancel(wxCommandEvent& event);
+
+    /// @brief Event handler for status bar size changes.
+    /// @param event The triggering event.
+    void OnStatusBarSize(wxSizeEvent& event);
+
     /// @brief Event handler for the File -> Save menu item.
     /// @param event The triggering event.
     void OnSave(wxCommandEvent& event);
@@ -0,0 +1,138 @@
+// MappedFile.cpp - Defines the MappedFile class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const wxString& path)
+{
+    Close();
+
+    HANDLE file = CreateFileW(path.wc_str(), GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    // An empty file can't be mapped, but it is still a valid file to scan.
+    if (fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0,
+                                        nullptr);
+    CloseHandle(file);
+
+    if (mapping == nullptr)
+        return false;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    // The view keeps the mapping alive, so the handle isn't needed anymore.
+    CloseHandle(mapping);
+
+    if (view == nullptr)
+        return false;
+
+    data = static_cast<const char*>(view);
+    size = static_cast<std::size_t>(fileSize.QuadPart);
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (data != nullptr)
+        UnmapViewOfFile(data);
+
+    data = nullptr;
+    size = 0;
+}
+
+#else
+
+bool MappedFile::Open(const wxString& path)
+{
+    Close();
+
+    int descriptor = open(path.fn_str(), O_RDONLY);
+
+    if (descriptor == -1)
+        return false;
+
+    struct stat status;
+
+    if (fstat(descriptor, &status) == -1)
+    {
+        close(descriptor);
+        return false;
+    }
+
+    // An empty file can't be mapped, but it is still a valid file to scan.
+    if (status.st_size == 0)
+    {
+        close(descriptor);
+        return true;
+    }
+
+    std::size_t fileSize = static_cast<std::size_t>(status.st_size);
+    void* view = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+    // The mapping stays valid after the descriptor is closed.
+    close(descriptor);
+
+    if (view == MAP_FAILED)
+        return false;
+
+    // The file is read front to back once, so let the kernel read ahead.
+    madvise(view, fileSize, MADV_SEQUENTIAL);
+
+    data = static_cast<const char*>(view);
+    size = fileSize;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (data != nullptr)
+        munmap(const_cast<char*>(data), size);
+
+    data = nullptr;
+    size = 0;
+}
+
+#endif
@@ -0,0 +1,59 @@
+// MappedFile.h - Declares the MappedFile class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <wx/string.h>
+
+/// @brief Represents a read-only view of a file mapped into memory.
+class MappedFile
+{
+public:
+    /// @brief Default constructor; creates a MappedFile with nothing mapped.
+    MappedFile() = default;
+
+    /// @brief Destructor; unmaps the file if it is mapped.
+    ~MappedFile() { Close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// @brief Maps the specified file into memory.
+    /// @param path The path of the file to map.
+    /// @return True if the file was mapped, otherwise false.
+    /// @post Data() points to the contents of the file if it was mapped.
+    bool Open(const wxString& path);
+
+    /// @brief Unmaps the file.
+    /// @post Data() is nullptr and Size() is zero.
+    void Close();
+
+    /// @brief Gets the contents of the file.
+    /// @return A pointer to the first byte of the file, or nullptr if the
+    /// file is empty or not mapped.
+    const char* Data() const { return data; }
+
+    /// @brief Gets the size of the file.
+    /// @return The size of the file in bytes.
+    std::size_t Size() const { return size; }
+private:
+    const char* data{ nullptr };
+    std::size_t size{ 0 };
+};
+
+#endif
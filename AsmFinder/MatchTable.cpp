@@ -0,0 +1,186 @@
+// MatchTable.cpp - Defines the MatchTable class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MatchTable.h"
+
+void MatchTable::Reset(std::size_t instructionCount)
+{
+    lines = std::vector<std::uint32_t>{};
+    offsets = std::vector<std::uint64_t>{};
+    instructionIds = std::vector<std::uint32_t>{};
+    files = std::vector<std::uint32_t>{};
+    counts.assign(instructionCount, 0);
+    fileCounts.assign(instructionCount, 0);
+    lastFiles.assign(instructionCount, 0);
+    rowsByInstruction = std::vector<std::uint32_t>{};
+    rowsCurrent = false;
+}
+
+void MatchTable::Add(std::uint32_t instruction, std::uint32_t line,
+                     std::uint64_t offset, std::uint32_t file)
+{
+    if (file != 0 && files.empty())
+        files.assign(Size(), 0);
+
+    lines.push_back(line);
+    offsets.push_back(offset);
+    instructionIds.push_back(instruction);
+
+    if (!files.empty())
+        files.push_back(file);
+
+    if (instruction >= counts.size())
+    {
+        counts.resize(instruction + 1, 0);
+        fileCounts.resize(instruction + 1, 0);
+        lastFiles.resize(instruction + 1, 0);
+    }
+
+    // The last file is stored one past its position, so zero means the
+    // instruction hasn't matched in any file yet.
+    if (lastFiles[instruction] != file + 1)
+    {
+        lastFiles[instruction] = file + 1;
+        fileCounts[instruction]++;
+    }
+
+    counts[instruction]++;
+    rowsCurrent = false;
+}
+
+void MatchTable::Append(const MatchTable& other, std::size_t first)
+{
+    for (std::size_t row = first; row < other.Size(); row++)
+    {
+        Add(other.instructionIds[row], other.lines[row], other.offsets[row],
+            other.FileId(row));
+    }
+}
+
+void MatchTable::Splice(std::size_t first, std::size_t last,
+                        const MatchTable& replacement, std::int64_t lineShift,
+                        std::int64_t offsetShift)
+{
+    for (std::size_t row = first; row < last; row++)
+        counts[instructionIds[row]]--;
+
+    for (std::size_t row = last; row < Size(); row++)
+    {
+        lines[row] = static_cast<std::uint32_t>(lines[row] + lineShift);
+        offsets[row] = static_cast<std::uint64_t>(offsets[row] + offsetShift);
+    }
+
+    auto replace = [first, last](auto& column, const auto& values) {
+        column.erase(column.begin() + first, column.begin() + last);
+        column.insert(column.begin() + first, values.begin(), values.end());
+    };
+
+    replace(lines, replacement.lines);
+    replace(offsets, replacement.offsets);
+    replace(instructionIds, replacement.instructionIds);
+
+    for (auto instruction : replacement.instructionIds)
+    {
+        if (instruction >= counts.size())
+            counts.resize(instruction + 1, 0);
+
+        counts[instruction]++;
+    }
+
+    // Every match is in the same file, so an instruction is in it if it
+    // matched at all.
+    fileCounts.resize(counts.size());
+    lastFiles.resize(counts.size());
+
+    for (std::size_t i = 0; i < counts.size(); i++)
+    {
+        fileCounts[i] = counts[i] > 0 ? 1 : 0;
+        lastFiles[i] = counts[i] > 0 ? 1 : 0;
+    }
+
+    rowsCurrent = false;
+}
+
+std::size_t MatchTable::FindLine(std::uint32_t file,
+                                 std::uint32_t line) const
+{
+    // The rows are in file order and then in line order, so the first one
+    // that isn't before the line is found by bisecting them.
+    std::size_t first{ 0 };
+    std::size_t last{ Size() };
+
+    while (first < last)
+    {
+        std::size_t middle = first + (last - first) / 2;
+        std::uint32_t middleFile = FileId(middle);
+
+        if (middleFile < file || (middleFile == file && lines[middle] < line))
+            first = middle + 1;
+        else
+            last = middle;
+    }
+
+    return first;
+}
+
+std::size_t MatchTable::Count(std::size_t instruction) const
+{
+    return instruction < counts.size() ? counts[instruction] : 0;
+}
+
+std::size_t MatchTable::FileCount(std::size_t instruction) const
+{
+    return instruction < fileCounts.size() ? fileCounts[instruction] : 0;
+}
+
+Span<std::uint32_t> MatchTable::Rows(std::size_t instruction) const
+{
+    if (instruction >= counts.size())
+        return Span<std::uint32_t>{};
+
+    if (!rowsCurrent)
+        BuildRows();
+
+    return Span<std::uint32_t>{ rowsByInstruction.data() +
+                                instructionStarts[instruction],
+                                counts[instruction] };
+}
+
+void MatchTable::BuildRows() const
+{
+    instructionStarts.assign(counts.size(), 0);
+
+    std::size_t start{ 0 };
+
+    for (std::size_t i = 0; i < counts.size(); i++)
+    {
+        instructionStarts[i] = start;
+        start += counts[i];
+    }
+
+    // Rows are visited in line order, so each instruction's rows end up in
+    // line order too.
+    std::vector<std::size_t> next{ instructionStarts };
+    rowsByInstruction.resize(Size());
+
+    for (std::size_t row = 0; row < Size(); row++)
+    {
+        std::size_t& position = next[instructionIds[row]];
+        rowsByInstruction[position++] = static_cast<std::uint32_t>(row);
+    }
+
+    rowsCurrent = true;
+}
@@ -0,0 +1,156 @@
+// MatchTable.h - Declares the MatchTable class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MATCH_TABLE_H
+#define MATCH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Span.h"
+
+/// @brief Stores the lines that matched a search.
+///
+/// Each match is a row made of a line number, the byte offset of the line
+/// in the source file and the position of the instruction it matched. The
+/// columns are kept in separate arrays, so a match costs 16 bytes and the
+/// text of a line is only read from the source file when it is needed.
+///
+/// When several files are searched at once, each match also records the
+/// position of its file. That column is only stored once a match outside
+/// the first file is added, so searching a single file costs nothing more.
+class MatchTable
+{
+public:
+    /// @brief Removes all the matches.
+    /// @param instructionCount The number of instructions being searched for.
+    /// @post Size() is zero and Count() is zero for every instruction.
+    void Reset(std::size_t instructionCount);
+
+    /// @brief Adds a match after all the others.
+    /// @param instruction The position of the instruction that matched.
+    /// @param line The number of the line that matched.
+    /// @param offset The offset of the line in the source file.
+    /// @param file The position of the source file, which must not be
+    /// before the file of any match already added.
+    void Add(std::uint32_t instruction, std::uint32_t line,
+             std::uint64_t offset, std::uint32_t file = 0);
+
+    /// @brief Adds some of the matches of another table after all of these.
+    /// @param other The table to copy matches from.
+    /// @param first The row of the first match in other to copy.
+    void Append(const MatchTable& other, std::size_t first = 0);
+
+    /// @brief Replaces some of the matches after part of the source file
+    /// changed. Only a table of matches in a single file can be spliced.
+    /// @param first The row of the first match to replace.
+    /// @param last The row after the last match to replace.
+    /// @param replacement The matches to put in their place.
+    /// @param lineShift How far the line numbers of the rows after last
+    /// moved.
+    /// @param offsetShift How far the offsets of the rows after last moved.
+    void Splice(std::size_t first, std::size_t last,
+                const MatchTable& replacement, std::int64_t lineShift,
+                std::int64_t offsetShift);
+
+    /// @brief Gets the number of matches.
+    /// @return The number of rows in the table.
+    std::size_t Size() const { return lines.size(); }
+
+    /// @brief Gets the number of the line a match is on.
+    /// @param row The row of the match.
+    /// @return The line number, starting from 1.
+    std::uint32_t LineNumber(std::size_t row) const { return lines[row]; }
+
+    /// @brief Gets the offset of the line a match is on.
+    /// @param row The row of the match.
+    /// @return The offset of the first byte of the line in the source.
+    std::uint64_t Offset(std::size_t row) const { return offsets[row]; }
+
+    /// @brief Gets the instruction a match is for.
+    /// @param row The row of the match.
+    /// @return The position of the instruction in the instruction list.
+    std::uint32_t InstructionId(std::size_t row) const
+    {
+        return instructionIds[row];
+    }
+
+    /// @brief Gets the file a match is in.
+    /// @param row The row of the match.
+    /// @return The position of the source file in the list searched.
+    std::uint32_t FileId(std::size_t row) const
+    {
+        return files.empty() ? 0 : files[row];
+    }
+
+    /// @brief Gets the line number column.
+    /// @return The line number of every match in row order.
+    Span<std::uint32_t> LineNumbers() const { return lines; }
+
+    /// @brief Gets the offset column.
+    /// @return The line offset of every match in row order.
+    Span<std::uint64_t> Offsets() const { return offsets; }
+
+    /// @brief Gets the instruction column.
+    /// @return The instruction of every match in row order.
+    Span<std::uint32_t> InstructionIds() const { return instructionIds; }
+
+    /// @brief Finds the first match at or after a line.
+    /// @param file The position of the source file.
+    /// @param line The number of the line.
+    /// @return The row of the match, or Size() if every match is before the
+    /// line.
+    std::size_t FindLine(std::uint32_t file, std::uint32_t line) const;
+
+    /// @brief Gets the number of matches for an instruction.
+    /// @param instruction The position of the instruction.
+    /// @return The number of lines the instruction matched.
+    std::size_t Count(std::size_t instruction) const;
+
+    /// @brief Gets the number of files an instruction was found in.
+    /// @param instruction The position of the instruction.
+    /// @return The number of files with at least one match.
+    std::size_t FileCount(std::size_t instruction) const;
+
+    /// @brief Gets the matches for an instruction.
+    /// @param instruction The position of the instruction.
+    /// @return The rows of the instruction's matches in line order. The view
+    /// is invalidated when the table changes.
+    Span<std::uint32_t> Rows(std::size_t instruction) const;
+private:
+    std::vector<std::uint32_t> lines;
+    std::vector<std::uint64_t> offsets;
+    std::vector<std::uint32_t> instructionIds;
+    std::vector<std::uint32_t> files;
+    std::vector<std::size_t> counts;
+
+    // Matches are added in file order, so an instruction is in a new file
+    // whenever its file differs from the one it last matched in.
+    std::vector<std::size_t> fileCounts;
+    std::vector<std::uint32_t> lastFiles;
+
+    // The rows grouped by instruction are only needed when the matches are
+    // listed per instruction, so they are built the first time Rows() is
+    // called after the table changes.
+    mutable std::vector<std::uint32_t> rowsByInstruction;
+    mutable std::vector<std::size_t> instructionStarts;
+    mutable bool rowsCurrent{ false };
+
+    /// @brief Groups the rows by instruction with a counting sort.
+    void BuildRows() const;
+};
+
+#endif
@@ -0,0 +1,113 @@
+// MnemonicHistogram.cpp - Defines the MnemonicHistogram class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "MnemonicHistogram.h"
+
+#include <algorithm>
+
+void MnemonicHistogram::Reset(std::uint32_t windowSize)
+{
+    symbols.Clear();
+    counts.clear();
+    windows.clear();
+    fileWindows = 0;
+    this->windowSize = std::max(windowSize, 1u);
+    instructionCount = 0;
+    lineCount = 0;
+    matchCount = 0;
+}
+
+void MnemonicHistogram::Add(std::string_view mnemonic, std::uint64_t count)
+{
+    std::uint32_t id = symbols.Intern(mnemonic);
+
+    if (id == counts.size())
+        counts.push_back(0);
+
+    counts[id] += count;
+    instructionCount += count;
+}
+
+void MnemonicHistogram::AddLines(std::uint32_t file, std::uint32_t firstLine,
+                                 std::uint32_t lineCount,
+                                 Span<int> instructionLines,
+                                 Span<int> matchLines)
+{
+    if (lineCount == 0)
+        return;
+
+    if (windows.empty() || windows.back().file != file)
+        fileWindows = windows.size();
+
+    // Windows are numbered from the start of their file, so a part that
+    // starts partway through a window adds to the one before it.
+    std::uint32_t lastLine = firstLine + lineCount;
+
+    while (windows.size() == fileWindows ||
+           windows.back().firstLine + windowSize <= lastLine)
+    {
+        if (windows.size() > fileWindows)
+            windows.back().lineCount = windowSize;
+
+        std::uint32_t number = static_cast<std::uint32_t>(windows.size() -
+                                                          fileWindows);
+        windows.push_back(Window{ file, number * windowSize + 1 });
+    }
+
+    windows.back().lineCount = lastLine - windows.back().firstLine + 1;
+
+    for (int line : instructionLines)
+    {
+        std::uint32_t number = firstLine + static_cast<std::uint32_t>(line);
+        windows[fileWindows + (number - 1) / windowSize].instructionCount++;
+    }
+
+    for (int line : matchLines)
+    {
+        std::uint32_t number = firstLine + static_cast<std::uint32_t>(line);
+        windows[fileWindows + (number - 1) / windowSize].matchCount++;
+    }
+
+    this->lineCount += lineCount;
+    matchCount += matchLines.size();
+}
+
+std::vector<std::size_t> MnemonicHistogram::HotWindows(
+    std::size_t count) const
+{
+    // Windows are compared by what was found in them rather than by
+    // density, so the short window at the end of a file, or a file with
+    // only a few lines, doesn't outrank every full one.
+    auto found = [&](std::size_t i) {
+        return matchCount > 0 ? windows[i].matchCount
+                              : windows[i].instructionCount;
+    };
+
+    std::vector<std::size_t> hot(windows.size());
+
+    for (std::size_t i = 0; i < hot.size(); i++)
+        hot[i] = i;
+
+    count = std::min(count, hot.size());
+    std::partial_sort(hot.begin(), hot.begin() + count, hot.end(),
+                      [&](std::size_t a, std::size_t b) {
+        return found(a) != found(b) ? found(a) > found(b) : a < b;
+    });
+    hot.resize(count);
+
+    return hot;
+}
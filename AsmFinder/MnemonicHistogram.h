@@ -0,0 +1,132 @@
+// MnemonicHistogram.h - Declares the MnemonicHistogram class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef MNEMONIC_HISTOGRAM_H
+#define MNEMONIC_HISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include "Span.h"
+#include "SymbolTable.h"
+
+/// @brief Counts every mnemonic in the files searched and how densely the
+/// instructions and matches are packed in each part of them.
+///
+/// Each file is divided into windows of a fixed number of lines. A window
+/// with many more matches than the others is a hot region worth looking at
+/// first.
+class MnemonicHistogram
+{
+public:
+    /// @brief A run of lines in a file and what was found in it.
+    struct Window
+    {
+        std::uint32_t file{ 0 };
+        std::uint32_t firstLine{ 0 };
+        std::uint32_t lineCount{ 0 };
+        std::uint32_t instructionCount{ 0 };
+        std::uint32_t matchCount{ 0 };
+    };
+
+    /// @brief The number of lines in a window unless another is set.
+    static constexpr std::uint32_t defaultWindowSize{ 1000 };
+
+    /// @brief Removes everything that was counted.
+    /// @param windowSize The number of lines in each window.
+    /// @post MnemonicCount() is zero and Windows() is empty.
+    void Reset(std::uint32_t windowSize = defaultWindowSize);
+
+    /// @brief Counts lines with a mnemonic.
+    /// @param mnemonic The mnemonic. Only the case of ASCII letters is
+    /// ignored.
+    /// @param count The number of lines that have it.
+    void Add(std::string_view mnemonic, std::uint64_t count);
+
+    /// @brief Counts the lines of part of a file. The parts of each file
+    /// must be added in order, one file after another.
+    /// @param file The position of the file.
+    /// @param firstLine The number of lines in the file before the part.
+    /// @param lineCount The number of lines in the part.
+    /// @param instructionLines The number of each line in the part that has
+    /// a mnemonic, counted from 1 at the start of the part.
+    /// @param matchLines The number of each line in the part that matched
+    /// an instruction, counted the same way.
+    void AddLines(std::uint32_t file, std::uint32_t firstLine,
+                  std::uint32_t lineCount, Span<int> instructionLines,
+                  Span<int> matchLines);
+
+    /// @brief Gets the number of distinct mnemonics.
+    /// @return The number of mnemonics, which are numbered from zero in the
+    /// order they were first found.
+    std::size_t MnemonicCount() const { return counts.size(); }
+
+    /// @brief Gets a mnemonic.
+    /// @param mnemonic The number of the mnemonic.
+    /// @return The mnemonic, with its ASCII letters lowercase.
+    std::string_view Mnemonic(std::size_t mnemonic) const
+    {
+        return symbols.Name(static_cast<std::uint32_t>(mnemonic));
+    }
+
+    /// @brief Gets how many lines have a mnemonic.
+    /// @param mnemonic The number of the mnemonic.
+    /// @return The number of lines.
+    std::uint64_t Count(std::size_t mnemonic) const
+    {
+        return counts[mnemonic];
+    }
+
+    /// @brief Gets the windows of every file.
+    /// @return The windows in file order and then line order.
+    const std::vector<Window>& Windows() const { return windows; }
+
+    /// @brief Gets the number of lines in each window.
+    /// @return The number of lines in all but the last window of a file.
+    std::uint32_t WindowSize() const { return windowSize; }
+
+    /// @brief Gets the number of lines with a mnemonic.
+    /// @return The total of every mnemonic's count.
+    std::uint64_t InstructionCount() const { return instructionCount; }
+
+    /// @brief Gets the number of lines that matched an instruction.
+    /// @return The total of every window's match count.
+    std::uint64_t MatchCount() const { return matchCount; }
+
+    /// @brief Gets the number of lines counted.
+    /// @return The number of lines in every file.
+    std::uint64_t LineCount() const { return lineCount; }
+
+    /// @brief Finds the windows with the most matches, or the most
+    /// instructions when nothing matched. Windows with the same count are
+    /// in line order.
+    /// @param count The most windows to return.
+    /// @return The positions of the windows, densest first.
+    std::vector<std::size_t> HotWindows(std::size_t count) const;
+private:
+    SymbolTable symbols;
+    std::vector<std::uint64_t> counts;
+    std::vector<Window> windows;
+    std::size_t fileWindows{ 0 };
+    std::uint32_t windowSize{ defaultWindowSize };
+    std::uint64_t instructionCount{ 0 };
+    std::uint64_t lineCount{ 0 };
+    std::uint64_t matchCount{ 0 };
+};
+
+#endif
@@ -0,0 +1,121 @@
+// MnemonicListView.cpp - Defines the MnemonicListView class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "MnemonicListView.h"
+
+#include <algorithm>
+
+MnemonicListView::MnemonicListView(wxWindow* parent,
+                                   const MnemonicHistogram& histogram)
+    : wxListView{ parent, wxID_ANY, wxDefaultPosition, wxSize{ 360, 300 },
+                  wxLC_REPORT | wxLC_VIRTUAL },
+      histogram{ histogram }, order(histogram.MnemonicCount())
+{
+    AppendColumn("Mnemonic", wxLIST_FORMAT_LEFT, 160);
+    AppendColumn("Count", wxLIST_FORMAT_RIGHT, 100);
+    AppendColumn("Share", wxLIST_FORMAT_RIGHT, 80);
+
+    for (std::size_t i = 0; i < order.size(); i++)
+        order[i] = i;
+
+    Sort();
+    Bind(wxEVT_LIST_COL_CLICK, &MnemonicListView::OnColumnClick, this);
+}
+
+std::vector<std::size_t> MnemonicListView::SelectedMnemonics() const
+{
+    std::vector<std::size_t> selected;
+
+    for (long item = GetFirstSelected(); item != -1;
+         item = GetNextSelected(item))
+    {
+        selected.push_back(order[static_cast<std::size_t>(item)]);
+    }
+
+    return selected;
+}
+
+wxString MnemonicListView::OnGetItemText(long item, long column) const
+{
+    std::size_t mnemonic = order[static_cast<std::size_t>(item)];
+
+    switch (column)
+    {
+    case Column::Mnemonic:
+    {
+        std::string_view name = histogram.Mnemonic(mnemonic);
+        return wxString::FromUTF8(name.data(), name.size());
+    }
+    case Column::Count:
+    {
+        wxString count;
+        count << histogram.Count(mnemonic);
+        return count;
+    }
+    case Column::Share:
+    {
+        double share = histogram.InstructionCount() > 0
+            ? 100.0 * histogram.Count(mnemonic) / histogram.InstructionCount()
+            : 0;
+        return wxString::Format("%.2f%%", share);
+    }
+    default:
+        return wxString{};
+    }
+}
+
+void MnemonicListView::Sort()
+{
+    // The share is the count over the same total, so both columns sort the
+    // same way. Equal counts are kept in mnemonic order.
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        std::size_t first = ascending ? a : b;
+        std::size_t second = ascending ? b : a;
+
+        if (sortColumn == Column::Mnemonic)
+            return histogram.Mnemonic(first) < histogram.Mnemonic(second);
+
+        if (histogram.Count(first) != histogram.Count(second))
+            return histogram.Count(first) < histogram.Count(second);
+
+        return histogram.Mnemonic(a) < histogram.Mnemonic(b);
+    });
+
+    SetItemCount(static_cast<long>(order.size()));
+    Refresh();
+}
+
+void MnemonicListView::OnColumnClick(wxListEvent& event)
+{
+    // Names read best A to Z and counts read best largest first.
+    if (event.GetColumn() == sortColumn)
+        ascending = !ascending;
+    else
+        ascending = event.GetColumn() == Column::Mnemonic;
+
+    sortColumn = event.GetColumn();
+
+    // Which rows are selected depends on the order, so the selection is
+    // cleared rather than left on different mnemonics.
+    for (long item = GetFirstSelected(); item != -1;
+         item = GetNextSelected(item))
+    {
+        Select(item, false);
+    }
+
+    Sort();
+}
@@ -0,0 +1,76 @@
+// MnemonicListView.h - Declares the MnemonicListView class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef MNEMONIC_LIST_VIEW_H
+#define MNEMONIC_LIST_VIEW_H
+
+#include <cstddef>
+#include <vector>
+#include <wx/wx.h>
+#include <wx/listctrl.h>
+#include "MnemonicHistogram.h"
+
+/// @brief Shows how many times each mnemonic was found.
+///
+/// The view is virtual, so a file full of distinct labels doesn't create a
+/// row for each one. Clicking a column header sorts by that column, and
+/// clicking it again reverses the order.
+class MnemonicListView : public wxListView
+{
+public:
+    /// @brief Constructor; creates a new instance of MnemonicListView.
+    /// @param parent The window the view belongs to.
+    /// @param histogram The mnemonics to show. Must outlive the view.
+    MnemonicListView(wxWindow* parent, const MnemonicHistogram& histogram);
+
+    /// @brief Gets the mnemonics the user selected.
+    /// @return The numbers of the selected mnemonics in the histogram, in
+    /// the order they are shown.
+    std::vector<std::size_t> SelectedMnemonics() const;
+
+    /// @brief Gets every mnemonic.
+    /// @return The numbers of all the mnemonics in the histogram, in the
+    /// order they are shown.
+    const std::vector<std::size_t>& AllMnemonics() const { return order; }
+protected:
+    /// @brief Gets the text of a cell.
+    /// @param item The row of the cell.
+    /// @param column The column of the cell.
+    /// @return The text to show in the cell.
+    wxString OnGetItemText(long item, long column) const override;
+private:
+    enum Column
+    {
+        Mnemonic = 0,
+        Count = 1,
+        Share = 2
+    };
+
+    const MnemonicHistogram& histogram;
+    std::vector<std::size_t> order;
+    long sortColumn{ Column::Count };
+    bool ascending{ false };
+
+    /// @brief Sorts the rows by the current sort column.
+    void Sort();
+
+    /// @brief Event handler for clicks on a column header.
+    /// @param event The triggering event.
+    void OnColumnClick(wxListEvent& event);
+};
+
+#endif
@@ -0,0 +1,689 @@
+// Pattern.cpp - Defines the Pattern class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "Pattern.h"
+
+#include <cstring>
+
+namespace
+{
+    bool IsBlank(char c)
+    {
+        return c == ' ' || c == '\t';
+    }
+
+    // Blanks between two of these characters are kept as a single space,
+    // so "dword ptr [ebx + 4]" becomes "dword ptr[ebx+4]" in both the line
+    // and the pattern.
+    bool IsWord(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+            (c >= '0' && c <= '9') || c == '_' || c == '$' || c == '.' ||
+            c == '%' || static_cast<unsigned char>(c) >= 0x80;
+    }
+
+    char FoldCase(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    std::string_view Trim(std::string_view text)
+    {
+        while (!text.empty() && IsBlank(text.front()))
+            text.remove_prefix(1);
+
+        while (!text.empty() && IsBlank(text.back()))
+            text.remove_suffix(1);
+
+        return text;
+    }
+
+    std::bitset<256> Only(char c)
+    {
+        std::bitset<256> bytes;
+        bytes.set(static_cast<unsigned char>(c));
+        return bytes;
+    }
+
+    std::bitset<256> AllBytes()
+    {
+        return std::bitset<256>{}.set();
+    }
+
+    // Wildcards in the mnemonic stay in the mnemonic, and wildcards in an
+    // operand stay in that operand.
+    std::bitset<256> MnemonicBytes()
+    {
+        std::bitset<256> bytes = AllBytes();
+        bytes.reset(static_cast<unsigned char>(Pattern::mnemonicSeparator));
+        bytes.reset(static_cast<unsigned char>(Pattern::operandSeparator));
+        return bytes;
+    }
+
+    std::bitset<256> OperandBytes()
+    {
+        return MnemonicBytes();
+    }
+
+    std::bitset<256> NumberBytes()
+    {
+        std::bitset<256> bytes;
+
+        for (const char* c = "0123456789abcdefx+-"; *c != '\0'; c++)
+            bytes.set(static_cast<unsigned char>(*c));
+
+        return bytes;
+    }
+
+    bool StartsCheck(std::string_view text, std::size_t position)
+    {
+        return text[position] == '{' && position + 1 < text.size() &&
+            std::strchr("<>=!", text[position + 1]) != nullptr;
+    }
+}
+
+bool Pattern::IsPattern(const wxString& name)
+{
+    wxScopedCharBuffer utf8 = name.ToUTF8();
+    std::string_view text = Trim(std::string_view{ utf8.data(),
+                                                   utf8.length() });
+
+    for (char c : text)
+    {
+        if (IsBlank(c) || std::strchr("*?[|\\", c) != nullptr)
+            return true;
+    }
+
+    return false;
+}
+
+std::optional<Pattern> Pattern::Parse(const wxString& text, wxString* error)
+{
+    wxScopedCharBuffer utf8 = text.ToUTF8();
+    std::string_view pattern = Trim(std::string_view{ utf8.data(),
+                                                      utf8.length() });
+    std::size_t blank{ 0 };
+
+    while (blank < pattern.size() && !IsBlank(pattern[blank]))
+        blank++;
+
+    // The mnemonic is lowercased the same way as the first token of a line.
+    std::string mnemonic{ pattern.substr(0, blank) };
+
+    for (char& c : mnemonic)
+        c = FoldCase(c);
+
+    std::string_view operands = Trim(pattern.substr(blank));
+
+    Pattern result;
+    wxString message;
+    std::size_t begin{ 0 };
+
+    while (message.empty() && begin <= mnemonic.size())
+    {
+        std::size_t end = mnemonic.find('|', begin);
+
+        if (end == std::string::npos)
+            end = mnemonic.size();
+
+        if (end == begin)
+        {
+            message = "A mnemonic is missing";
+            break;
+        }
+
+        result.starts.push_back(static_cast<int>(result.steps.size()));
+
+        for (std::size_t i = begin; i < end && message.empty(); i++)
+        {
+            char c = mnemonic[i];
+
+            if (c == '*')
+            {
+                result.AddStep(StepKind::Repeat, MnemonicBytes());
+            }
+            else if (c == '?')
+            {
+                result.AddStep(StepKind::Byte, MnemonicBytes());
+            }
+            else if (c == '[')
+            {
+                std::size_t close = mnemonic.find(']', i + 2);
+
+                if (close == std::string::npos || close >= end)
+                {
+                    message = "A [ has no matching ]";
+                    break;
+                }
+
+                std::size_t first = i + 1;
+                bool negated = mnemonic[first] == '!' || mnemonic[first] == '^';
+                std::bitset<256> bytes;
+
+                if (negated)
+                    first++;
+
+                for (std::size_t j = first; j < close; j++)
+                {
+                    auto low = static_cast<unsigned char>(mnemonic[j]);
+                    auto high = low;
+
+                    if (j + 2 < close && mnemonic[j + 1] == '-')
+                    {
+                        high = static_cast<unsigned char>(mnemonic[j + 2]);
+                        j += 2;
+                    }
+
+                    for (unsigned b = low; b <= high; b++)
+                        bytes.set(b);
+                }
+
+                if (negated)
+                    bytes = ~bytes & MnemonicBytes();
+
+                result.AddStep(StepKind::Byte, bytes);
+                i = close;
+            }
+            else
+            {
+                if (c == '\\' && i + 1 < end)
+                    c = mnemonic[++i];
+
+                result.AddStep(StepKind::Byte, Only(c));
+            }
+        }
+
+        if (!message.empty())
+            break;
+
+        result.AddStep(StepKind::Byte, Only(mnemonicSeparator));
+
+        if (operands.empty())
+        {
+            result.AddStep(StepKind::Repeat, AllBytes());
+            result.steps.push_back(Step{ StepKind::Accept });
+        }
+        else if (!result.AddOperands(operands, message))
+        {
+            break;
+        }
+
+        begin = end + 1;
+    }
+
+    if (!message.empty())
+    {
+        if (error != nullptr)
+            *error = message;
+
+        return std::nullopt;
+    }
+
+    return result;
+}
+
+void Pattern::AppendOperands(std::string_view operands, std::string& subject)
+{
+    subject += mnemonicSeparator;
+
+    // Nothing has been added to the current operand yet, or the last thing
+    // added was a blank.
+    bool operandEmpty{ true };
+    bool blank{ true };
+    char previous{ '\0' };
+    int depth{ 0 };
+
+    for (std::size_t i = 0; i < operands.size(); i++)
+    {
+        char c = operands[i];
+
+        if (IsBlank(c))
+        {
+            blank = true;
+            continue;
+        }
+
+        // Comments have to be found without knowing the dialect. A "#" at
+        // the start of an operand is an ARM immediate unless a blank
+        // follows it, but after an operand it starts a MIPS comment.
+        if (c == ';')
+            break;
+
+        if ((c == '#' || c == '@' || (c == '/' && i + 1 < operands.size() &&
+                                      operands[i + 1] == '/')) &&
+            blank && depth == 0)
+        {
+            bool immediate = c == '#' && operandEmpty &&
+                i + 1 < operands.size() && !IsBlank(operands[i + 1]);
+
+            if (!immediate)
+                break;
+        }
+
+        if (c == ',' && depth == 0)
+        {
+            subject += operandSeparator;
+            operandEmpty = true;
+            blank = true;
+            previous = '\0';
+            continue;
+        }
+
+        if (c == '(' || c == '[' || c == '{')
+            depth++;
+        else if ((c == ')' || c == ']' || c == '}') && depth > 0)
+            depth--;
+
+        if (blank && !operandEmpty && IsWord(previous) && IsWord(c))
+            subject += ' ';
+
+        subject += FoldCase(c);
+        operandEmpty = false;
+        blank = false;
+        previous = c;
+    }
+}
+
+bool Pattern::Verify(std::string_view subject) const
+{
+    std::vector<std::size_t> spans(checks.size() * 2, std::string::npos);
+
+    for (int start : starts)
+    {
+        if (Match(start, subject, 0, spans))
+            return true;
+    }
+
+    return false;
+}
+
+bool Pattern::AddOperands(std::string_view operands, wxString& error)
+{
+    // Operands are split at commas outside brackets, so "[r1, #4]" and
+    // "{r4, r5}" are one operand each, the same as AppendOperands() does.
+    std::vector<std::string_view> list;
+    std::size_t begin{ 0 };
+    int depth{ 0 };
+
+    for (std::size_t i = 0; i <= operands.size(); i++)
+    {
+        if (i == operands.size() || (operands[i] == ',' && depth == 0))
+        {
+            list.push_back(Trim(operands.substr(begin, i - begin)));
+            begin = i + 1;
+            continue;
+        }
+
+        char c = operands[i];
+
+        if (c == '\\')
+        {
+            i++;
+        }
+        else if (c == '/' && Trim(operands.substr(begin, i - begin)).empty())
+        {
+            std::size_t close = i + 1;
+
+            while (close < operands.size() && operands[close] != '/')
+                close += operands[close] == '\\' ? 2 : 1;
+
+            if (close >= operands.size())
+            {
+                error = "A regular expression has no closing /";
+                return false;
+            }
+
+            i = close;
+        }
+        else if (StartsCheck(operands, i))
+        {
+            std::size_t close = operands.find('}', i);
+
+            if (close == std::string_view::npos)
+            {
+                error = "A { has no matching }";
+                return false;
+            }
+
+            i = close;
+        }
+        else if (c == '(' || c == '[' || c == '{')
+        {
+            depth++;
+        }
+        else if ((c == ')' || c == ']' || c == '}') && depth > 0)
+        {
+            depth--;
+        }
+    }
+
+    for (std::size_t i = 0; i < list.size(); i++)
+    {
+        if (list[i] == "...")
+        {
+            if (i + 1 != list.size())
+            {
+                error = "... can only be the last operand";
+                return false;
+            }
+
+            // The separator can be skipped straight to the end, so "..."
+            // also matches when no operands are left.
+            if (i > 0)
+            {
+                AddStep(StepKind::Byte, Only(operandSeparator));
+                steps.back().skip = static_cast<int>(steps.size()) + 1;
+            }
+
+            AddStep(StepKind::Repeat, AllBytes());
+            continue;
+        }
+
+        if (i > 0)
+            AddStep(StepKind::Byte, Only(operandSeparator));
+
+        if (list[i].empty())
+        {
+            error = "An operand is missing";
+            return false;
+        }
+
+        if (!AddOperand(list[i], error))
+            return false;
+    }
+
+    steps.push_back(Step{ StepKind::Accept });
+    return true;
+}
+
+bool Pattern::AddOperand(std::string_view operand, wxString& error)
+{
+    if (operand.size() >= 2 && operand.front() == '/' && operand.back() == '/')
+    {
+        std::string expression;
+
+        for (std::size_t i = 1; i + 1 < operand.size(); i++)
+        {
+            if (operand[i] == '\\' && operand[i + 1] == '/')
+                i++;
+
+            expression += operand[i];
+        }
+
+        Check check;
+        check.isNumber = false;
+
+        try
+        {
+            check.regex = std::regex{ expression, std::regex::ECMAScript |
+                                      std::regex::icase |
+                                      std::regex::optimize };
+        }
+        catch (const std::regex_error&)
+        {
+            error = "/" + wxString::FromUTF8(expression.data(),
+                                             expression.size()) +
+                "/ isn't a valid regular expression";
+            return false;
+        }
+
+        int index = static_cast<int>(checks.size());
+        checks.push_back(check);
+        steps.push_back(Step{ StepKind::Open, {}, -1, index });
+        AddStep(StepKind::Repeat, OperandBytes());
+        steps.push_back(Step{ StepKind::Close, {}, -1, index });
+        return true;
+    }
+
+    bool blank{ false };
+    char previous{ '\0' };
+
+    for (std::size_t i = 0; i < operand.size(); i++)
+    {
+        char c = operand[i];
+
+        if (IsBlank(c))
+        {
+            blank = true;
+            continue;
+        }
+
+        if (c == '*' || c == '?')
+        {
+            AddStep(c == '*' ? StepKind::Repeat : StepKind::Byte,
+                    OperandBytes());
+            previous = '\0';
+        }
+        else if (StartsCheck(operand, i))
+        {
+            std::size_t close = operand.find('}', i);
+            std::string_view text = operand.substr(i + 1, close - i - 1);
+            Check check;
+
+            struct
+            {
+                const char* text;
+                Comparison comparison;
+            } const comparisons[]
+            {
+                { "<=", Comparison::LessOrEqual },
+                { ">=", Comparison::GreaterOrEqual },
+                { "!=", Comparison::NotEqual },
+                { "==", Comparison::Equal },
+                { "<", Comparison::Less },
+                { ">", Comparison::Greater },
+                { "=", Comparison::Equal }
+            };
+
+            for (auto& candidate : comparisons)
+            {
+                std::size_t length = std::strlen(candidate.text);
+
+                if (text.substr(0, length) == candidate.text)
+                {
+                    check.comparison = candidate.comparison;
+                    text.remove_prefix(length);
+                    break;
+                }
+            }
+
+            if (!ReadNumber(Trim(text), check.value))
+            {
+                error = wxString::FromUTF8(operand.data() + i,
+                                           close - i + 1) +
+                    " doesn't compare to a number";
+                return false;
+            }
+
+            int index = static_cast<int>(checks.size());
+            checks.push_back(check);
+            steps.push_back(Step{ StepKind::Open, {}, -1, index });
+            AddStep(StepKind::Byte, NumberBytes());
+            AddStep(StepKind::Repeat, NumberBytes());
+            steps.push_back(Step{ StepKind::Close, {}, -1, index });
+            previous = '\0';
+            i = close;
+        }
+        else
+        {
+            if (c == '\\' && i + 1 < operand.size())
+                c = operand[++i];
+
+            if (blank && IsWord(previous) && IsWord(c))
+                AddStep(StepKind::Byte, Only(' '));
+
+            AddStep(StepKind::Byte, Only(FoldCase(c)));
+            previous = c;
+        }
+
+        blank = false;
+    }
+
+    return true;
+}
+
+void Pattern::AddStep(StepKind kind, const std::bitset<256>& bytes)
+{
+    steps.push_back(Step{ kind, bytes });
+}
+
+bool Pattern::Match(int step, std::string_view subject, std::size_t position,
+                    std::vector<std::size_t>& spans) const
+{
+    const Step& current = steps[step];
+
+    switch (current.kind)
+    {
+    case StepKind::Byte:
+        if (current.skip >= 0 && Match(current.skip, subject, position, spans))
+            return true;
+
+        return position < subject.size() &&
+            current.bytes[static_cast<unsigned char>(subject[position])] &&
+            Match(step + 1, subject, position + 1, spans);
+    case StepKind::Repeat:
+    {
+        std::size_t end = position;
+
+        while (end < subject.size() &&
+               current.bytes[static_cast<unsigned char>(subject[end])])
+        {
+            end++;
+        }
+
+        for (std::size_t i = end + 1; i-- > position;)
+        {
+            if (Match(step + 1, subject, i, spans))
+                return true;
+        }
+
+        return false;
+    }
+    case StepKind::Open:
+    {
+        std::size_t saved = spans[current.check * 2];
+        spans[current.check * 2] = position;
+
+        if (Match(step + 1, subject, position, spans))
+            return true;
+
+        spans[current.check * 2] = saved;
+        return false;
+    }
+    case StepKind::Close:
+        spans[current.check * 2 + 1] = position;
+        return Match(step + 1, subject, position, spans);
+    case StepKind::Accept:
+        if (position != subject.size())
+            return false;
+
+        // Only the checks of the alternative that got here have been opened.
+        for (std::size_t i = 0; i < checks.size(); i++)
+        {
+            std::size_t begin = spans[i * 2];
+
+            if (begin != std::string::npos &&
+                !Test(checks[i], subject.substr(begin, spans[i * 2 + 1] -
+                                                begin)))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+bool Pattern::Test(const Check& check, std::string_view text)
+{
+    if (!check.isNumber)
+        return std::regex_search(text.begin(), text.end(), check.regex);
+
+    std::int64_t value;
+
+    if (!ReadNumber(text, value))
+        return false;
+
+    switch (check.comparison)
+    {
+    case Comparison::Less:
+        return value < check.value;
+    case Comparison::LessOrEqual:
+        return value <= check.value;
+    case Comparison::Greater:
+        return value > check.value;
+    case Comparison::GreaterOrEqual:
+        return value >= check.value;
+    case Comparison::Equal:
+        return value == check.value;
+    case Comparison::NotEqual:
+        return value != check.value;
+    }
+
+    return false;
+}
+
+bool Pattern::ReadNumber(std::string_view text, std::int64_t& value)
+{
+    bool negative{ false };
+
+    if (!text.empty() && (text.front() == '-' || text.front() == '+'))
+    {
+        negative = text.front() == '-';
+        text.remove_prefix(1);
+    }
+
+    unsigned base{ 10 };
+
+    if (text.size() > 2 && text[0] == '0' && FoldCase(text[1]) == 'x')
+    {
+        base = 16;
+        text.remove_prefix(2);
+    }
+
+    if (text.empty())
+        return false;
+
+    std::uint64_t magnitude{ 0 };
+
+    for (char c : text)
+    {
+        c = FoldCase(c);
+        unsigned digit;
+
+        if (c >= '0' && c <= '9')
+            digit = c - '0';
+        else if (base == 16 && c >= 'a' && c <= 'f')
+            digit = c - 'a' + 10;
+        else
+            return false;
+
+        if (magnitude > (UINT64_MAX - digit) / base)
+            return false;
+
+        magnitude = magnitude * base + digit;
+    }
+
+    if (magnitude > static_cast<std::uint64_t>(INT64_MAX))
+        return false;
+
+    value = negative ? -static_cast<std::int64_t>(magnitude)
+                     : static_cast<std::int64_t>(magnitude);
+    return true;
+}
@@ -0,0 +1,188 @@
+// Pattern.h - Declares the Pattern class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef PATTERN_H
+#define PATTERN_H
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <wx/string.h>
+
+/// @brief An instruction name that matches lines by their operands as well
+/// as their first token.
+///
+/// The mnemonic is a wildcard pattern, such as "dmult*" or "ddiv*|dmult*",
+/// and may be followed by the operands to match, separated by commas. Each
+/// operand is literal text, with "*" and "?" as wildcards, "{>0x100}" to
+/// compare a number, or "/regex/" to match the whole operand against a
+/// regular expression. "..." as the last operand matches any operands that
+/// are left. Without operands, any operands match.
+///
+/// A pattern is compiled into steps that each match a byte or a run of
+/// bytes of a line's subject, which is the lowercase first token, a mnemonic
+/// separator and the lowercase operands with operand separators between
+/// them. PatternSet combines the steps of every pattern into one automaton.
+class Pattern
+{
+public:
+    /// @brief Separates the mnemonic from the operands in a subject.
+    static constexpr char mnemonicSeparator{ '\x1E' };
+
+    /// @brief Separates the operands from each other in a subject.
+    static constexpr char operandSeparator{ '\x1F' };
+
+    /// @brief What a step of a pattern does.
+    enum class StepKind
+    {
+        Byte,
+        Repeat,
+        Open,
+        Close,
+        Accept
+    };
+
+    /// @brief A step of a pattern.
+    struct Step
+    {
+        /// @brief What the step does. Byte matches one byte in bytes and
+        /// Repeat matches any number of them. Open and Close mark where the
+        /// text a check tests begins and ends. Accept ends an alternative.
+        StepKind kind;
+
+        /// @brief The bytes a Byte or Repeat step matches.
+        std::bitset<256> bytes;
+
+        /// @brief Another step the pattern can go on to without matching
+        /// anything, or -1 if there is none.
+        int skip{ -1 };
+
+        /// @brief The check that an Open or Close step marks.
+        int check{ -1 };
+    };
+
+    /// @brief Determines if an instruction name is a pattern rather than a
+    /// plain mnemonic.
+    /// @param name The instruction name.
+    /// @return True if the name has operands or wildcards, otherwise false.
+    static bool IsPattern(const wxString& name);
+
+    /// @brief Compiles a pattern.
+    /// @param text The pattern.
+    /// @param error Receives what is wrong with the pattern, if anything.
+    /// @return The pattern, or nothing if it isn't valid.
+    static std::optional<Pattern> Parse(const wxString& text,
+                                        wxString* error = nullptr);
+
+    /// @brief Appends the operands of a line to a subject.
+    /// @param operands The text of the line after its first token.
+    /// @param subject Receives the operands, without any comment.
+    static void AppendOperands(std::string_view operands,
+                               std::string& subject);
+
+    /// @brief Gets the steps of every alternative.
+    /// @return The steps. Each alternative ends with an Accept step.
+    const std::vector<Step>& Steps() const { return steps; }
+
+    /// @brief Gets the first step of each alternative.
+    /// @return The positions of the steps in Steps().
+    const std::vector<int>& Starts() const { return starts; }
+
+    /// @brief Determines if the pattern checks numbers or regular
+    /// expressions, which the steps alone can't tell.
+    /// @return True if Verify() has to be called on a subject the steps
+    /// match, otherwise false.
+    bool HasChecks() const { return !checks.empty(); }
+
+    /// @brief Determines if a subject matches the pattern, including its
+    /// checks.
+    /// @param subject The subject of a line.
+    /// @return True if the subject matches, otherwise false.
+    bool Verify(std::string_view subject) const;
+private:
+    /// @brief How a number check compares.
+    enum class Comparison
+    {
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual,
+        Equal,
+        NotEqual
+    };
+
+    /// @brief Tests the text between an Open and a Close step.
+    struct Check
+    {
+        bool isNumber{ true };
+        Comparison comparison{ Comparison::Equal };
+        std::int64_t value{ 0 };
+        std::regex regex;
+    };
+
+    std::vector<Step> steps;
+    std::vector<int> starts;
+    std::vector<Check> checks;
+
+    /// @brief Compiles the operands of a pattern after the steps of one
+    /// alternative's mnemonic.
+    /// @param operands The operands, as typed.
+    /// @param error Receives what is wrong with the operands, if anything.
+    /// @return True if the operands are valid, otherwise false.
+    bool AddOperands(std::string_view operands, wxString& error);
+
+    /// @brief Compiles a single operand.
+    /// @param operand The operand, as typed.
+    /// @param error Receives what is wrong with the operand, if anything.
+    /// @return True if the operand is valid, otherwise false.
+    bool AddOperand(std::string_view operand, wxString& error);
+
+    /// @brief Adds a step that matches one byte or any number of bytes.
+    /// @param kind Byte or Repeat.
+    /// @param bytes The bytes the step matches.
+    void AddStep(StepKind kind, const std::bitset<256>& bytes);
+
+    /// @brief Matches the steps from a position on against the rest of a
+    /// subject, trying every way the Repeat steps can divide it.
+    /// @param step The position of the step to match.
+    /// @param subject The subject.
+    /// @param position The position in the subject to match from.
+    /// @param spans The beginning and end of the text of each check.
+    /// @return True if an Accept step was reached at the end of the subject
+    /// with every check passing, otherwise false.
+    bool Match(int step, std::string_view subject, std::size_t position,
+               std::vector<std::size_t>& spans) const;
+
+    /// @brief Tests the text of a check.
+    /// @param check The check.
+    /// @param text The text between its Open and Close steps.
+    /// @return True if the text passes, otherwise false.
+    static bool Test(const Check& check, std::string_view text);
+
+    /// @brief Reads a number as it appears in assembly language.
+    /// @param text The number, with an optional sign and "0x" for hex.
+    /// @param value Receives the value.
+    /// @return True if the whole text is a number, otherwise false.
+    static bool ReadNumber(std::string_view text, std::int64_t& value);
+};
+
+#endif
@@ -0,0 +1,283 @@
+// PatternSet.cpp - Defines the PatternSet class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "PatternSet.h"
+
+#include <algorithm>
+
+namespace
+{
+    unsigned char FoldCase(char c)
+    {
+        return static_cast<unsigned char>(
+            (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c);
+    }
+}
+
+void PatternSet::Build(const std::vector<Instruction>& instructions)
+{
+    entries.clear();
+    steps.clear();
+    stepEntries.clear();
+    starts.clear();
+
+    for (std::size_t i = 0; i < instructions.size(); i++)
+    {
+        if (!Pattern::IsPattern(instructions[i].Name()))
+            continue;
+
+        if (auto pattern = Pattern::Parse(instructions[i].Name()))
+            entries.push_back(Entry{ static_cast<int>(i), *pattern });
+    }
+
+    // The steps of every pattern go in one list, so a DFA state is just a
+    // set of positions in it.
+    for (std::size_t e = 0; e < entries.size(); e++)
+    {
+        int offset = static_cast<int>(steps.size());
+
+        for (auto step : entries[e].pattern.Steps())
+        {
+            if (step.skip >= 0)
+                step.skip += offset;
+
+            steps.push_back(step);
+            stepEntries.push_back(static_cast<int>(e));
+        }
+
+        for (int start : entries[e].pattern.Starts())
+            starts.push_back(offset + start);
+    }
+
+    // Bytes that every step treats the same way share a column of the
+    // transition table, which keeps the table small. Patterns usually only
+    // mention a few dozen distinct bytes.
+    byteClasses.fill(0);
+    std::size_t classCount{ 1 };
+
+    for (auto& step : steps)
+    {
+        if (step.kind != Pattern::StepKind::Byte &&
+            step.kind != Pattern::StepKind::Repeat)
+        {
+            continue;
+        }
+
+        std::vector<int> split(classCount * 2, -1);
+        std::size_t newCount{ 0 };
+
+        for (unsigned b = 0; b < 256; b++)
+        {
+            int& id = split[byteClasses[b] * 2 + (step.bytes[b] ? 1 : 0)];
+
+            if (id < 0)
+                id = static_cast<int>(newCount++);
+
+            byteClasses[b] = static_cast<std::uint8_t>(id);
+        }
+
+        classCount = newCount;
+    }
+
+    classBytes.assign(classCount, 0);
+
+    for (unsigned b = 256; b-- > 0;)
+        classBytes[byteClasses[b]] = static_cast<unsigned char>(b);
+}
+
+int PatternSet::Find(std::string_view token, std::string_view operands,
+                     int limit, Cache& cache) const
+{
+    if (entries.empty() || token.empty())
+        return -1;
+
+    Prepare(cache);
+
+    // The mnemonic goes through the DFA first, so the operands of most
+    // lines are never even split.
+    std::string& subject = cache.subject;
+    subject.clear();
+    int state{ startState };
+
+    for (char c : token)
+    {
+        subject += static_cast<char>(FoldCase(c));
+        state = Next(state, FoldCase(c), cache);
+
+        if (state == deadState)
+            return -1;
+    }
+
+    std::size_t mnemonicEnd = subject.size();
+    Pattern::AppendOperands(operands, subject);
+
+    for (std::size_t i = mnemonicEnd; i < subject.size(); i++)
+    {
+        state = Next(state, static_cast<unsigned char>(subject[i]), cache);
+
+        if (state == deadState)
+            return -1;
+    }
+
+    for (int e : cache.accepted[state])
+    {
+        const Entry& entry = entries[e];
+
+        if (limit >= 0 && entry.instruction >= limit)
+            break;
+
+        if (!entry.pattern.HasChecks() || entry.pattern.Verify(subject))
+            return entry.instruction;
+    }
+
+    return -1;
+}
+
+bool PatternSet::MayMatch(std::string_view token, Cache& cache) const
+{
+    if (entries.empty() || token.empty())
+        return false;
+
+    Prepare(cache);
+    int state{ startState };
+
+    for (char c : token)
+        state = Next(state, FoldCase(c), cache);
+
+    state = Next(state, Pattern::mnemonicSeparator, cache);
+    return state != deadState;
+}
+
+void PatternSet::Prepare(Cache& cache) const
+{
+    if (!cache.states.empty())
+        return;
+
+    std::vector<int> positions;
+
+    for (int start : starts)
+        AddClosure(start, positions);
+
+    std::sort(positions.begin(), positions.end());
+    Intern(std::vector<int>{}, cache);
+    Intern(positions, cache);
+}
+
+int PatternSet::Next(int state, unsigned char byte, Cache& cache) const
+{
+    std::size_t slot = state * classBytes.size() + byteClasses[byte];
+    int next = cache.transitions[slot];
+
+    if (next >= 0)
+        return next;
+
+    std::vector<int> positions;
+
+    for (int position : cache.states[state])
+    {
+        const Pattern::Step& step = steps[position];
+
+        if (step.kind == Pattern::StepKind::Byte && step.bytes[byte])
+            AddClosure(position + 1, positions);
+        else if (step.kind == Pattern::StepKind::Repeat && step.bytes[byte])
+            AddClosure(position, positions);
+    }
+
+    std::sort(positions.begin(), positions.end());
+
+    // Patterns with many wildcards can have a huge number of states, but
+    // only a few are used at a time. Starting again keeps the memory
+    // bounded at the cost of rebuilding the states that are still in use.
+    // The subject is kept, since Find() is partway through matching it.
+    if (cache.states.size() >= maxStates)
+    {
+        cache.ids.clear();
+        cache.states.clear();
+        cache.accepted.clear();
+        cache.transitions.clear();
+        Prepare(cache);
+        return Intern(positions, cache);
+    }
+
+    next = Intern(positions, cache);
+    cache.transitions[slot] = next;
+    return next;
+}
+
+int PatternSet::Intern(const std::vector<int>& positions, Cache& cache) const
+{
+    auto [found, added] = cache.ids.emplace(
+        positions, static_cast<int>(cache.states.size()));
+
+    if (!added)
+        return found->second;
+
+    cache.states.push_back(positions);
+    cache.transitions.resize(cache.transitions.size() + classBytes.size(),
+                             -1);
+
+    // The entries are in instruction order, so the first one that passes
+    // its checks is the one the line belongs to.
+    std::vector<int> accepted;
+
+    for (int position : positions)
+    {
+        if (steps[position].kind == Pattern::StepKind::Accept)
+            accepted.push_back(stepEntries[position]);
+    }
+
+    std::sort(accepted.begin(), accepted.end());
+    accepted.erase(std::unique(accepted.begin(), accepted.end()),
+                   accepted.end());
+    cache.accepted.push_back(accepted);
+    return found->second;
+}
+
+void PatternSet::AddClosure(int position, std::vector<int>& positions) const
+{
+    std::vector<int> pending{ position };
+
+    while (!pending.empty())
+    {
+        int current = pending.back();
+        pending.pop_back();
+        const Pattern::Step& step = steps[current];
+
+        // Open and Close only matter to Verify(), so they are passed
+        // through without becoming part of the state.
+        if (step.kind == Pattern::StepKind::Open ||
+            step.kind == Pattern::StepKind::Close)
+        {
+            pending.push_back(current + 1);
+            continue;
+        }
+
+        if (std::find(positions.begin(), positions.end(), current) !=
+            positions.end())
+        {
+            continue;
+        }
+
+        positions.push_back(current);
+
+        if (step.kind == Pattern::StepKind::Repeat)
+            pending.push_back(current + 1);
+
+        if (step.skip >= 0)
+            pending.push_back(step.skip);
+    }
+}
@@ -0,0 +1,146 @@
+// PatternSet.h - Declares the PatternSet class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef PATTERN_SET_H
+#define PATTERN_SET_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Instruction.h"
+#include "Pattern.h"
+
+/// @brief Matches a line against every pattern at once.
+///
+/// The steps of all the patterns are combined into one automaton, which is
+/// turned into a DFA as lines are matched. Each byte of a line then costs a
+/// single table lookup no matter how many patterns there are, and a line
+/// whose mnemonic no pattern can match is rejected before its operands are
+/// read. Only the patterns that compare numbers or use regular expressions
+/// are checked again, and only on lines the DFA has already matched.
+class PatternSet
+{
+public:
+    /// @brief The DFA states a thread has built so far.
+    ///
+    /// States are built the first time a line needs them, so each thread
+    /// keeps its own cache and the PatternSet itself is never changed by a
+    /// search. A cache can only be used with the set it was first used with.
+    class Cache
+    {
+    public:
+        /// @brief Default constructor; creates an empty Cache.
+        Cache() = default;
+    private:
+        friend class PatternSet;
+
+        std::map<std::vector<int>, int> ids;
+        std::vector<std::vector<int>> states;
+        std::vector<std::vector<int>> accepted;
+        std::vector<int> transitions;
+        std::string subject;
+    };
+
+    /// @brief Compiles the instructions whose names are patterns.
+    /// @param instructions The instructions. Those with plain names, and
+    /// patterns that aren't valid, are left out.
+    void Build(const std::vector<Instruction>& instructions);
+
+    /// @brief Determines if any instruction is a pattern.
+    /// @return True if there are no patterns, otherwise false.
+    bool IsEmpty() const { return entries.empty(); }
+
+    /// @brief Gets the first instruction that is a pattern.
+    /// @return The position of the instruction in the vector the set was
+    /// built from, or -1 if there are no patterns.
+    int FirstInstruction() const
+    {
+        return entries.empty() ? -1 : entries.front().instruction;
+    }
+
+    /// @brief Finds the first pattern that matches a line.
+    /// @param token The first token of the line. ASCII letters are folded to
+    /// lowercase, and any other bytes are compared as they are.
+    /// @param operands The text of the line after its first token.
+    /// @param limit Only patterns of instructions before this one are tried,
+    /// or -1 to try them all.
+    /// @param cache The calling thread's cache.
+    /// @return The position of the instruction, or -1 if no pattern before
+    /// limit matches.
+    int Find(std::string_view token, std::string_view operands, int limit,
+             Cache& cache) const;
+
+    /// @brief Determines if a pattern could match lines with a token.
+    /// @param token The first token, in any case, as for Find().
+    /// @param cache The calling thread's cache.
+    /// @return False if no pattern matches lines with the token whatever
+    /// their operands are, otherwise true.
+    bool MayMatch(std::string_view token, Cache& cache) const;
+private:
+    /// @brief A compiled pattern and the instruction it came from.
+    struct Entry
+    {
+        int instruction;
+        Pattern pattern;
+    };
+
+    /// @brief The state a DFA that has matched nothing is in, which no
+    /// input ever leaves.
+    static constexpr int deadState{ 0 };
+
+    /// @brief The state a DFA starts in.
+    static constexpr int startState{ 1 };
+
+    /// @brief The most states a cache holds before it starts again.
+    static constexpr std::size_t maxStates{ 4096 };
+
+    std::vector<Entry> entries;
+    std::vector<Pattern::Step> steps;
+    std::vector<int> stepEntries;
+    std::vector<int> starts;
+    std::array<std::uint8_t, 256> byteClasses{};
+    std::vector<unsigned char> classBytes;
+
+    /// @brief Makes sure a cache holds the dead state and the start state.
+    /// @param cache The cache.
+    void Prepare(Cache& cache) const;
+
+    /// @brief Gets the state a DFA is in after a byte.
+    /// @param state The state before the byte.
+    /// @param byte The byte.
+    /// @param cache The cache that holds the state.
+    /// @return The new state.
+    int Next(int state, unsigned char byte, Cache& cache) const;
+
+    /// @brief Gets the state for a set of steps, adding it if it is new.
+    /// @param positions The sorted positions of the steps.
+    /// @param cache The cache to look in.
+    /// @return The state.
+    int Intern(const std::vector<int>& positions, Cache& cache) const;
+
+    /// @brief Adds a step and every step reached from it without matching
+    /// a byte.
+    /// @param position The position of the step.
+    /// @param positions Receives the positions.
+    void AddClosure(int position, std::vector<int>& positions) const;
+};
+
+#endif
@@ -0,0 +1,125 @@
+// ReservedMemory.cpp - Defines the ReservedMemory class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ReservedMemory.h"
+
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace
+{
+    // Memory is committed in steps of this size, a multiple of the page
+    // size on every platform, so growing a little at a time doesn't cost a
+    // system call each time.
+    constexpr std::size_t commitStep{ 16 << 20 };
+}
+
+#ifdef _WIN32
+
+bool ReservedMemory::Reserve(std::size_t size)
+{
+    Release();
+
+    void* range = VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+
+    if (range == nullptr)
+        return false;
+
+    data = static_cast<char*>(range);
+    capacity = size;
+    return true;
+}
+
+bool ReservedMemory::Commit(std::size_t size)
+{
+    if (size <= committed)
+        return true;
+
+    std::size_t newCommitted = std::min(
+        (size + commitStep - 1) / commitStep * commitStep, capacity);
+
+    if (VirtualAlloc(data + committed, newCommitted - committed, MEM_COMMIT,
+                     PAGE_READWRITE) == nullptr)
+    {
+        return false;
+    }
+
+    committed = newCommitted;
+    return true;
+}
+
+void ReservedMemory::Release()
+{
+    if (data != nullptr)
+        VirtualFree(data, 0, MEM_RELEASE);
+
+    data = nullptr;
+    capacity = 0;
+    committed = 0;
+}
+
+#else
+
+bool ReservedMemory::Reserve(std::size_t size)
+{
+    Release();
+
+    // Inaccessible pages only take up address space, not memory.
+    void* range = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS,
+                       -1, 0);
+
+    if (range == MAP_FAILED)
+        return false;
+
+    data = static_cast<char*>(range);
+    capacity = size;
+    return true;
+}
+
+bool ReservedMemory::Commit(std::size_t size)
+{
+    if (size <= committed)
+        return true;
+
+    std::size_t newCommitted = std::min(
+        (size + commitStep - 1) / commitStep * commitStep, capacity);
+
+    if (mprotect(data + committed, newCommitted - committed,
+                 PROT_READ | PROT_WRITE) == -1)
+    {
+        return false;
+    }
+
+    committed = newCommitted;
+    return true;
+}
+
+void ReservedMemory::Release()
+{
+    if (data != nullptr)
+        munmap(data, capacity);
+
+    data = nullptr;
+    capacity = 0;
+    committed = 0;
+}
+
+#endif
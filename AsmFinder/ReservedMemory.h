@@ -0,0 +1,67 @@
+// ReservedMemory.h - Declares the ReservedMemory class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RESERVED_MEMORY_H
+#define RESERVED_MEMORY_H
+
+#include <cstddef>
+
+/// @brief Represents a range of address space that is only backed by memory
+/// as it is filled, so its contents never move however much it grows.
+class ReservedMemory
+{
+public:
+    /// @brief Default constructor; creates a ReservedMemory with nothing
+    /// reserved.
+    ReservedMemory() = default;
+
+    /// @brief Destructor; releases the memory if it is reserved.
+    ~ReservedMemory() { Release(); }
+
+    ReservedMemory(const ReservedMemory&) = delete;
+    ReservedMemory& operator=(const ReservedMemory&) = delete;
+
+    /// @brief Reserves address space without using any memory for it yet.
+    /// @param size The size of the address space in bytes.
+    /// @return True if the address space was reserved, otherwise false.
+    /// @post Data() points to the start of the range if it was reserved.
+    bool Reserve(std::size_t size);
+
+    /// @brief Makes the start of the range readable and writable.
+    /// @param size The number of bytes from the start of the range that
+    /// are needed, which must not be more than Capacity().
+    /// @return True if the memory is usable, otherwise false.
+    bool Commit(std::size_t size);
+
+    /// @brief Releases the address space and the memory behind it.
+    /// @post Data() is nullptr and Capacity() is zero.
+    void Release();
+
+    /// @brief Gets the start of the range.
+    /// @return A pointer to the first byte, or nullptr if nothing is
+    /// reserved.
+    char* Data() const { return data; }
+
+    /// @brief Gets the size of the range.
+    /// @return The size of the reserved address space in bytes.
+    std::size_t Capacity() const { return capacity; }
+private:
+    char* data{ nullptr };
+    std::size_t capacity{ 0 };
+    std::size_t committed{ 0 };
+};
+
+#endif
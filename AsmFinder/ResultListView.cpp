@@ -0,0 +1,58 @@
+// ResultListView.cpp - Defines the ResultListView class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ResultListView.h"
+
+ResultListView::ResultListView(wxWindow* parent, const MatchTable& matches,
+                               const std::vector<SourceFile>& sources,
+                               const std::vector<wxString>& names)
+    : wxListView{ parent, wxID_ANY, wxDefaultPosition, wxDefaultSize,
+                  wxLC_REPORT | wxLC_VIRTUAL },
+      matches{ matches }, sources{ sources }, names{ names }
+{
+    AppendColumn("Line");
+    AppendColumn("Text", wxLIST_FORMAT_LEFT, 400);
+}
+
+void ResultListView::UpdateItems()
+{
+    SetItemCount(static_cast<long>(matches.Size()));
+    Refresh();
+}
+
+wxString ResultListView::OnGetItemText(long item, long column) const
+{
+    std::size_t row = static_cast<std::size_t>(item);
+    std::uint32_t file = matches.FileId(row);
+
+    switch (column)
+    {
+    case Column::Number:
+    {
+        wxString number;
+
+        if (sources.size() > 1)
+            number << names[file] << ':';
+
+        number << matches.LineNumber(row);
+        return number;
+    }
+    case Column::Text:
+        return sources[file].LineText(matches.Offset(row));
+    default:
+        return wxString{};
+    }
+}
@@ -0,0 +1,65 @@
+// ResultListView.h - Declares the ResultListView class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RESULT_LIST_VIEW_H
+#define RESULT_LIST_VIEW_H
+
+#include <vector>
+#include <wx/wx.h>
+#include <wx/listctrl.h>
+#include "MatchTable.h"
+#include "SourceFile.h"
+
+/// @brief Shows the lines that matched a search.
+///
+/// The view is virtual, so it reads each visible row straight from the
+/// match table and the source files. Updating it costs the same whether
+/// there are ten results or ten million. When more than one file was
+/// searched, each line is shown as file:line.
+class ResultListView : public wxListView
+{
+public:
+    /// @brief Constructor; creates a new instance of ResultListView.
+    /// @param parent The window the view belongs to.
+    /// @param matches The matches to show. Must outlive the view.
+    /// @param sources The files the matches are from. Must outlive the view.
+    /// @param names The name to show for each file. Must outlive the view.
+    ResultListView(wxWindow* parent, const MatchTable& matches,
+                   const std::vector<SourceFile>& sources,
+                   const std::vector<wxString>& names);
+
+    /// @brief Updates the view after results have been added or cleared.
+    /// @post Only the rows that are visible are redrawn.
+    void UpdateItems();
+protected:
+    /// @brief Gets the text of a cell.
+    /// @param item The row of the cell.
+    /// @param column The column of the cell.
+    /// @return The text to show in the cell.
+    wxString OnGetItemText(long item, long column) const override;
+private:
+    enum Column
+    {
+        Number = 0,
+        Text = 1
+    };
+
+    const MatchTable& matches;
+    const std::vector<SourceFile>& sources;
+    const std::vector<wxString>& names;
+};
+
+#endif
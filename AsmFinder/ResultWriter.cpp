@@ -0,0 +1,446 @@
+// ResultWriter.cpp - Defines the ResultWriter class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "ResultWriter.h"
+
+#include <charconv>
+#include <cstdint>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <wx/ffile.h>
+
+namespace
+{
+    /// @brief Writes buffers of output to a file, either as they are handed
+    /// over or on a background thread.
+    class Output
+    {
+    public:
+        /// @brief Constructor; creates a new instance of Output.
+        /// @param file The file to write to, which must stay open.
+        /// @param bufferSize How much output to collect before writing it.
+        /// @param background True to write on a background thread.
+        Output(wxFFile& file, std::size_t bufferSize, bool background)
+            : file{ file }, bufferSize{ bufferSize }
+        {
+            buffer.reserve(bufferSize + bufferSize / 4);
+
+            if (background)
+                writer = std::thread{ &Output::Run, this };
+        }
+
+        /// @brief Destructor; stops the background thread.
+        ~Output()
+        {
+            Stop();
+        }
+
+        /// @brief Gets the buffer to append output to.
+        /// @return The buffer.
+        std::string& Buffer() { return buffer; }
+
+        /// @brief Writes the buffer if it has filled up.
+        void Check()
+        {
+            if (buffer.size() >= bufferSize)
+                Flush();
+        }
+
+        /// @brief Writes everything left in the buffer and waits for it.
+        /// @return True if all of the output was written, otherwise false.
+        bool Finish()
+        {
+            Flush();
+            Stop();
+            return !failed;
+        }
+    private:
+        wxFFile& file;
+        std::size_t bufferSize;
+        std::string buffer;
+        std::string pending;
+        bool hasPending{ false };
+        bool stopping{ false };
+        bool failed{ false };
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::thread writer;
+
+        /// @brief Hands the buffer over to be written.
+        void Flush()
+        {
+            if (buffer.empty())
+                return;
+
+            if (!writer.joinable())
+            {
+                WriteBuffer(buffer);
+                buffer.clear();
+                return;
+            }
+
+            // The written buffer comes back empty with its memory intact, so
+            // the two buffers take turns without allocating again.
+            std::unique_lock<std::mutex> lock{ mutex };
+            changed.wait(lock, [this]() { return !hasPending; });
+            buffer.swap(pending);
+            hasPending = true;
+            changed.notify_all();
+        }
+
+        /// @brief Waits for the background thread to write what it was
+        /// given and stops it.
+        void Stop()
+        {
+            if (!writer.joinable())
+                return;
+
+            {
+                std::lock_guard<std::mutex> lock{ mutex };
+                stopping = true;
+            }
+
+            changed.notify_all();
+            writer.join();
+        }
+
+        /// @brief Writes buffers on the background thread.
+        void Run()
+        {
+            std::unique_lock<std::mutex> lock{ mutex };
+
+            for (;;)
+            {
+                changed.wait(lock, [this]() { return hasPending || stopping; });
+
+                if (!hasPending)
+                    return;
+
+                lock.unlock();
+                WriteBuffer(pending);
+                pending.clear();
+                lock.lock();
+                hasPending = false;
+                changed.notify_all();
+            }
+        }
+
+        void WriteBuffer(const std::string& text)
+        {
+            if (!failed && file.Write(text.data(), text.size()) != text.size())
+                failed = true;
+        }
+    };
+
+    void AppendNumber(std::string& output, std::uint64_t number)
+    {
+        char digits[20];
+        auto result = std::to_chars(digits, digits + sizeof(digits), number);
+        output.append(digits, result.ptr - digits);
+    }
+
+    // A field is quoted if it has anything a CSV reader would split on,
+    // with each quote in it doubled.
+    void AppendCsv(std::string& output, std::string_view text)
+    {
+        if (text.find_first_of(",\"\r\n") == std::string_view::npos)
+        {
+            output.append(text);
+            return;
+        }
+
+        output += '"';
+
+        for (char c : text)
+        {
+            if (c == '"')
+                output += '"';
+
+            output += c;
+        }
+
+        output += '"';
+    }
+
+    // Gets the length of the UTF-8 sequence at the start of text, or zero
+    // if it isn't a valid one.
+    std::size_t Utf8Length(std::string_view text)
+    {
+        auto byte = [&](std::size_t i) {
+            return static_cast<unsigned char>(text[i]);
+        };
+        auto isTrail = [&](std::size_t i) {
+            return i < text.size() && (byte(i) & 0xC0) == 0x80;
+        };
+
+        unsigned char lead = byte(0);
+
+        if (lead >= 0xC2 && lead <= 0xDF)
+            return isTrail(1) ? 2 : 0;
+
+        if (lead >= 0xE0 && lead <= 0xEF)
+        {
+            if (!isTrail(1) || !isTrail(2) ||
+                (lead == 0xE0 && byte(1) < 0xA0) ||
+                (lead == 0xED && byte(1) >= 0xA0))
+            {
+                return 0;
+            }
+
+            return 3;
+        }
+
+        if (lead >= 0xF0 && lead <= 0xF4)
+        {
+            if (!isTrail(1) || !isTrail(2) || !isTrail(3) ||
+                (lead == 0xF0 && byte(1) < 0x90) ||
+                (lead == 0xF4 && byte(1) >= 0x90))
+            {
+                return 0;
+            }
+
+            return 4;
+        }
+
+        return 0;
+    }
+
+    // JSON has to be valid UTF-8, so a byte that isn't part of a valid
+    // sequence is read as Latin-1, the same as SourceFile::LineText() does.
+    void AppendJson(std::string& output, std::string_view text)
+    {
+        static const char hex[] = "0123456789abcdef";
+
+        output += '"';
+
+        std::size_t run{ 0 };
+
+        for (std::size_t i = 0; i < text.size();)
+        {
+            unsigned char c = static_cast<unsigned char>(text[i]);
+
+            if (c >= 0x20 && c < 0x80 && c != '"' && c != '\\')
+            {
+                i++;
+                continue;
+            }
+
+            std::size_t length = c >= 0x80 ? Utf8Length(text.substr(i)) : 0;
+
+            if (length != 0)
+            {
+                i += length;
+                continue;
+            }
+
+            output.append(text.substr(run, i - run));
+
+            if (c == '"' || c == '\\')
+            {
+                output += '\\';
+                output += static_cast<char>(c);
+            }
+            else if (c < 0x20)
+            {
+                output += "\\u00";
+                output += hex[c >> 4];
+                output += hex[c & 0xF];
+            }
+            else
+            {
+                output += static_cast<char>(0xC0 | (c >> 6));
+                output += static_cast<char>(0x80 | (c & 0x3F));
+            }
+
+            run = ++i;
+        }
+
+        output.append(text.substr(run));
+        output += '"';
+    }
+
+    std::string ToUtf8(const wxString& text)
+    {
+        wxScopedCharBuffer utf8 = text.ToUTF8();
+        return std::string(utf8.data(), utf8.length());
+    }
+}
+
+std::optional<ResultWriter::Format> ResultWriter::FormatFromName(
+    const wxString& name)
+{
+    for (Format format : formats)
+    {
+        if (name.Lower() == wxString{ FormatName(format) })
+            return format;
+    }
+
+    return std::nullopt;
+}
+
+const char* ResultWriter::FormatName(Format format)
+{
+    switch (format)
+    {
+    case Format::Csv:
+        return "csv";
+    case Format::JsonLines:
+        return "jsonl";
+    default:
+        return "asm";
+    }
+}
+
+const char* ResultWriter::FormatLabel(Format format)
+{
+    switch (format)
+    {
+    case Format::Csv:
+        return "CSV Files";
+    case Format::JsonLines:
+        return "JSON Lines Files";
+    default:
+        return "ASM Files";
+    }
+}
+
+const char* ResultWriter::Extension(Format format)
+{
+    switch (format)
+    {
+    case Format::Csv:
+        return "csv";
+    case Format::JsonLines:
+        return "jsonl";
+    default:
+        return "s";
+    }
+}
+
+bool ResultWriter::Write(const wxString& path, Span<SourceFile> sources,
+                         Span<wxString> sourceNames,
+                         const std::vector<Instruction>& instructions,
+                         const MatchTable& matches) const
+{
+    wxFFile file{ path, "wb" };
+
+    if (!file.IsOpened())
+        return false;
+
+    // The names and descriptions are converted and escaped once, rather
+    // than for every line they are written with.
+    std::vector<std::string> names;
+    std::vector<std::string> fileNames;
+    std::vector<std::string> descriptions;
+
+    for (auto& sourceName : sourceNames)
+    {
+        std::string name = ToUtf8(sourceName);
+        fileNames.emplace_back();
+
+        if (format == Format::Csv)
+            AppendCsv(fileNames.back(), name);
+        else if (format == Format::JsonLines)
+            AppendJson(fileNames.back(), name);
+        else if (sources.size() > 1)
+            fileNames.back() = name + ' ';
+    }
+
+    for (auto& instruction : instructions)
+    {
+        std::string name = ToUtf8(instruction.Name());
+        std::string description = ToUtf8(instruction.Description());
+        names.emplace_back();
+        descriptions.emplace_back();
+
+        if (format == Format::Csv)
+        {
+            AppendCsv(names.back(), name);
+            AppendCsv(descriptions.back(), description);
+        }
+        else if (format == Format::JsonLines)
+        {
+            AppendJson(names.back(), name);
+            AppendJson(descriptions.back(), description);
+        }
+        else
+        {
+            descriptions.back() = description;
+        }
+    }
+
+    Output output{ file, bufferSize, background };
+    std::string& buffer = output.Buffer();
+
+    if (format == Format::Csv)
+        buffer += "file,line,instruction,description,text\n";
+
+    for (std::size_t i = 0; i < instructions.size(); i++)
+    {
+        for (auto row : matches.Rows(i))
+        {
+            std::uint32_t fileId = matches.FileId(row);
+            std::string_view text =
+                sources[fileId].LineAt(matches.Offset(row));
+
+            switch (format)
+            {
+            case Format::Assembly:
+                buffer += text;
+                buffer += " # ";
+                buffer += fileNames[fileId];
+                buffer += "Line ";
+                AppendNumber(buffer, matches.LineNumber(row));
+                buffer += ", ";
+                buffer += descriptions[i];
+                break;
+            case Format::Csv:
+                buffer += fileNames[fileId];
+                buffer += ',';
+                AppendNumber(buffer, matches.LineNumber(row));
+                buffer += ',';
+                buffer += names[i];
+                buffer += ',';
+                buffer += descriptions[i];
+                buffer += ',';
+                AppendCsv(buffer, text);
+                break;
+            case Format::JsonLines:
+                buffer += "{\"file\":";
+                buffer += fileNames[fileId];
+                buffer += ",\"line\":";
+                AppendNumber(buffer, matches.LineNumber(row));
+                buffer += ",\"instruction\":";
+                buffer += names[i];
+                buffer += ",\"description\":";
+                buffer += descriptions[i];
+                buffer += ",\"text\":";
+                AppendJson(buffer, text);
+                buffer += '}';
+                break;
+            }
+
+            buffer += '\n';
+            output.Check();
+        }
+    }
+
+    return output.Finish() && file.Close();
+}
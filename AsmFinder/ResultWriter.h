@@ -0,0 +1,115 @@
+// ResultWriter.h - Declares the ResultWriter class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef RESULT_WRITER_H
+#define RESULT_WRITER_H
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+#include <wx/string.h>
+#include "Instruction.h"
+#include "MatchTable.h"
+#include "SourceFile.h"
+#include "Span.h"
+
+/// @brief Saves the matches of a search to a file.
+///
+/// The matches are formatted straight from a MatchTable into a buffer that
+/// is written to the file each time it fills up, so the whole output is
+/// never held in memory and each line is only copied once. The buffer can
+/// also be handed to a background thread, which writes it while the next
+/// one is formatted.
+class ResultWriter
+{
+public:
+    /// @brief Identifies the format of the saved file.
+    enum class Format
+    {
+        /// @brief An assembly source file with each matching line followed
+        /// by a comment giving its line number and description.
+        Assembly,
+
+        /// @brief Comma-separated values with a header row.
+        Csv,
+
+        /// @brief One JSON object per line.
+        JsonLines
+    };
+
+    /// @brief Every format, in the order they are offered to the user.
+    static constexpr Format formats[]{ Format::Assembly, Format::Csv,
+                                       Format::JsonLines };
+
+    /// @brief Default constructor; creates a writer for assembly files.
+    ResultWriter() = default;
+
+    /// @brief Constructor; creates a new instance of ResultWriter.
+    /// @param format The format to save the matches in.
+    explicit ResultWriter(Format format) : format{ format } {}
+
+    /// @brief Finds a format by the name FormatName() gives it.
+    /// @param name The name, in any case.
+    /// @return The format, or nothing if there is none with the name.
+    static std::optional<Format> FormatFromName(const wxString& name);
+
+    /// @brief Gets the short name of a format, as used on the command line.
+    /// @param format The format.
+    /// @return The name, such as "csv".
+    static const char* FormatName(Format format);
+
+    /// @brief Gets the name of a format to show to the user.
+    /// @param format The format.
+    /// @return The name, such as "CSV Files".
+    static const char* FormatLabel(Format format);
+
+    /// @brief Gets the file extension of a format.
+    /// @param format The format.
+    /// @return The extension without a dot, such as "s".
+    static const char* Extension(Format format);
+
+    /// @brief Gets the format matches are saved in.
+    /// @return The format.
+    Format GetFormat() const { return format; }
+
+    /// @brief Sets how much output is formatted before it is written.
+    /// @param size The size of the buffer in bytes.
+    void SetBufferSize(std::size_t size) { bufferSize = size; }
+
+    /// @brief Sets whether the output is written by a background thread.
+    /// @param background True to write on a background thread.
+    void SetBackground(bool background) { this->background = background; }
+
+    /// @brief Saves matches to a file, replacing anything already in it.
+    /// @param path The path of the file to save.
+    /// @param sources The files that were searched.
+    /// @param sourceNames The name of each file to write with its matches.
+    /// Assembly files only name the file when there is more than one.
+    /// @param instructions The instructions that were searched for.
+    /// @param matches The matches, which are saved grouped by instruction.
+    /// @return True if the whole file was written, otherwise false.
+    bool Write(const wxString& path, Span<SourceFile> sources,
+               Span<wxString> sourceNames,
+               const std::vector<Instruction>& instructions,
+               const MatchTable& matches) const;
+private:
+    Format format{ Format::Assembly };
+    std::size_t bufferSize{ 1 << 20 };
+    bool background{ true };
+};
+
+#endif
@@ -0,0 +1,210 @@
+// ScopeDialog.cpp - Defines the ScopeDialog class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ScopeDialog.h"
+
+#include <algorithm>
+#include <string>
+
+namespace
+{
+    // What an item of the tree stands for. The children of a section or
+    // function are added from it when the item is first expanded.
+    class ScopeItemData : public wxTreeItemData
+    {
+    public:
+        ScopeItemData(std::size_t firstRow,
+                      const ScopeSummary::Section* section,
+                      const ScopeSummary::Function* function)
+            : firstRow{ firstRow }, section{ section }, function{ function }
+        {}
+
+        std::size_t firstRow;
+        const ScopeSummary::Section* section;
+        const ScopeSummary::Function* function;
+    };
+
+    wxString Label(const wxString& name, std::uint64_t count)
+    {
+        wxString label{ name };
+        label << " (" << count << ')';
+        return label;
+    }
+
+    wxString ScopeName(const std::string& name, const char* unnamed)
+    {
+        if (name.empty())
+            return unnamed;
+
+        return wxString::FromUTF8(name.data(), name.size());
+    }
+
+    // The functions are in order of their matches, not their rows.
+    std::size_t FirstRow(const ScopeSummary::Section& section)
+    {
+        std::size_t firstRow{ section.functions.front().firstRow };
+
+        for (const ScopeSummary::Function& function : section.functions)
+            firstRow = std::min(firstRow, function.firstRow);
+
+        return firstRow;
+    }
+}
+ScopeDialog::ScopeDialog(wxWindow* parent, const ScopeSummary& summary,
+                         const std::vector<Instruction>& instructions,
+                         const std::vector<wxString>& sourceNames)
+    : wxDialog{ parent, wxID_ANY, "Matches by Function", wxDefaultPosition,
+                wxDefaultSize, wxDEFAULT_DIALOG_STYLE | wxRESIZE_BORDER },
+      summary{ summary }, instructions{ instructions }
+{
+    wxStaticText* summaryLabel = new wxStaticText{ this, wxID_ANY,
+        "The number of matches in each section and function, the most "
+        "first. Select one and click OK to show its first match." };
+
+    scopeTreeCtrl = new wxTreeCtrl{ this, wxID_ANY, wxDefaultPosition,
+                                    wxSize{ 480, 400 },
+                                    wxTR_DEFAULT_STYLE | wxTR_HIDE_ROOT |
+                                    wxTR_SINGLE };
+
+    // The children are added as items are expanded, so the handler is
+    // bound before the first section is expanded.
+    scopeTreeCtrl->Bind(wxEVT_TREE_ITEM_EXPANDING, &ScopeDialog::OnExpanding,
+                        this);
+    scopeTreeCtrl->Bind(wxEVT_TREE_ITEM_ACTIVATED, &ScopeDialog::OnActivated,
+                        this);
+    FillTree(sourceNames);
+
+    wxBoxSizer* dialogSizer = new wxBoxSizer{ wxVERTICAL };
+    dialogSizer->Add(summaryLabel, 0, wxALL | wxEXPAND, 10);
+    dialogSizer->Add(scopeTreeCtrl, 1, wxLEFT | wxRIGHT | wxEXPAND, 10);
+    dialogSizer->Add(CreateButtonSizer(wxOK | wxCANCEL), 0,
+                     wxALL | wxEXPAND, 10);
+
+    SetSizerAndFit(dialogSizer);
+}
+
+std::size_t ScopeDialog::ChosenRow() const
+{
+    wxTreeItemId item = scopeTreeCtrl->GetSelection();
+
+    if (!item.IsOk())
+        return npos;
+
+    auto data = static_cast<ScopeItemData*>(scopeTreeCtrl->GetItemData(item));
+    return data != nullptr ? data->firstRow : npos;
+}
+
+void ScopeDialog::FillTree(const std::vector<wxString>& sourceNames)
+{
+    wxTreeItemId root = scopeTreeCtrl->AddRoot(wxString{});
+    const std::vector<ScopeSummary::Section>& sections = summary.Sections();
+
+    // The files are only shown when there is more than one, with their
+    // sections below them.
+    wxTreeItemId parent = root;
+    wxTreeItemId first;
+
+    for (std::size_t i = 0; i < sections.size(); i++)
+    {
+        const ScopeSummary::Section& section = sections[i];
+
+        if (sourceNames.size() > 1 &&
+            (i == 0 || section.file != sections[i - 1].file))
+        {
+            std::uint64_t matchCount{ 0 };
+            std::size_t firstRow{ FirstRow(section) };
+
+            for (std::size_t j = i; j < sections.size() &&
+                 sections[j].file == section.file; j++)
+            {
+                matchCount += sections[j].matchCount;
+                firstRow = std::min(firstRow, FirstRow(sections[j]));
+            }
+
+            parent = scopeTreeCtrl->AppendItem(
+                root, Label(sourceNames[section.file], matchCount), -1, -1,
+                new ScopeItemData{ firstRow, nullptr, nullptr });
+        }
+
+        wxTreeItemId item = scopeTreeCtrl->AppendItem(
+            parent, Label(ScopeName(section.name, "(no section)"),
+                          section.matchCount),
+            -1, -1, new ScopeItemData{ FirstRow(section), &section, nullptr });
+        scopeTreeCtrl->SetItemHasChildren(item);
+
+        if (!first.IsOk())
+            first = item;
+    }
+
+    // The section with the most matches in the first file is opened, since
+    // that is usually where the code is.
+    if (first.IsOk())
+        scopeTreeCtrl->Expand(first);
+}
+
+void ScopeDialog::OnExpanding(wxTreeEvent& event)
+{
+    wxTreeItemId item = event.GetItem();
+    auto data = static_cast<ScopeItemData*>(scopeTreeCtrl->GetItemData(item));
+
+    if (data == nullptr || scopeTreeCtrl->GetChildrenCount(item, false) > 0)
+        return;
+
+    if (data->function != nullptr)
+    {
+        // The instructions of a function lead to its first match, since
+        // only the first row of the function is kept.
+        for (const ScopeSummary::Count& count : data->function->counts)
+        {
+            scopeTreeCtrl->AppendItem(
+                item, Label(instructions[count.instruction].Name(),
+                            count.count),
+                -1, -1,
+                new ScopeItemData{ data->firstRow, nullptr, nullptr });
+        }
+    }
+    else if (data->section != nullptr)
+    {
+        for (const ScopeSummary::Function& function : data->section->functions)
+        {
+            wxTreeItemId child = scopeTreeCtrl->AppendItem(
+                item, Label(ScopeName(function.name, "(outside functions)"),
+                            function.matchCount),
+                -1, -1, new ScopeItemData{ function.firstRow, nullptr,
+                                           &function });
+            scopeTreeCtrl->SetItemHasChildren(child);
+        }
+    }
+}
+
+void ScopeDialog::OnActivated(wxTreeEvent& event)
+{
+    // Double-clicking a file or section expands it as usual, while a
+    // function or instruction is shown right away.
+    auto data = static_cast<ScopeItemData*>(
+        scopeTreeCtrl->GetItemData(event.GetItem()));
+
+    if (data != nullptr && data->section == nullptr &&
+        (data->function != nullptr ||
+         scopeTreeCtrl->GetChildrenCount(event.GetItem(), false) == 0))
+    {
+        scopeTreeCtrl->SelectItem(event.GetItem());
+        EndModal(wxID_OK);
+        return;
+    }
+
+    event.Skip();
+}
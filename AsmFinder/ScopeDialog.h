@@ -0,0 +1,74 @@
+// ScopeDialog.h - Declares the ScopeDialog class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SCOPE_DIALOG_H
+#define SCOPE_DIALOG_H
+
+#include <cstddef>
+#include <vector>
+#include <wx/wx.h>
+#include <wx/treectrl.h>
+#include "Instruction.h"
+#include "ScopeSummary.h"
+
+/// @brief Shows how many matches are in each section and function of the
+/// files searched as a tree, and lets the user pick one to show its first
+/// match.
+///
+/// The functions of a section and the instructions of a function are only
+/// added to the tree when it is expanded, since a large binary can have
+/// many thousands of functions.
+class ScopeDialog : public wxDialog
+{
+public:
+    /// @brief Constructor; creates a new instance of ScopeDialog.
+    /// @param parent The window the dialog belongs to.
+    /// @param summary The matches in each scope. Must outlive the dialog.
+    /// @param instructions The instructions that were searched for. Must
+    /// outlive the dialog.
+    /// @param sourceNames The name of each file that was searched.
+    ScopeDialog(wxWindow* parent, const ScopeSummary& summary,
+                const std::vector<Instruction>& instructions,
+                const std::vector<wxString>& sourceNames);
+
+    /// @brief Gets the match to show.
+    /// @return The row of the first match in the chosen file, section,
+    /// function or instruction, or npos if none was chosen.
+    std::size_t ChosenRow() const;
+
+    /// @brief The row ChosenRow() returns when nothing was chosen.
+    static constexpr std::size_t npos{ static_cast<std::size_t>(-1) };
+private:
+    const ScopeSummary& summary;
+    const std::vector<Instruction>& instructions;
+    wxTreeCtrl* scopeTreeCtrl;
+
+    /// @brief Fills in the files and sections of the tree.
+    /// @param sourceNames The name of each file that was searched.
+    void FillTree(const std::vector<wxString>& sourceNames);
+
+    /// @brief Event handler for expanding an item of the tree, which adds
+    /// its children the first time.
+    /// @param event The triggering event.
+    void OnExpanding(wxTreeEvent& event);
+
+    /// @brief Event handler for double-clicking an item of the tree, which
+    /// chooses it.
+    /// @param event The triggering event.
+    void OnActivated(wxTreeEvent& event);
+};
+
+#endif
@@ -0,0 +1,182 @@
+// ScopeSummary.cpp - Defines the ScopeSummary class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ScopeSummary.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+void ScopeSummary::Summarize(const MatchTable& matches,
+                             const std::vector<ScopeTable>& scopeTables)
+{
+    constexpr ScopeTable::Kind functionKind{ ScopeTable::Kind::Function };
+    constexpr ScopeTable::Kind sectionKind{ ScopeTable::Kind::Section };
+    const ScopeTable noScopes;
+
+    sections.clear();
+
+    // The matches of each file are in line order, and so are its functions
+    // and sections, so the scopes of each match are found by walking them
+    // all together. The matches in the same scope follow each other, so
+    // they are counted a run of rows at a time.
+    std::unordered_map<std::string, std::size_t> fileSections;
+    std::unordered_map<std::uint64_t, std::size_t> fileFunctions;
+    std::vector<std::uint32_t> runInstructions;
+    std::size_t nextFunction{ 0 };
+    std::size_t nextSection{ 0 };
+    std::size_t sectionIndex{ 0 };
+    std::size_t functionIndex{ 0 };
+
+    auto finishRun = [&]() {
+        if (sections.empty())
+            return;
+
+        Function& function = sections[sectionIndex].functions[functionIndex];
+        std::sort(runInstructions.begin(), runInstructions.end());
+
+        // A function a section switch interrupted already has counts from
+        // its earlier runs, which this run adds to.
+        std::size_t countIndex{ 0 };
+
+        for (std::size_t i = 0; i < runInstructions.size(); i++)
+        {
+            if (i == 0 || runInstructions[i] != runInstructions[i - 1])
+            {
+                countIndex = std::find_if(
+                    function.counts.begin(), function.counts.end(),
+                    [&](const Count& count) {
+                        return count.instruction == runInstructions[i];
+                    }) - function.counts.begin();
+
+                if (countIndex == function.counts.size())
+                    function.counts.push_back(Count{ runInstructions[i] });
+            }
+
+            function.counts[countIndex].count++;
+        }
+
+        runInstructions.clear();
+    };
+
+    for (std::size_t row = 0; row < matches.Size(); row++)
+    {
+        std::uint32_t file = matches.FileId(row);
+        const ScopeTable& scopes = file < scopeTables.size()
+            ? scopeTables[file]
+            : noScopes;
+        bool newFile = row == 0 || file != matches.FileId(row - 1);
+
+        if (newFile)
+        {
+            fileSections.clear();
+            fileFunctions.clear();
+            nextFunction = 0;
+            nextSection = 0;
+        }
+
+        std::uint32_t line = matches.LineNumber(row);
+        std::size_t previousFunction = nextFunction;
+        std::size_t previousSection = nextSection;
+
+        while (nextFunction < scopes.Size(functionKind) &&
+               scopes.FirstLine(functionKind, nextFunction) <= line)
+        {
+            nextFunction++;
+        }
+
+        while (nextSection < scopes.Size(sectionKind) &&
+               scopes.FirstLine(sectionKind, nextSection) <= line)
+        {
+            nextSection++;
+        }
+
+        if (newFile || nextFunction != previousFunction ||
+            nextSection != previousSection)
+        {
+            finishRun();
+
+            std::string sectionName = nextSection > 0
+                ? scopes.Name(sectionKind, nextSection - 1)
+                : std::string{};
+            auto foundSection = fileSections.emplace(sectionName,
+                                                     sections.size());
+
+            if (foundSection.second)
+                sections.push_back(Section{ file, sectionName, 0, {} });
+
+            sectionIndex = foundSection.first->second;
+            Section& section = sections[sectionIndex];
+
+            // A function that switches to another section and back carries
+            // on in the entry it already has in each section.
+            std::uint64_t key =
+                (static_cast<std::uint64_t>(sectionIndex) << 32) | nextFunction;
+            auto foundFunction = fileFunctions.emplace(
+                key, section.functions.size());
+
+            if (foundFunction.second)
+            {
+                Function function;
+                function.firstRow = row;
+
+                if (nextFunction > 0)
+                {
+                    function.name = scopes.Name(functionKind,
+                                                nextFunction - 1);
+                }
+
+                section.functions.push_back(std::move(function));
+            }
+
+            functionIndex = foundFunction.first->second;
+        }
+
+        sections[sectionIndex].matchCount++;
+        sections[sectionIndex].functions[functionIndex].matchCount++;
+        runInstructions.push_back(matches.InstructionId(row));
+    }
+
+    finishRun();
+
+    // Sections and functions with the same count stay in the order they
+    // were found in.
+    for (Section& section : sections)
+    {
+        for (Function& function : section.functions)
+        {
+            std::sort(function.counts.begin(), function.counts.end(),
+                      [](const Count& a, const Count& b) {
+                          if (a.count != b.count)
+                              return a.count > b.count;
+
+                          return a.instruction < b.instruction;
+                      });
+        }
+
+        std::stable_sort(section.functions.begin(), section.functions.end(),
+                         [](const Function& a, const Function& b) {
+                             return a.matchCount > b.matchCount;
+                         });
+    }
+
+    std::stable_sort(sections.begin(), sections.end(),
+                     [](const Section& a, const Section& b) {
+                         if (a.file != b.file)
+                             return a.file < b.file;
+
+                         return a.matchCount > b.matchCount;
+                     });
+}
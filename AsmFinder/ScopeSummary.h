@@ -0,0 +1,90 @@
+// ScopeSummary.h - Declares the ScopeSummary class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SCOPE_SUMMARY_H
+#define SCOPE_SUMMARY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "MatchTable.h"
+#include "ScopeTable.h"
+
+/// @brief Adds up the matches in each function and section of the files
+/// searched, so the functions with the most matches can be found without
+/// reading through every line.
+///
+/// Sections with the same name in a file are added up together, since
+/// source often switches back and forth between the same few sections.
+/// Each function is counted in each section it is in, once however often
+/// the source switches away from it and back.
+class ScopeSummary
+{
+public:
+    /// @brief How many times an instruction was found in a function.
+    struct Count
+    {
+        std::uint32_t instruction{ 0 };
+        std::uint64_t count{ 0 };
+    };
+
+    /// @brief The matches in a function.
+    struct Function
+    {
+        /// @brief The name, which is empty for the lines before the first
+        /// function of the file or section.
+        std::string name;
+
+        /// @brief The row of the first match in the function.
+        std::size_t firstRow{ 0 };
+        std::uint64_t matchCount{ 0 };
+
+        /// @brief The count of each instruction found, the most found
+        /// first.
+        std::vector<Count> counts;
+    };
+
+    /// @brief The matches in the sections of a file with the same name.
+    struct Section
+    {
+        std::uint32_t file{ 0 };
+
+        /// @brief The name, which is empty for the lines before the first
+        /// section of the file.
+        std::string name;
+        std::uint64_t matchCount{ 0 };
+
+        /// @brief The functions, the most matches first.
+        std::vector<Function> functions;
+    };
+
+    /// @brief Adds up the matches of a search.
+    /// @param matches The matches, in file order and then line order.
+    /// @param scopeTables The functions and sections of each file searched.
+    /// A file without a table has no functions or sections.
+    void Summarize(const MatchTable& matches,
+                   const std::vector<ScopeTable>& scopeTables);
+
+    /// @brief Gets the sections of every file.
+    /// @return The sections in file order, the most matches first within
+    /// each file.
+    const std::vector<Section>& Sections() const { return sections; }
+private:
+    std::vector<Section> sections;
+};
+
+#endif
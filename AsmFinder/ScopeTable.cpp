@@ -0,0 +1,80 @@
+// ScopeTable.cpp - Defines the ScopeTable class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ScopeTable.h"
+
+#include <algorithm>
+#include "LineScanner.h"
+
+void ScopeTable::Clear()
+{
+    for (std::size_t i = 0; i < 2; i++)
+    {
+        lists[i].clear();
+        names[i].clear();
+    }
+}
+
+void ScopeTable::Add(Kind kind, std::uint32_t line, std::string_view name)
+{
+    lists[Index(kind)].push_back(line);
+    names[Index(kind)].emplace_back(name);
+}
+
+bool ScopeTable::AddLine(const Dialect& dialect, std::uint32_t line,
+                         std::string_view text)
+{
+    std::string_view name = dialect.Symbol(text);
+
+    if (!name.empty())
+    {
+        Add(Kind::Function, line, name);
+        return true;
+    }
+
+    name = dialect.Section(text);
+
+    if (!name.empty())
+    {
+        Add(Kind::Section, line, name);
+        return true;
+    }
+
+    return false;
+}
+
+void ScopeTable::Build(const SourceFile& source, const Dialect& dialect)
+{
+    Clear();
+    LineScanner scanner{ source.Data(), source.Size() };
+
+    while (scanner.Next())
+    {
+        AddLine(dialect, static_cast<std::uint32_t>(scanner.Number()),
+                scanner.Text());
+    }
+}
+
+std::size_t ScopeTable::Find(Kind kind, std::uint32_t line) const
+{
+    const std::vector<std::uint32_t>& lines = lists[Index(kind)];
+    auto next = std::upper_bound(lines.begin(), lines.end(), line);
+
+    if (next == lines.begin())
+        return npos;
+
+    return static_cast<std::size_t>(next - lines.begin()) - 1;
+}
@@ -0,0 +1,117 @@
+// ScopeTable.h - Declares the ScopeTable class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SCOPE_TABLE_H
+#define SCOPE_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Dialect.h"
+#include "SourceFile.h"
+
+/// @brief Records which function and section each line of a source file is
+/// in.
+///
+/// Each function and section is kept as the line that starts it and its
+/// name, in line order, so it covers every line up to the next one of the
+/// same kind. The lines before the first function aren't in any function,
+/// and the lines before the first section aren't in any section.
+class ScopeTable
+{
+public:
+    /// @brief The kinds of scope a line can be in.
+    enum class Kind
+    {
+        Function,
+        Section
+    };
+
+    /// @brief The position Find() returns for a line that isn't in a scope.
+    static constexpr std::size_t npos{ static_cast<std::size_t>(-1) };
+
+    /// @brief Removes every function and section.
+    /// @post Size() is zero for both kinds.
+    void Clear();
+
+    /// @brief Adds a function or section after all the others of its kind.
+    /// @param kind The kind of scope.
+    /// @param line The number of the line that starts the scope, which
+    /// must be after the line of any scope of the same kind already added.
+    /// @param name The name of the scope.
+    void Add(Kind kind, std::uint32_t line, std::string_view name);
+
+    /// @brief Adds the function or section a line starts, if it starts one.
+    /// @param dialect The dialect of the file.
+    /// @param line The number of the line, which must be after the line of
+    /// any scope already added.
+    /// @param text The text of the line, without its line ending.
+    /// @return True if the line starts a function or section, otherwise
+    /// false.
+    bool AddLine(const Dialect& dialect, std::uint32_t line,
+                 std::string_view text);
+
+    /// @brief Builds the table by reading every line of a file, for a file
+    /// that wasn't scanned by a search.
+    /// @param source The source file.
+    /// @param dialect The dialect of the file.
+    void Build(const SourceFile& source, const Dialect& dialect);
+
+    /// @brief Gets the number of functions or sections.
+    /// @param kind The kind of scope.
+    /// @return The number of scopes of that kind added.
+    std::size_t Size(Kind kind) const { return lists[Index(kind)].size(); }
+
+    /// @brief Gets the line a function or section starts on.
+    /// @param kind The kind of scope.
+    /// @param scope The position of the scope.
+    /// @return The number of the line.
+    std::uint32_t FirstLine(Kind kind, std::size_t scope) const
+    {
+        return lists[Index(kind)][scope];
+    }
+
+    /// @brief Gets the name of a function or section.
+    /// @param kind The kind of scope.
+    /// @param scope The position of the scope.
+    /// @return The name, as it appears in the source file.
+    const std::string& Name(Kind kind, std::size_t scope) const
+    {
+        return names[Index(kind)][scope];
+    }
+
+    /// @brief Finds the function or section a line is in.
+    /// @param kind The kind of scope.
+    /// @param line The number of the line.
+    /// @return The position of the scope, or npos if the line is before
+    /// the first one of that kind.
+    std::size_t Find(Kind kind, std::uint32_t line) const;
+private:
+    std::vector<std::uint32_t> lists[2];
+    std::vector<std::string> names[2];
+
+    /// @brief Gets the position of the lists of a kind of scope.
+    /// @param kind The kind of scope.
+    /// @return The position in lists and names.
+    static std::size_t Index(Kind kind)
+    {
+        return static_cast<std::size_t>(kind);
+    }
+};
+
+#endif
@@ -0,0 +1,55 @@
+// ScopedTimer.h - Declares the ScopedTimer class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SCOPED_TIMER_H
+#define SCOPED_TIMER_H
+
+#include "SearchStatistics.h"
+
+/// @brief Adds the time from its construction to its destruction to a
+/// phase of SearchStatistics.
+class ScopedTimer
+{
+public:
+    /// @brief Constructor; starts timing.
+    /// @param statistics The statistics to add the time to, or nullptr to
+    /// not time anything.
+    /// @param phase The phase the time is spent in.
+    ScopedTimer(SearchStatistics* statistics,
+                SearchStatistics::Phase phase) :
+        statistics{ statistics },
+        phase{ phase },
+        begin{ statistics != nullptr ? SearchStatistics::Clock::now()
+                                     : SearchStatistics::Clock::time_point{} }
+    {
+    }
+
+    /// @brief Destructor; adds the time to the statistics.
+    ~ScopedTimer()
+    {
+        if (statistics != nullptr)
+            statistics->Add(phase, begin, SearchStatistics::Clock::now());
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+private:
+    SearchStatistics* statistics;
+    SearchStatistics::Phase phase;
+    SearchStatistics::Clock::time_point begin;
+};
+
+#endif
@@ -0,0 +1,862 @@
+// SearchEngine.cpp - Defines the SearchEngine class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SearchEngine.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <wx/filefn.h>
+#include "LineScanner.h"
+#include "ScopedTimer.h"
+
+namespace
+{
+    // Chunks smaller than this aren't worth handing to another thread.
+    constexpr std::size_t minChunkSize{ 1 << 20 };
+
+    // Progress is reported and cancellation noticed once per chunk, so they
+    // are kept small enough that both happen several times a second.
+    constexpr std::size_t maxChunkSize{ 8 << 20 };
+
+    // Having a few chunks per thread evens out threads that finish early.
+    constexpr std::size_t chunksPerThread{ 4 };
+}
+
+SearchEngine::SearchEngine()
+{
+    SetThreadCount(0);
+}
+
+void SearchEngine::SetThreadCount(unsigned count)
+{
+    if (count == 0)
+        count = std::thread::hardware_concurrency();
+
+    threadCount = std::max(count, 1u);
+}
+
+void SearchEngine::Search(const SourceFile& source,
+                          const std::vector<Instruction>& instructions,
+                          MatchTable& matches) const
+{
+    SearchFile(source, instructions, matches, nullptr);
+}
+
+void SearchEngine::Search(const char* data, std::size_t size,
+                          const InstructionIndex& index,
+                          MatchTable& matches) const
+{
+    SearchSection(Section{ data, 0, size, 0 }, size, index, matches);
+}
+
+void SearchEngine::Search(const std::vector<SourceFile>& sources,
+                          const std::vector<Instruction>& instructions,
+                          MatchTable& matches) const
+{
+    SearchProgress progress;
+    progress.fileCount = sources.size();
+
+    for (auto& source : sources)
+        progress.totalBytes += source.EstimatedSize();
+
+    matches.Reset(instructions.size());
+
+    if (lineTables != nullptr)
+        lineTables->assign(sources.size(), LineTable{});
+
+    if (scopeTables != nullptr)
+        scopeTables->assign(sources.size(), ScopeTable{});
+
+    if (useIndex)
+    {
+        SearchEachFile(sources, instructions, matches, progress);
+        return;
+    }
+
+    InstructionIndex index;
+    index.Build(instructions);
+
+    // Every file is split the same way, so small files are a chunk each and
+    // large ones are shared out between the threads like any other chunk.
+    std::vector<Section> sections;
+
+    for (std::size_t i = 0; i < sources.size(); i++)
+    {
+        sections.push_back(SectionOf(sources[i],
+                                     static_cast<std::uint32_t>(i)));
+    }
+
+    RunChunks(sections, ChunkSize(progress.totalBytes), [&](Chunk& chunk) {
+        ScanChunk(index, dialect, chunk);
+    }, [&](Chunk& chunk, int firstLine) {
+        if (chunk.last)
+            FinishFile(chunk, sources[chunk.file], progress);
+
+        AddLines(chunk, firstLine);
+        MergeChunk(chunk, firstLine, matches, progress);
+    });
+}
+
+void SearchEngine::Analyze(const std::vector<SourceFile>& sources,
+                           const std::vector<Instruction>& instructions,
+                           MatchTable& matches,
+                           MnemonicHistogram& histogram) const
+{
+    SearchProgress progress;
+    progress.fileCount = sources.size();
+
+    for (auto& source : sources)
+        progress.totalBytes += source.EstimatedSize();
+
+    matches.Reset(instructions.size());
+    histogram.Reset(histogram.WindowSize());
+
+    InstructionIndex index;
+    index.Build(instructions);
+
+    std::vector<Section> sections;
+
+    for (std::size_t i = 0; i < sources.size(); i++)
+    {
+        sections.push_back(SectionOf(sources[i],
+                                     static_cast<std::uint32_t>(i)));
+    }
+
+    if (lineTables != nullptr)
+        lineTables->assign(sources.size(), LineTable{});
+
+    if (scopeTables != nullptr)
+        scopeTables->assign(sources.size(), ScopeTable{});
+
+    RunChunks(sections, ChunkSize(progress.totalBytes), [&](Chunk& chunk) {
+        AnalyzeChunk(index, dialect, chunk);
+    }, [&](Chunk& chunk, int firstLine) {
+        // Each chunk counted its tokens as they appear in the text, and the
+        // histogram folds their case as it adds them up.
+        for (auto& entry : chunk.tokenCounts)
+            histogram.Add(entry.token, entry.count);
+
+        // A line matched by aliases has a match for each of them, but the
+        // histogram counts the lines.
+        std::vector<int> matchLines;
+
+        for (auto& match : chunk.matches)
+        {
+            if (matchLines.empty() || matchLines.back() != match.line)
+                matchLines.push_back(match.line);
+        }
+
+        histogram.AddLines(chunk.file, static_cast<std::uint32_t>(firstLine),
+                           static_cast<std::uint32_t>(chunk.lineCount),
+                           chunk.tokenLines, matchLines);
+        chunk.tokenCounts = std::vector<TokenCounter::Entry>{};
+        chunk.tokenLines = std::vector<int>{};
+
+        if (chunk.last)
+            FinishFile(chunk, sources[chunk.file], progress);
+
+        AddLines(chunk, firstLine);
+        MergeChunk(chunk, firstLine, matches, progress);
+    });
+}
+
+void SearchEngine::Search(const SourceFile& source, std::size_t begin,
+                          std::size_t end, std::uint32_t firstLine,
+                          const std::vector<Instruction>& instructions,
+                          MatchTable& matches) const
+{
+    InstructionIndex index;
+    index.Build(instructions);
+    matches.Reset(instructions.size());
+
+    SearchProgress progress;
+    progress.totalBytes = end - begin;
+    progress.fileCount = 1;
+
+    Section section{ source.Data(), begin, end, 0 };
+
+    RunChunks({ section }, ChunkSize(end - begin), [&](Chunk& chunk) {
+        ScanChunk(index, dialect, chunk);
+    }, [&](Chunk& chunk, int chunkFirstLine) {
+        if (chunk.last)
+            progress.filesScanned = 1;
+
+        MergeChunk(chunk, static_cast<int>(firstLine) + chunkFirstLine,
+                   matches, progress);
+    });
+}
+
+void SearchEngine::SearchSection(const Section& section, std::size_t size,
+                                 const InstructionIndex& index,
+                                 MatchTable& matches,
+                                 ScopeTable* scopes) const
+{
+    SearchProgress progress;
+    progress.totalBytes = size;
+    progress.fileCount = 1;
+
+    RunChunks({ section }, ChunkSize(size), [&](Chunk& chunk) {
+        ScanChunk(index, dialect, chunk);
+    }, [&](Chunk& chunk, int firstLine) {
+        if (chunk.last)
+        {
+            progress.filesScanned = 1;
+            progress.totalBytes = chunk.end - section.begin;
+        }
+
+        AddSymbols(chunk, firstLine, scopes);
+        MergeChunk(chunk, firstLine, matches, progress);
+    });
+}
+
+void SearchEngine::SearchFile(const SourceFile& source,
+                              const std::vector<Instruction>& instructions,
+                              MatchTable& matches, ScopeTable* scopes) const
+{
+    if (useIndex && !source.Path().empty() &&
+        SearchIndex(source, instructions, matches, scopes))
+    {
+        return;
+    }
+
+    // A damaged index may have given some of the functions already.
+    if (scopes != nullptr)
+        scopes->Clear();
+
+    InstructionIndex index;
+    index.Build(instructions);
+    matches.Reset(instructions.size());
+    SearchSection(SectionOf(source, 0), source.EstimatedSize(), index,
+                  matches, scopes);
+}
+
+void SearchEngine::SearchEachFile(
+    const std::vector<SourceFile>& sources,
+    const std::vector<Instruction>& instructions, MatchTable& matches,
+    SearchProgress& progress) const
+{
+    // Each file is searched with every thread, or answered from its index,
+    // and its progress is added to the progress of the files before it.
+    SearchEngine engine{ *this };
+    SearchProgress before;
+
+    engine.SetProgressCallback([&](const SearchProgress& fileProgress,
+                                   const MatchTable&, std::size_t) {
+        progress.bytesScanned = before.bytesScanned +
+            fileProgress.bytesScanned;
+        progress.linesScanned = before.linesScanned +
+            fileProgress.linesScanned;
+
+        if (progressCallback)
+            progressCallback(progress, matches, matches.Size());
+    });
+
+    for (std::size_t i = 0; i < sources.size() && !IsCancelled(); i++)
+    {
+        MatchTable fileMatches;
+        before = progress;
+        engine.SearchFile(sources[i], instructions, fileMatches,
+                          scopeTables != nullptr ? &(*scopeTables)[i]
+                                                 : nullptr);
+
+        std::size_t firstRow = matches.Size();
+
+        for (std::size_t row = 0; row < fileMatches.Size(); row++)
+        {
+            matches.Add(fileMatches.InstructionId(row),
+                        fileMatches.LineNumber(row), fileMatches.Offset(row),
+                        static_cast<std::uint32_t>(i));
+        }
+
+        progress.bytesScanned = before.bytesScanned + sources[i].Size();
+        progress.matchCount = matches.Size();
+        progress.filesScanned = i + 1;
+
+        if (progressCallback)
+            progressCallback(progress, matches, firstRow);
+    }
+}
+
+bool SearchEngine::RunChunks(
+    const std::vector<Section>& sections, std::size_t chunkSize,
+    const std::function<void(Chunk&)>& scan,
+    const std::function<void(Chunk&, int)>& merge) const
+{
+    // A compressed file is assumed to have enough chunks to keep every
+    // thread busy, since its size isn't known until it is decompressed.
+    std::size_t chunkCount{ 0 };
+
+    for (auto& section : sections)
+    {
+        chunkCount += section.compressed != nullptr
+            ? threadCount
+            : std::max<std::size_t>(
+                  (section.end - section.begin + chunkSize - 1) / chunkSize,
+                  1);
+    }
+
+    std::size_t workerCount = std::min<std::size_t>(threadCount, chunkCount);
+
+    // Chunks are split off in order as they are needed rather than all up
+    // front, so scanning a compressed file can start as soon as its first
+    // chunk has been decompressed.
+    std::size_t section{ 0 };
+    std::size_t offset = sections.empty() ? 0 : sections[0].begin;
+
+    auto splitNext = [&](Chunk& chunk) {
+        if (section == sections.size())
+            return false;
+
+        ScopedTimer timer{ statistics, SearchStatistics::Phase::Wait };
+        SplitChunk(sections[section], offset, chunkSize, chunk);
+        offset = chunk.end;
+
+        if (chunk.last && ++section < sections.size())
+            offset = sections[section].begin;
+
+        return true;
+    };
+
+    // Each chunk only knows its line numbers relative to its own start, so
+    // they are offset by the lines in all the chunks before it in the same
+    // file while the chunks are merged in order.
+    int firstLine{ 0 };
+    std::uint32_t file{ 0 };
+
+    auto mergeNext = [&](Chunk& chunk) {
+        if (chunk.file != file)
+        {
+            file = chunk.file;
+            firstLine = 0;
+        }
+
+        if (statistics != nullptr)
+        {
+            statistics->Add(SearchStatistics::Counter::Chunks);
+            statistics->Add(SearchStatistics::Counter::Bytes,
+                            chunk.end - chunk.begin);
+            statistics->Add(SearchStatistics::Counter::Lines,
+                            static_cast<std::uint64_t>(chunk.lineCount));
+
+            if (chunk.last)
+                statistics->Add(SearchStatistics::Counter::Files);
+        }
+
+        ScopedTimer timer{ statistics, SearchStatistics::Phase::Merge };
+        merge(chunk, firstLine);
+        firstLine += chunk.lineCount;
+    };
+
+    auto scanNext = [&](Chunk& chunk) {
+        ScopedTimer timer{ statistics, SearchStatistics::Phase::Scan };
+        scan(chunk);
+    };
+
+    if (workerCount <= 1)
+    {
+        Chunk chunk;
+
+        while (splitNext(chunk))
+        {
+            if (IsCancelled())
+                return false;
+
+            scanNext(chunk);
+            mergeNext(chunk);
+        }
+
+        return true;
+    }
+
+    // The workers split and scan chunks while this thread merges them in
+    // buffer order as soon as each one and all the ones before it are done.
+    // That is what lets results be shown while the search is still running.
+    // Merged chunks are removed, so only the chunks in flight are kept.
+    std::deque<Chunk> chunks;
+    bool split{ false };
+    std::mutex splitMutex;
+    std::mutex mutex;
+    std::condition_variable chunkDone;
+    std::vector<std::thread> workers;
+
+    auto work = [&]() {
+        while (true)
+        {
+            Chunk* chunk;
+
+            {
+                // Splitting can wait for text to be decompressed, which
+                // holds up the other workers without holding up merging.
+                std::lock_guard<std::mutex> splitLock{ splitMutex };
+                Chunk next;
+                bool more = !IsCancelled() && splitNext(next);
+                std::lock_guard<std::mutex> lock{ mutex };
+
+                if (!more)
+                {
+                    split = true;
+                    chunkDone.notify_one();
+                    return;
+                }
+
+                chunks.push_back(std::move(next));
+                chunk = &chunks.back();
+            }
+
+            if (!IsCancelled())
+                scanNext(*chunk);
+
+            {
+                std::lock_guard<std::mutex> lock{ mutex };
+                chunk->done = true;
+            }
+
+            chunkDone.notify_one();
+        }
+    };
+
+    for (std::size_t i = 0; i < workerCount; i++)
+        workers.emplace_back(work);
+
+    bool finished{ true };
+
+    while (true)
+    {
+        Chunk* chunk;
+
+        {
+            std::unique_lock<std::mutex> lock{ mutex };
+            chunkDone.wait(lock, [&]() {
+                return IsCancelled() ||
+                    (chunks.empty() ? split : chunks.front().done);
+            });
+
+            if (IsCancelled())
+            {
+                finished = false;
+                break;
+            }
+
+            if (chunks.empty())
+                break;
+
+            chunk = &chunks.front();
+        }
+
+        mergeNext(*chunk);
+
+        std::lock_guard<std::mutex> lock{ mutex };
+        chunks.pop_front();
+    }
+
+    for (auto& worker : workers)
+        worker.join();
+
+    return finished;
+}
+
+bool SearchEngine::SearchIndex(const SourceFile& source,
+                               const std::vector<Instruction>& instructions,
+                               MatchTable& matches, ScopeTable* scopes) const
+{
+    TokenIndex tokenIndex;
+    wxString indexPath = TokenIndex::PathFor(source.Path());
+    TokenIndex::Stamp stamp = TokenIndex::StampOf(source, dialect);
+    matches.Reset(instructions.size());
+
+    // Building the index is timed as a search of its own, not as the index.
+    bool loaded;
+
+    {
+        ScopedTimer timer{ statistics, SearchStatistics::Phase::Index };
+        loaded = tokenIndex.Load(indexPath, stamp);
+    }
+
+    if (!loaded)
+    {
+        if (!BuildIndex(source, tokenIndex, matches))
+            return true;
+
+        // The index only speeds up later searches, so a file in a folder
+        // that can't be written to is still searched, just not indexed.
+        ScopedTimer timer{ statistics, SearchStatistics::Phase::Index };
+        tokenIndex.Save(indexPath, stamp);
+    }
+
+    {
+        ScopedTimer timer{ statistics, SearchStatistics::Phase::Index };
+
+        if (!tokenIndex.Search(instructions, source.Data(), source.Size(),
+                               dialect, matches) ||
+            (scopes != nullptr &&
+             !tokenIndex.ReadSymbols(source.Data(), source.Size(), dialect,
+                                     *scopes)))
+        {
+            // Remove the damaged index so the next search builds a new one.
+            wxRemoveFile(indexPath);
+            return false;
+        }
+    }
+
+    // A file read from its index isn't split into chunks, so it is only
+    // counted here.
+    if (statistics != nullptr)
+    {
+        if (loaded)
+        {
+            statistics->Add(SearchStatistics::Counter::Files);
+            statistics->Add(SearchStatistics::Counter::Bytes, source.Size());
+            statistics->Add(SearchStatistics::Counter::Lines,
+                            tokenIndex.LineCount());
+        }
+
+        statistics->Add(SearchStatistics::Counter::Matches, matches.Size());
+    }
+
+    SearchProgress progress;
+    progress.bytesScanned = source.Size();
+    progress.totalBytes = source.Size();
+    progress.linesScanned = static_cast<int>(tokenIndex.LineCount());
+    progress.matchCount = matches.Size();
+    progress.filesScanned = 1;
+    progress.fileCount = 1;
+
+    if (progressCallback)
+        progressCallback(progress, matches, 0);
+
+    return true;
+}
+
+bool SearchEngine::BuildIndex(const SourceFile& source,
+                              TokenIndex& tokenIndex,
+                              const MatchTable& matches) const
+{
+    SearchProgress progress;
+    progress.totalBytes = source.Size();
+    progress.fileCount = 1;
+    tokenIndex.Clear();
+
+    bool finished = RunChunks({ SectionOf(source, 0) },
+                              ChunkSize(source.Size()), [&](Chunk& chunk) {
+        ScanTokens(dialect, chunk);
+    }, [&](Chunk& chunk, int firstLine) {
+        std::vector<std::size_t> lists;
+
+        for (auto token : chunk.tokens)
+            lists.push_back(tokenIndex.ListFor(token));
+
+        for (auto& match : chunk.matches)
+        {
+            tokenIndex.Add(lists[match.instruction],
+                           static_cast<std::uint32_t>(firstLine + match.line),
+                           match.offset);
+        }
+
+        for (auto& symbol : chunk.symbols)
+        {
+            tokenIndex.AddSymbol(
+                static_cast<std::uint32_t>(firstLine + symbol.line),
+                symbol.offset);
+        }
+
+        chunk.matches = std::vector<ChunkMatch>{};
+        chunk.tokens = std::vector<std::string_view>{};
+        chunk.symbols = std::vector<ChunkSymbol>{};
+
+        progress.bytesScanned += chunk.end - chunk.begin;
+        progress.linesScanned += chunk.lineCount;
+
+        if (progressCallback)
+            progressCallback(progress, matches, matches.Size());
+    });
+
+    tokenIndex.SetLineCount(static_cast<std::uint32_t>(progress.linesScanned));
+    return finished;
+}
+
+std::size_t SearchEngine::ChunkSize(std::size_t totalSize) const
+{
+    if (fixedChunkSize != 0)
+        return fixedChunkSize;
+
+    std::size_t chunkCount = std::max<std::size_t>(
+        std::min(threadCount * chunksPerThread, totalSize / minChunkSize), 1);
+    chunkCount = std::max(chunkCount,
+                          (totalSize + maxChunkSize - 1) / maxChunkSize);
+    return std::max<std::size_t>(totalSize / chunkCount, 1);
+}
+
+SearchEngine::Section SearchEngine::SectionOf(const SourceFile& source,
+                                              std::uint32_t file)
+{
+    if (source.IsCompressed())
+        return Section{ nullptr, 0, 0, file, &source };
+
+    return Section{ source.Data(), 0, source.Size(), file };
+}
+
+void SearchEngine::SplitChunk(const Section& section, std::size_t begin,
+                              std::size_t chunkSize, Chunk& chunk)
+{
+    if (section.compressed == nullptr)
+    {
+        std::size_t chunkEnd = std::min(begin + chunkSize, section.end);
+
+        // Chunks only end right after a "\n". That can never split a line,
+        // including one that ends in "\r\n", so each chunk can be scanned
+        // on its own.
+        if (chunkEnd < section.end)
+        {
+            const void* newline = std::memchr(section.data + chunkEnd, '\n',
+                                              section.end - chunkEnd);
+            chunkEnd = newline != nullptr
+                ? static_cast<const char*>(newline) - section.data + 1
+                : section.end;
+        }
+
+        chunk = Chunk{ section.data, begin, chunkEnd, section.file,
+                       chunkEnd == section.end };
+        return;
+    }
+
+    // The text of a compressed file is waited for as it is decompressed: a
+    // chunk's worth of it, then as much more as it takes to end a line.
+    const SourceFile& source = *section.compressed;
+    const char* data = source.Data();
+    std::size_t searched = begin + chunkSize;
+    std::size_t ready = source.WaitForSize(searched + 1);
+
+    while (searched < ready)
+    {
+        const void* newline = std::memchr(data + searched, '\n',
+                                          ready - searched);
+
+        if (newline != nullptr)
+        {
+            std::size_t chunkEnd =
+                static_cast<const char*>(newline) - data + 1;
+            bool last = source.WaitForSize(chunkEnd + 1) == chunkEnd;
+            chunk = Chunk{ data, begin, chunkEnd, section.file, last };
+            return;
+        }
+
+        searched = ready;
+        ready = source.WaitForSize(ready + chunkSize);
+    }
+
+    // The text ended before another line did.
+    chunk = Chunk{ data, begin, ready, section.file, true };
+}
+
+void SearchEngine::ScanChunk(const InstructionIndex& index,
+                             const Dialect& dialect, Chunk& chunk)
+{
+    LineScanner scanner{ chunk.data, chunk.begin, chunk.end };
+    InstructionIndex::Cache cache;
+    std::string_view operands;
+
+    while (scanner.Next())
+    {
+        // Every line counts towards the line table, including the ones
+        // that are skipped.
+        if (scanner.Number() % LineTable::interval == 0)
+            chunk.lineOffsets.push_back(scanner.Offset());
+
+        std::string_view text = scanner.Text();
+        FindScope(dialect, scanner, text, chunk);
+
+        std::string_view token = dialect.Split(text, operands);
+
+        // Comment, directive and label lines are skipped without looking
+        // anything up.
+        if (token.empty())
+            continue;
+
+        // The line is recorded once for every instruction with its token,
+        // so the rows of each line stay in instruction order.
+        for (int i = index.Find(token, operands, cache);
+             i != InstructionIndex::notFound; i = index.NextAlias(i))
+        {
+            chunk.matches.push_back(ChunkMatch{ i, scanner.Number(),
+                                                scanner.Offset() });
+        }
+    }
+
+    chunk.lineCount = scanner.Number();
+}
+
+void SearchEngine::ScanTokens(const Dialect& dialect, Chunk& chunk)
+{
+    // Most tokens repeat many times in a chunk, so each distinct one is
+    // only lowercased and looked up in the index once, when it is merged.
+    TokenCounter counter;
+    LineScanner scanner{ chunk.data, chunk.begin, chunk.end };
+
+    while (scanner.Next())
+    {
+        std::string_view text = scanner.Text();
+        FindScope(dialect, scanner, text, chunk);
+
+        std::string_view operands;
+        std::string_view token = dialect.Split(text, operands);
+
+        if (token.empty())
+            continue;
+
+        std::size_t id = counter.Add(token);
+
+        if (id == chunk.tokens.size())
+            chunk.tokens.push_back(token);
+
+        chunk.matches.push_back(ChunkMatch{ static_cast<int>(id),
+                                            scanner.Number(),
+                                            scanner.Offset() });
+    }
+
+    chunk.lineCount = scanner.Number();
+}
+
+void SearchEngine::AnalyzeChunk(const InstructionIndex& index,
+                                const Dialect& dialect, Chunk& chunk)
+{
+    TokenCounter counter;
+    LineScanner scanner{ chunk.data, chunk.begin, chunk.end };
+    InstructionIndex::Cache cache;
+    std::string_view operands;
+
+    while (scanner.Next())
+    {
+        if (scanner.Number() % LineTable::interval == 0)
+            chunk.lineOffsets.push_back(scanner.Offset());
+
+        std::string_view text = scanner.Text();
+        FindScope(dialect, scanner, text, chunk);
+
+        std::string_view token = dialect.Split(text, operands);
+
+        if (token.empty())
+            continue;
+
+        counter.Add(token);
+        chunk.tokenLines.push_back(scanner.Number());
+
+        for (int i = index.Find(token, operands, cache);
+             i != InstructionIndex::notFound; i = index.NextAlias(i))
+        {
+            chunk.matches.push_back(ChunkMatch{ i, scanner.Number(),
+                                                scanner.Offset() });
+        }
+    }
+
+    chunk.tokenCounts = counter.Entries();
+    chunk.lineCount = scanner.Number();
+}
+
+void SearchEngine::FindScope(const Dialect& dialect,
+                             const LineScanner& scanner, std::string_view text,
+                             Chunk& chunk)
+{
+    ScopeTable::Kind kind{ ScopeTable::Kind::Function };
+    std::string_view name = dialect.Symbol(text);
+
+    if (name.empty())
+    {
+        kind = ScopeTable::Kind::Section;
+        name = dialect.Section(text);
+    }
+
+    if (!name.empty())
+    {
+        chunk.symbols.push_back(ChunkSymbol{ scanner.Number(),
+                                             scanner.Offset(), kind, name });
+    }
+}
+
+void SearchEngine::FinishFile(const Chunk& chunk, const SourceFile& source,
+                              SearchProgress& progress)
+{
+    progress.filesScanned = chunk.file + 1;
+
+    if (source.IsCompressed())
+    {
+        progress.totalBytes = progress.totalBytes - source.EstimatedSize() +
+            chunk.end;
+    }
+}
+
+void SearchEngine::AddLines(Chunk& chunk, int firstLine) const
+{
+    if (lineTables != nullptr)
+    {
+        (*lineTables)[chunk.file].Add(
+            chunk.begin, chunk.lineOffsets,
+            static_cast<std::uint32_t>(chunk.lineCount));
+    }
+
+    chunk.lineOffsets = std::vector<std::size_t>{};
+    AddSymbols(chunk, firstLine, scopeTables != nullptr
+                                     ? &(*scopeTables)[chunk.file]
+                                     : nullptr);
+}
+
+void SearchEngine::AddSymbols(Chunk& chunk, int firstLine,
+                              ScopeTable* scopes)
+{
+    if (scopes != nullptr)
+    {
+        for (auto& symbol : chunk.symbols)
+        {
+            scopes->Add(symbol.kind,
+                        static_cast<std::uint32_t>(firstLine + symbol.line),
+                        symbol.name);
+        }
+    }
+
+    chunk.symbols = std::vector<ChunkSymbol>{};
+}
+
+void SearchEngine::MergeChunk(Chunk& chunk, int firstLine,
+                              MatchTable& matches,
+                              SearchProgress& progress) const
+{
+    std::size_t firstRow = matches.Size();
+
+    for (auto& match : chunk.matches)
+    {
+        matches.Add(static_cast<std::uint32_t>(match.instruction),
+                    static_cast<std::uint32_t>(firstLine + match.line),
+                    match.offset, chunk.file);
+    }
+
+    if (statistics != nullptr)
+    {
+        statistics->Add(SearchStatistics::Counter::Matches,
+                        chunk.matches.size());
+    }
+
+    chunk.matches = std::vector<ChunkMatch>{};
+
+    progress.bytesScanned += chunk.end - chunk.begin;
+    progress.linesScanned += chunk.lineCount;
+    progress.matchCount = matches.Size();
+
+    if (progressCallback)
+        progressCallback(progress, matches, firstRow);
+}
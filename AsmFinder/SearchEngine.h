@@ -0,0 +1,438 @@
+// SearchEngine.h - Declares the SearchEngine class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SEARCH_ENGINE_H
+#define SEARCH_ENGINE_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+#include "Dialect.h"
+#include "Instruction.h"
+#include "InstructionIndex.h"
+#include "LineScanner.h"
+#include "LineTable.h"
+#include "MatchTable.h"
+#include "MnemonicHistogram.h"
+#include "ScopeTable.h"
+#include "SearchStatistics.h"
+#include "SourceFile.h"
+#include "TokenCounter.h"
+#include "TokenIndex.h"
+
+/// @brief Describes how far a search has got.
+struct SearchProgress
+{
+    std::size_t bytesScanned{ 0 };
+    std::size_t totalBytes{ 0 };
+    int linesScanned{ 0 };
+    std::size_t matchCount{ 0 };
+    std::size_t filesScanned{ 0 };
+    std::size_t fileCount{ 0 };
+};
+
+/// @brief Receives the progress of a search, the matches found so far and
+/// the row of the first match added since the last time it was called.
+using SearchProgressCallback = std::function<void(
+    const SearchProgress&, const MatchTable&, std::size_t)>;
+
+/// @brief Searches a text buffer for instructions on a pool of threads.
+///
+/// The buffer is split into chunks that start and end on line boundaries.
+/// Each chunk is scanned on its own and the matches are merged back in line
+/// order, so the output is the same no matter how many threads are used.
+/// Many files are searched the same way, with every file split into chunks
+/// that all go to the same pool, so a single huge file can't hold up the
+/// rest.
+class SearchEngine
+{
+public:
+    /// @brief Default constructor; uses one thread per hardware thread.
+    SearchEngine();
+
+    /// @brief Gets the number of threads a search uses.
+    /// @return The number of threads, which is at least 1.
+    unsigned ThreadCount() const { return threadCount; }
+
+    /// @brief Sets the number of threads a search uses.
+    /// @param count The number of threads. Zero uses one per hardware
+    /// thread and 1 searches on the calling thread only.
+    void SetThreadCount(unsigned count);
+
+    /// @brief Sets the function that is called as the search progresses.
+    /// @param callback The function to call. It is called on the thread the
+    /// search runs on, each time another part of the file has been merged
+    /// into the results.
+    void SetProgressCallback(SearchProgressCallback callback)
+    {
+        progressCallback = std::move(callback);
+    }
+
+    /// @brief Sets the flag that cancels a search.
+    /// @param flag A flag another thread sets to stop the search, or nullptr
+    /// if it can't be cancelled. Must outlive any search.
+    /// @post A cancelled search returns soon after the flag is set, leaving
+    /// the matches found up to that point.
+    void SetCancelFlag(const std::atomic<bool>* flag) { cancelFlag = flag; }
+
+    /// @brief Sets the statistics that searches are measured in.
+    /// @param statistics The statistics to add the time of each phase and
+    /// the counters to, or nullptr to not measure searches. Must outlive any
+    /// search.
+    void SetStatistics(SearchStatistics* statistics)
+    {
+        this->statistics = statistics;
+    }
+
+    /// @brief Sets the tables that receive where the lines of each file
+    /// start as the files are searched.
+    /// @param lineTables The tables, which searches of many files replace
+    /// with one per file, or nullptr to not keep them. Files answered from
+    /// their index are left with an empty table. Must outlive any search.
+    void SetLineTables(std::vector<LineTable>* lineTables)
+    {
+        this->lineTables = lineTables;
+    }
+
+    /// @brief Sets the tables that receive the functions and sections of
+    /// each file as the files are searched.
+    /// @param scopeTables The tables, which searches of many files replace
+    /// with one per file, or nullptr to not find them. Files answered from
+    /// their index read them from it. Must outlive any search.
+    void SetScopeTables(std::vector<ScopeTable>* scopeTables)
+    {
+        this->scopeTables = scopeTables;
+    }
+
+    /// @brief Gets whether searches use a saved TokenIndex.
+    /// @return True if the index is used, otherwise false.
+    bool UsesIndex() const { return useIndex; }
+
+    /// @brief Sets whether searches use a saved TokenIndex.
+    /// @param enabled True to answer searches from the index saved next to
+    /// the source file, building it first if it is missing or out of date.
+    void SetUseIndex(bool enabled) { useIndex = enabled; }
+
+    /// @brief Gets how the mnemonic of each line is found.
+    /// @return The dialect of the source files.
+    const Dialect& GetDialect() const { return dialect; }
+
+    /// @brief Sets how the mnemonic of each line is found.
+    /// @param newDialect The dialect of the source files.
+    void SetDialect(const Dialect& newDialect) { dialect = newDialect; }
+
+    /// @brief Sets the size the text is split into for the threads.
+    /// @param size The size of each chunk before it is moved to the end of
+    /// a line, or zero to pick one from the size of the text. A tiny size
+    /// splits even a short listing into many chunks, which tests use to
+    /// check the chunks are put back together correctly.
+    void SetChunkSize(std::size_t size) { fixedChunkSize = size; }
+
+    /// @brief Searches a source file for instructions.
+    /// @param source The assembly language source file.
+    /// @param instructions The instructions to search for.
+    /// @param matches Receives every matching line in line order.
+    /// @post matches holds only the matches from this search, exactly as a
+    /// line by line search would find them.
+    void Search(const SourceFile& source,
+                const std::vector<Instruction>& instructions,
+                MatchTable& matches) const;
+
+    /// @brief Searches many source files for instructions at once.
+    /// @param sources The source files. Files that aren't open are treated
+    /// as empty.
+    /// @param instructions The instructions to search for.
+    /// @param matches Receives every matching line, in the order of the
+    /// files and then in line order, with the position of its file.
+    /// @post The progress callback's filesScanned is the number of files
+    /// whose matches have all been added.
+    void Search(const std::vector<SourceFile>& sources,
+                const std::vector<Instruction>& instructions,
+                MatchTable& matches) const;
+
+    /// @brief Searches many source files for instructions and counts every
+    /// mnemonic in them in the same pass. The saved index is never used,
+    /// since every line has to be read to count its mnemonic.
+    /// @param sources The source files. Files that aren't open are treated
+    /// as empty.
+    /// @param instructions The instructions to search for, which can be
+    /// empty to only count the mnemonics.
+    /// @param matches Receives every matching line, the same as Search().
+    /// @param histogram Receives the count of every mnemonic and the
+    /// windows of each file, in windows of the size it already has.
+    void Analyze(const std::vector<SourceFile>& sources,
+                 const std::vector<Instruction>& instructions,
+                 MatchTable& matches, MnemonicHistogram& histogram) const;
+
+    /// @brief Searches some of the lines of a source file.
+    /// @param source The assembly language source file.
+    /// @param begin The offset of the first line to search.
+    /// @param end The offset of the line after the last one to search, or
+    /// the size of the file.
+    /// @param firstLine The number of lines before begin.
+    /// @param instructions The instructions to search for.
+    /// @param matches Receives every matching line in the range, numbered
+    /// and placed as they are in the whole file.
+    void Search(const SourceFile& source, std::size_t begin, std::size_t end,
+                std::uint32_t firstLine,
+                const std::vector<Instruction>& instructions,
+                MatchTable& matches) const;
+
+    /// @brief Searches a buffer for the indexed instructions.
+    /// @param data The text to search.
+    /// @param size The size of the text in bytes.
+    /// @param index An index built from the instructions.
+    /// @param matches Receives every matching line in line order, after any
+    /// matches it already holds.
+    void Search(const char* data, std::size_t size,
+                const InstructionIndex& index, MatchTable& matches) const;
+private:
+    /// @brief A line that matched, found by a worker before line numbers
+    /// are known. When an index is built, every line with a token is a
+    /// match and instruction is the position of its token in the chunk.
+    struct ChunkMatch
+    {
+        int instruction;
+        int line;
+        std::size_t offset;
+    };
+
+    /// @brief A line that starts a function or section, found by a worker
+    /// before line numbers are known.
+    struct ChunkSymbol
+    {
+        int line;
+        std::size_t offset;
+        ScopeTable::Kind kind;
+        std::string_view name;
+    };
+
+    /// @brief A range of text to search, which is split into chunks as the
+    /// search reaches it.
+    struct Section
+    {
+        const char* data;
+        std::size_t begin;
+        std::size_t end;
+        std::uint32_t file;
+
+        /// @brief The compressed file the text is still being decompressed
+        /// from, in which case data and end aren't known yet, or nullptr if
+        /// the text is all in memory.
+        const SourceFile* compressed{ nullptr };
+    };
+
+    /// @brief A newline aligned section of the buffer and its matches.
+    struct Chunk
+    {
+        const char* data;
+        std::size_t begin;
+        std::size_t end;
+        std::uint32_t file{ 0 };
+        bool last{ false };
+        int lineCount{ 0 };
+        bool done{ false };
+        std::vector<ChunkMatch> matches;
+        std::vector<std::size_t> lineOffsets;
+        std::vector<ChunkSymbol> symbols;
+        std::vector<std::string_view> tokens;
+        std::vector<TokenCounter::Entry> tokenCounts;
+        std::vector<int> tokenLines;
+    };
+
+    unsigned threadCount;
+    SearchProgressCallback progressCallback;
+    const std::atomic<bool>* cancelFlag{ nullptr };
+    SearchStatistics* statistics{ nullptr };
+    std::vector<LineTable>* lineTables{ nullptr };
+    std::vector<ScopeTable>* scopeTables{ nullptr };
+    bool useIndex{ false };
+    Dialect dialect;
+    std::size_t fixedChunkSize{ 0 };
+
+    /// @brief Determines if the search has been cancelled.
+    /// @return True if the cancel flag is set, otherwise false.
+    bool IsCancelled() const
+    {
+        return cancelFlag != nullptr && cancelFlag->load();
+    }
+
+    /// @brief Gets the size to split text into.
+    /// @param totalSize The size of all the text being searched.
+    /// @return The size of each chunk, before it is moved to a line end.
+    std::size_t ChunkSize(std::size_t totalSize) const;
+
+    /// @brief Gets the text of a source file as a section.
+    /// @param source The source file.
+    /// @param file The position of the file in the search.
+    /// @return The section, which doesn't start decompressing the text of
+    /// a compressed file until its first chunk is split off.
+    static Section SectionOf(const SourceFile& source, std::uint32_t file);
+
+    /// @brief Splits the next newline aligned chunk off a section, waiting
+    /// for the text of a compressed file to be decompressed if it has to.
+    /// @param section The section to split.
+    /// @param begin The offset of the first line of the chunk.
+    /// @param chunkSize The size from ChunkSize().
+    /// @param chunk Receives the chunk, which is the last one of the
+    /// section if it reaches the end. An empty section still gets a single
+    /// empty chunk.
+    static void SplitChunk(const Section& section, std::size_t begin,
+                           std::size_t chunkSize, Chunk& chunk);
+
+    /// @brief Splits sections into chunks, scans them on the worker threads
+    /// and merges them in order on the calling thread.
+    /// @param sections The sections, in file order.
+    /// @param chunkSize The size from ChunkSize().
+    /// @param scan Scans a chunk. Called on any thread.
+    /// @param merge Merges a scanned chunk, given the number of lines before
+    /// it in its file. Called on the calling thread, one chunk at a time.
+    /// @return True if every chunk was merged, or false if the search was
+    /// cancelled.
+    bool RunChunks(const std::vector<Section>& sections,
+                   std::size_t chunkSize,
+                   const std::function<void(Chunk&)>& scan,
+                   const std::function<void(Chunk&, int)>& merge) const;
+
+    /// @brief Searches a single section for the indexed instructions.
+    /// @param section The section to search.
+    /// @param size The size of the section, or a guess of it if it is
+    /// compressed.
+    /// @param index An index built from the instructions.
+    /// @param matches Receives every matching line in line order, after any
+    /// matches it already holds.
+    /// @param scopes Receives the functions and sections of the section, or
+    /// nullptr to not find them.
+    void SearchSection(const Section& section, std::size_t size,
+                       const InstructionIndex& index, MatchTable& matches,
+                       ScopeTable* scopes = nullptr) const;
+
+    /// @brief Searches a single source file, through its index if one is
+    /// used.
+    /// @param source The source file.
+    /// @param instructions The instructions to search for.
+    /// @param matches Receives every matching line in line order.
+    /// @param scopes Receives the functions and sections of the file, or
+    /// nullptr to not find them.
+    void SearchFile(const SourceFile& source,
+                    const std::vector<Instruction>& instructions,
+                    MatchTable& matches, ScopeTable* scopes) const;
+
+    /// @brief Searches many source files through their saved indexes, one
+    /// file after another.
+    /// @param sources The source files.
+    /// @param instructions The instructions to search for.
+    /// @param matches Receives every matching line.
+    /// @param progress The progress so far, updated for each file.
+    void SearchEachFile(const std::vector<SourceFile>& sources,
+                        const std::vector<Instruction>& instructions,
+                        MatchTable& matches, SearchProgress& progress) const;
+
+    /// @brief Answers a search from the index saved next to the source file.
+    /// @param source The source file.
+    /// @param instructions The instructions to search for.
+    /// @param matches Receives every matching line in line order.
+    /// @param scopes Receives the functions and sections of the file, or
+    /// nullptr to not read them.
+    /// @return True if the search was answered or cancelled, or false if
+    /// the index is damaged and the file has to be scanned instead.
+    bool SearchIndex(const SourceFile& source,
+                     const std::vector<Instruction>& instructions,
+                     MatchTable& matches, ScopeTable* scopes) const;
+
+    /// @brief Builds an index of every line's first token and the lines
+    /// that start functions and sections.
+    /// @param source The source file.
+    /// @param tokenIndex Receives the index.
+    /// @param matches The matches reported to the progress callback, which
+    /// stay empty while the index is built.
+    /// @return True if the index was built, or false if the search was
+    /// cancelled.
+    bool BuildIndex(const SourceFile& source, TokenIndex& tokenIndex,
+                    const MatchTable& matches) const;
+
+    /// @brief Scans a single chunk.
+    /// @param index The index to look tokens up in.
+    /// @param dialect Finds the mnemonic of each line.
+    /// @param chunk The chunk to scan.
+    /// @post chunk has its line count, matches, line offsets and scopes.
+    static void ScanChunk(const InstructionIndex& index,
+                          const Dialect& dialect, Chunk& chunk);
+
+    /// @brief Scans a single chunk for the mnemonic of every line.
+    /// @param dialect Finds the mnemonic of each line.
+    /// @param chunk The chunk to scan.
+    /// @post chunk has its line count, its distinct tokens, its scopes and
+    /// a match for every line that has a mnemonic.
+    static void ScanTokens(const Dialect& dialect, Chunk& chunk);
+
+    /// @brief Scans a single chunk for instructions and counts the mnemonic
+    /// of every line.
+    /// @param index The index to look tokens up in.
+    /// @param dialect Finds the mnemonic of each line.
+    /// @param chunk The chunk to scan.
+    /// @post chunk has its line count, its matches, its line offsets, its
+    /// scopes, the count of each distinct token and the number of every
+    /// line that has one.
+    static void AnalyzeChunk(const InstructionIndex& index,
+                             const Dialect& dialect, Chunk& chunk);
+
+    /// @brief Adds the function or section a line starts to its chunk, if
+    /// it starts one.
+    /// @param dialect Finds the function or section of the line.
+    /// @param scanner The scanner, on the line.
+    /// @param text The text of the line.
+    /// @param chunk The chunk the line is in.
+    static void FindScope(const Dialect& dialect, const LineScanner& scanner,
+                          std::string_view text, Chunk& chunk);
+
+    /// @brief Updates the progress once the last chunk of a file has been
+    /// scanned, before it is merged.
+    /// @param chunk The last chunk of the file.
+    /// @param source The file.
+    /// @param progress The progress so far, which only had a guess of the
+    /// size of a compressed file until now.
+    static void FinishFile(const Chunk& chunk, const SourceFile& source,
+                           SearchProgress& progress);
+
+    /// @brief Adds the lines of a scanned chunk to the line table of its
+    /// file and its scopes to the scope table of its file, if the tables are
+    /// being kept.
+    /// @param chunk The chunk, which must follow the last chunk added from
+    /// the same file.
+    /// @param firstLine The number of lines before the chunk.
+    void AddLines(Chunk& chunk, int firstLine) const;
+
+    /// @brief Adds the functions and sections of a scanned chunk to a scope
+    /// table.
+    /// @param chunk The chunk.
+    /// @param firstLine The number of lines before the chunk.
+    /// @param scopes The table to add them to, or nullptr to only free
+    /// them.
+    static void AddSymbols(Chunk& chunk, int firstLine, ScopeTable* scopes);
+
+    /// @brief Merges a scanned chunk into the matches.
+    /// @param chunk The chunk to merge.
+    /// @param firstLine The number of lines before the chunk.
+    /// @param matches Receives the chunk's matching lines.
+    /// @param progress The progress so far, updated for the chunk.
+    void MergeChunk(Chunk& chunk, int firstLine, MatchTable& matches,
+                    SearchProgress& progress) const;
+};
+
+#endif
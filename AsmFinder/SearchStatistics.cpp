@@ -0,0 +1,303 @@
+// SearchStatistics.cpp - Defines the SearchStatistics class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SearchStatistics.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <string>
+#include <wx/ffile.h>
+
+namespace
+{
+    // Every span is kept up to this many, which covers searches of many
+    // gigabytes with room to spare while keeping the trace small enough to
+    // open. Spans past it still add to the totals.
+    constexpr std::size_t maxEvents{ 1 << 17 };
+
+    void AppendNumber(std::string& output, std::int64_t number)
+    {
+        char digits[20];
+        auto result = std::to_chars(digits, digits + sizeof(digits), number);
+        output.append(digits, result.ptr - digits);
+    }
+
+    void AppendSeconds(std::string& output, double seconds)
+    {
+        char digits[32];
+        int length = std::snprintf(digits, sizeof(digits), "%.6f", seconds);
+        output.append(digits, static_cast<std::size_t>(length));
+    }
+
+    bool WriteFile(const wxString& path, const std::string& text)
+    {
+        wxFFile file{ path, "wb" };
+
+        return file.IsOpened() &&
+            file.Write(text.data(), text.size()) == text.size() &&
+            file.Close();
+    }
+}
+
+const char* SearchStatistics::PhaseName(Phase phase)
+{
+    switch (phase)
+    {
+    case Phase::Open:
+        return "open";
+    case Phase::Wait:
+        return "wait";
+    case Phase::Scan:
+        return "scan";
+    case Phase::Merge:
+        return "merge";
+    case Phase::Index:
+        return "index";
+    case Phase::Display:
+        return "display";
+    default:
+        return "";
+    }
+}
+
+const char* SearchStatistics::CounterName(Counter counter)
+{
+    switch (counter)
+    {
+    case Counter::Files:
+        return "files";
+    case Counter::Bytes:
+        return "bytes";
+    case Counter::Lines:
+        return "lines";
+    case Counter::Chunks:
+        return "chunks";
+    case Counter::Matches:
+        return "matches";
+    case Counter::Updates:
+        return "updates";
+    default:
+        return "";
+    }
+}
+
+void SearchStatistics::Reset()
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    start = Clock::now();
+    end = start;
+    finished = false;
+    times.fill(Clock::duration::zero());
+    calls.fill(0);
+    counts.fill(0);
+    threads.clear();
+    events.clear();
+    droppedEvents = 0;
+}
+
+void SearchStatistics::Finish()
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    end = Clock::now();
+    finished = true;
+}
+
+void SearchStatistics::Add(Phase phase, Clock::time_point begin,
+                           Clock::time_point end)
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    std::size_t i = static_cast<std::size_t>(phase);
+    times[i] += end - begin;
+    calls[i]++;
+
+    if (events.size() < maxEvents)
+        events.push_back(Event{ phase, ThreadNumber(), begin, end });
+    else
+        droppedEvents++;
+}
+
+void SearchStatistics::Add(Counter counter, std::uint64_t amount)
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    counts[static_cast<std::size_t>(counter)] += amount;
+}
+
+double SearchStatistics::Seconds(Phase phase) const
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    return std::chrono::duration<double>(
+        times[static_cast<std::size_t>(phase)]).count();
+}
+
+std::uint64_t SearchStatistics::Calls(Phase phase) const
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    return calls[static_cast<std::size_t>(phase)];
+}
+
+std::uint64_t SearchStatistics::Count(Counter counter) const
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    return counts[static_cast<std::size_t>(counter)];
+}
+
+double SearchStatistics::WallSeconds() const
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    return std::chrono::duration<double>(
+        (finished ? end : Clock::now()) - start).count();
+}
+
+std::size_t SearchStatistics::ThreadCount() const
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    return threads.size();
+}
+
+wxString SearchStatistics::Summary() const
+{
+    wxString summary = wxString::Format("%.2f s", WallSeconds());
+    wxString phaseTimes;
+
+    for (Phase phase : phases)
+    {
+        if (Calls(phase) == 0)
+            continue;
+
+        if (!phaseTimes.empty())
+            phaseTimes << ", ";
+
+        phaseTimes << PhaseName(phase) << ' ';
+        phaseTimes << wxString::Format("%.2f s", Seconds(phase));
+    }
+
+    if (!phaseTimes.empty())
+        summary << " (" << phaseTimes << ')';
+
+    return summary;
+}
+
+bool SearchStatistics::WriteJson(const wxString& path) const
+{
+    std::string json{ "{\"wallSeconds\":" };
+    AppendSeconds(json, WallSeconds());
+
+    std::lock_guard<std::mutex> lock{ mutex };
+    json += ",\"threads\":";
+    AppendNumber(json, static_cast<std::int64_t>(threads.size()));
+    json += ",\"phases\":{";
+
+    for (std::size_t i = 0; i < phaseCount; i++)
+    {
+        if (i > 0)
+            json += ',';
+
+        json += '"';
+        json += PhaseName(phases[i]);
+        json += "\":{\"seconds\":";
+        AppendSeconds(json, std::chrono::duration<double>(times[i]).count());
+        json += ",\"calls\":";
+        AppendNumber(json, static_cast<std::int64_t>(calls[i]));
+        json += '}';
+    }
+
+    json += "},\"counters\":{";
+
+    for (std::size_t i = 0; i < counterCount; i++)
+    {
+        if (i > 0)
+            json += ',';
+
+        json += '"';
+        json += CounterName(counters[i]);
+        json += "\":";
+        AppendNumber(json, static_cast<std::int64_t>(counts[i]));
+    }
+
+    json += "}}\n";
+    return WriteFile(path, json);
+}
+
+bool SearchStatistics::WriteTrace(const wxString& path) const
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+
+    // Each span is a complete event with its start and duration in
+    // microseconds, on the row of the thread it ran on.
+    std::string trace{ "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" };
+
+    for (std::size_t i = 0; i < events.size(); i++)
+    {
+        const Event& event = events[i];
+
+        if (i > 0)
+            trace += ",\n";
+
+        trace += "{\"name\":\"";
+        trace += PhaseName(event.phase);
+        trace += "\",\"cat\":\"search\",\"ph\":\"X\",\"ts\":";
+        AppendNumber(trace, Microseconds(event.begin));
+        trace += ",\"dur\":";
+        AppendNumber(trace, Microseconds(event.end) -
+                     Microseconds(event.begin));
+        trace += ",\"pid\":1,\"tid\":";
+        AppendNumber(trace, event.thread);
+        trace += '}';
+    }
+
+    // The counters are shown as a single sample at the end of the search.
+    if (!events.empty())
+        trace += ",\n";
+
+    trace += "{\"name\":\"counters\",\"ph\":\"C\",\"ts\":";
+    AppendNumber(trace, Microseconds(finished ? end : Clock::now()));
+    trace += ",\"pid\":1,\"args\":{";
+
+    for (std::size_t i = 0; i < counterCount; i++)
+    {
+        if (i > 0)
+            trace += ',';
+
+        trace += '"';
+        trace += CounterName(counters[i]);
+        trace += "\":";
+        AppendNumber(trace, static_cast<std::int64_t>(counts[i]));
+    }
+
+    trace += "}}],\"otherData\":{\"droppedEvents\":";
+    AppendNumber(trace, static_cast<std::int64_t>(droppedEvents));
+    trace += "}}\n";
+    return WriteFile(path, trace);
+}
+
+std::uint32_t SearchStatistics::ThreadNumber()
+{
+    std::thread::id id = std::this_thread::get_id();
+    auto found = std::find(threads.begin(), threads.end(), id);
+
+    if (found != threads.end())
+        return static_cast<std::uint32_t>(found - threads.begin());
+
+    threads.push_back(id);
+    return static_cast<std::uint32_t>(threads.size() - 1);
+}
+
+std::int64_t SearchStatistics::Microseconds(Clock::time_point time) const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        time - start).count();
+}
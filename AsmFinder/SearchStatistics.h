@@ -0,0 +1,181 @@
+// SearchStatistics.h - Declares the SearchStatistics class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SEARCH_STATISTICS_H
+#define SEARCH_STATISTICS_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <wx/string.h>
+
+/// @brief Measures where the time of a search goes.
+///
+/// Each phase of a search adds up the time spent in it on every thread, and
+/// the counters add up how much was read and found. Every span of time is
+/// also kept, up to a limit, so it can be saved as a Chrome trace that
+/// shows what each thread was doing. Any thread can add to the statistics
+/// while any other reads them.
+class SearchStatistics
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief The parts of a search that are timed.
+    enum class Phase
+    {
+        Open,
+        Wait,
+        Scan,
+        Merge,
+        Index,
+        Display
+    };
+
+    /// @brief Every phase, in the order they are shown.
+    static constexpr Phase phases[]{ Phase::Open, Phase::Wait, Phase::Scan,
+                                     Phase::Merge, Phase::Index,
+                                     Phase::Display };
+
+    /// @brief The amounts that are counted.
+    enum class Counter
+    {
+        Files,
+        Bytes,
+        Lines,
+        Chunks,
+        Matches,
+        Updates
+    };
+
+    /// @brief Every counter, in the order they are shown.
+    static constexpr Counter counters[]{ Counter::Files, Counter::Bytes,
+                                         Counter::Lines, Counter::Chunks,
+                                         Counter::Matches, Counter::Updates };
+
+    /// @brief A span of time a thread spent in a phase.
+    struct Event
+    {
+        Phase phase;
+        std::uint32_t thread;
+        Clock::time_point begin;
+        Clock::time_point end;
+    };
+
+    /// @brief Default constructor; starts measuring from now.
+    SearchStatistics() { Reset(); }
+
+    SearchStatistics(const SearchStatistics&) = delete;
+    SearchStatistics& operator=(const SearchStatistics&) = delete;
+
+    /// @brief Gets the name of a phase.
+    /// @param phase The phase.
+    /// @return The name, in lowercase.
+    static const char* PhaseName(Phase phase);
+
+    /// @brief Gets the name of a counter.
+    /// @param counter The counter.
+    /// @return The name, in lowercase.
+    static const char* CounterName(Counter counter);
+
+    /// @brief Clears every time and counter and starts measuring from now.
+    void Reset();
+
+    /// @brief Stops measuring the time the whole search takes.
+    void Finish();
+
+    /// @brief Adds a span of time the calling thread spent in a phase.
+    /// @param phase The phase.
+    /// @param begin When the span started.
+    /// @param end When the span ended.
+    void Add(Phase phase, Clock::time_point begin, Clock::time_point end);
+
+    /// @brief Adds to a counter.
+    /// @param counter The counter.
+    /// @param amount The amount to add.
+    void Add(Counter counter, std::uint64_t amount = 1);
+
+    /// @brief Gets the time spent in a phase.
+    /// @param phase The phase.
+    /// @return The time in seconds, added up over every thread.
+    double Seconds(Phase phase) const;
+
+    /// @brief Gets how many spans of time were spent in a phase.
+    /// @param phase The phase.
+    /// @return The number of spans.
+    std::uint64_t Calls(Phase phase) const;
+
+    /// @brief Gets the value of a counter.
+    /// @param counter The counter.
+    /// @return The value.
+    std::uint64_t Count(Counter counter) const;
+
+    /// @brief Gets the time from Reset() until Finish(), or until now if it
+    /// hasn't been called.
+    /// @return The time in seconds.
+    double WallSeconds() const;
+
+    /// @brief Gets the number of threads that have added spans of time.
+    /// @return The number of threads.
+    std::size_t ThreadCount() const;
+
+    /// @brief Describes the statistics in a single line.
+    /// @return The wall time and the time of each phase that was entered.
+    wxString Summary() const;
+
+    /// @brief Saves the statistics as a JSON object.
+    /// @param path The path of the file to write.
+    /// @return True if the file was written, otherwise false.
+    bool WriteJson(const wxString& path) const;
+
+    /// @brief Saves the spans of time as a Chrome trace, which chrome://tracing
+    /// and Perfetto can show.
+    /// @param path The path of the file to write.
+    /// @return True if the file was written, otherwise false.
+    bool WriteTrace(const wxString& path) const;
+private:
+    static constexpr std::size_t phaseCount{ std::size(phases) };
+    static constexpr std::size_t counterCount{ std::size(counters) };
+
+    mutable std::mutex mutex;
+    Clock::time_point start;
+    Clock::time_point end;
+    bool finished{ false };
+    std::array<Clock::duration, phaseCount> times{};
+    std::array<std::uint64_t, phaseCount> calls{};
+    std::array<std::uint64_t, counterCount> counts{};
+    std::vector<std::thread::id> threads;
+    std::vector<Event> events;
+    std::uint64_t droppedEvents{ 0 };
+
+    /// @brief Gets the number of the calling thread, in the order threads
+    /// first added spans. Must be called with the mutex locked.
+    /// @return The number of the thread, starting from 0.
+    std::uint32_t ThreadNumber();
+
+    /// @brief Gets a time as a number of microseconds since Reset(). Must
+    /// be called with the mutex locked.
+    /// @param time The time.
+    /// @return The number of microseconds.
+    std::int64_t Microseconds(Clock::time_point time) const;
+};
+
+#endif
@@ -0,0 +1,223 @@
+// SourceFile.cpp - Defines the SourceFile class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SourceFile.h"
+
+#include <wx/file.h>
+#include "LineKernel.h"
+#include "LineScanner.h"
+
+namespace
+{
+    // Reads the bytes of a file, which unlike a mapping of it stay the same
+    // when the file changes afterwards.
+    bool ReadAll(const wxString& path, std::string& bytes)
+    {
+        wxFile file;
+
+        if (!file.Open(path))
+            return false;
+
+        wxFileOffset length = file.Length();
+
+        if (length == wxInvalidOffset)
+            return false;
+
+        bytes.resize(static_cast<std::size_t>(length));
+
+        return bytes.empty() ||
+            file.Read(&bytes[0], bytes.size()) ==
+                static_cast<ssize_t>(bytes.size());
+    }
+}
+
+bool SourceFile::Open(const wxString& path, bool mapped)
+{
+    Close();
+
+    if (mapped ? mappedFile.Open(path) : ReadAll(path, heldText))
+    {
+        const char* fileData = mapped ? mappedFile.Data() : heldText.data();
+        std::size_t fileSize = mapped ? mappedFile.Size() : heldText.size();
+        Decompressor::Format format = Decompressor::Detect(fileData,
+                                                           fileSize);
+
+        // The compressed text is kept while it is decompressed.
+        if (format != Decompressor::Format::None)
+        {
+            if (!Decompressor::IsSupported(format))
+            {
+                Close();
+                return false;
+            }
+
+            decompressedFile = std::make_unique<DecompressedFile>(
+                fileData, fileSize, format);
+            this->path = path;
+            return true;
+        }
+
+        if (LineScanner::CanScan(fileData, fileSize))
+        {
+            this->path = path;
+            data = fileData;
+            size = fileSize;
+            return true;
+        }
+    }
+
+    mappedFile.Close();
+
+    // Files that can't be mapped or that are UTF-16 or UTF-32 are read the
+    // way wxTextFile reads them and kept as UTF-8 for the scanner.
+    wxFile file;
+    wxString text;
+
+    if (!file.Open(path) || !file.ReadAll(&text))
+        return false;
+
+    wxScopedCharBuffer utf8 = text.ToUTF8();
+    heldText.assign(utf8.data(), utf8.length());
+    this->path = path;
+    data = heldText.data();
+    size = heldText.size();
+    return true;
+}
+
+void SourceFile::Close()
+{
+    path.clear();
+
+    // The decompression reads from the file, so it is stopped first.
+    decompressedFile.reset();
+    mappedFile.Close();
+    heldText = std::string{};
+    data = nullptr;
+    size = 0;
+    readError = false;
+}
+
+void SourceFile::Detach()
+{
+    // Text that was read or converted is already held in memory.
+    if (mappedFile.Data() == nullptr)
+        return;
+
+    std::string text;
+
+    if (Size() > 0)
+        text.assign(Data(), Size());
+
+    readError = HasReadError();
+    decompressedFile.reset();
+    mappedFile.Close();
+    heldText = std::move(text);
+    data = heldText.data();
+    size = heldText.size();
+}
+
+const char* SourceFile::Data() const
+{
+    return decompressedFile ? decompressedFile->Data() : data;
+}
+
+std::size_t SourceFile::Size() const
+{
+    return decompressedFile ? decompressedFile->Size() : size;
+}
+
+std::size_t SourceFile::WaitForSize(std::size_t neededSize) const
+{
+    return decompressedFile ? decompressedFile->WaitForSize(neededSize)
+                            : size;
+}
+
+std::size_t SourceFile::ReadySize() const
+{
+    return decompressedFile ? decompressedFile->ReadySize() : size;
+}
+
+std::size_t SourceFile::EstimatedSize() const
+{
+    return decompressedFile ? decompressedFile->EstimatedSize() : size;
+}
+
+bool SourceFile::HasReadError() const
+{
+    return decompressedFile ? decompressedFile->Failed() : readError;
+}
+
+std::string_view SourceFile::LineAt(std::uint64_t offset) const
+{
+    // Lines are read while a compressed file is still being decompressed,
+    // so they are only looked for in the text that is ready. A match is
+    // always on a line whose end has been decompressed, since the search
+    // only scans whole lines.
+    const char* text = Data();
+    const char* begin = text + offset;
+    const char* end = LineKernel::Best().FindLineEnd(begin,
+                                                     text + ReadySize());
+
+    return std::string_view(begin, end - begin);
+}
+
+std::uint64_t SourceFile::LineBefore(std::uint64_t offset) const
+{
+    const char* text = Data();
+    std::uint64_t begin{ offset };
+
+    // The line ending of the line before is stepped over first, which is
+    // "\n", "\r\n" or a lone "\r".
+    if (begin > 0 && text[begin - 1] == '\n')
+        begin--;
+
+    if (begin > 0 && text[begin - 1] == '\r')
+        begin--;
+
+    while (begin > 0 && text[begin - 1] != '\n' && text[begin - 1] != '\r')
+        begin--;
+
+    return begin;
+}
+
+std::uint64_t SourceFile::LineAfter(std::uint64_t offset) const
+{
+    const char* text = Data();
+    std::size_t size = ReadySize();
+    std::uint64_t end = offset + LineAt(offset).size();
+
+    if (end == size)
+        return end;
+
+    // A "\r" is followed by the "\n" of a "\r\n" line ending.
+    if (text[end++] == '\r' && end < size && text[end] == '\n')
+        end++;
+
+    return end;
+}
+
+wxString SourceFile::LineText(std::uint64_t offset) const
+{
+    std::string_view line = LineAt(offset);
+    wxString text = wxString::FromUTF8(line.data(), line.size());
+
+    // FromUTF8 returns an empty string for invalid UTF-8, in which case the
+    // text is read as Latin-1 the same way wxConvAuto falls back to it.
+    if (text.empty() && !line.empty())
+        text = wxString{ line.data(), wxConvISO8859_1, line.size() };
+
+    return text;
+}
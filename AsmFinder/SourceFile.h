@@ -0,0 +1,135 @@
+// SourceFile.h - Declares the SourceFile class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SOURCE_FILE_H
+#define SOURCE_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <wx/string.h>
+#include "DecompressedFile.h"
+#include "MappedFile.h"
+
+/// @brief Represents the text of an assembly language source file.
+///
+/// UTF-8, ASCII and Latin-1 files are mapped into memory and read in place,
+/// or read into memory when they may change while open. Files in other
+/// encodings are converted to UTF-8 in memory when opened, so the rest of
+/// the program only ever deals with UTF-8 text. Files
+/// compressed with gzip, zstd or xz are decompressed on another thread as
+/// their text is read, and must hold UTF-8, ASCII or Latin-1 text.
+class SourceFile
+{
+public:
+    /// @brief Opens a source file.
+    /// @param path The path of the file to open.
+    /// @param mapped True to map the file into memory, or false to read a
+    /// copy of it. A mapped file must not be truncated while it is open,
+    /// which makes reading its text fail, and on Windows it can't be
+    /// truncated or replaced while it is open at all.
+    /// @return True if the file could be read, otherwise false. A file
+    /// compressed in a format this build can't decompress can't be read.
+    bool Open(const wxString& path, bool mapped = true);
+
+    /// @brief Closes the file.
+    /// @post Size() is zero.
+    void Close();
+
+    /// @brief Copies the text into memory and unmaps the file, so the file
+    /// can be changed while the text is still read. A compressed file is
+    /// decompressed in full first.
+    /// @post The text is the same, but none of it is read from the file.
+    void Detach();
+
+    /// @brief Gets the path the file was opened from.
+    /// @return The path, or an empty string if the file isn't open.
+    const wxString& Path() const { return path; }
+
+    /// @brief Determines if the file is compressed.
+    /// @return True if the text is decompressed from the file, otherwise
+    /// false.
+    bool IsCompressed() const { return decompressedFile != nullptr; }
+
+    /// @brief Gets the text of the file.
+    /// @return A pointer to the first byte of the text. The text of a
+    /// compressed file starts being decompressed, and only the part
+    /// WaitForSize() has returned can be read until Size() returns.
+    const char* Data() const;
+
+    /// @brief Gets the size of the text.
+    /// @return The size of the text in bytes. A compressed file is waited
+    /// for until all of it has been decompressed.
+    std::size_t Size() const;
+
+    /// @brief Waits for the start of the text to be ready.
+    /// @param neededSize The number of bytes from the start of the text
+    /// needed.
+    /// @return The number of bytes that are ready, which is less than
+    /// neededSize only if the whole text is shorter.
+    std::size_t WaitForSize(std::size_t neededSize) const;
+
+    /// @brief Gets how much of the text can be read without waiting.
+    /// @return The number of bytes that are ready, which for a compressed
+    /// file grows as it is decompressed.
+    std::size_t ReadySize() const;
+
+    /// @brief Gets the size of the text without waiting for it.
+    /// @return The size of the text in bytes, which for a compressed file
+    /// is only a guess until it has been decompressed.
+    std::size_t EstimatedSize() const;
+
+    /// @brief Determines if part of the file couldn't be read, waiting for
+    /// a compressed file to be decompressed.
+    /// @return True if a compressed file is damaged and only the text
+    /// before the damage could be read, otherwise false.
+    bool HasReadError() const;
+
+    /// @brief Gets the raw text of a line.
+    /// @param offset The offset of the first byte of the line.
+    /// @return A view of the line, excluding its line ending.
+    std::string_view LineAt(std::uint64_t offset) const;
+
+    /// @brief Finds the line before another line.
+    /// @param offset The offset of the first byte of a line.
+    /// @return The offset of the first byte of the line before it, or zero
+    /// for the first line.
+    std::uint64_t LineBefore(std::uint64_t offset) const;
+
+    /// @brief Finds the line after another line.
+    /// @param offset The offset of the first byte of a line.
+    /// @return The offset of the first byte of the line after it, or
+    /// ReadySize() for the last line that is ready.
+    std::uint64_t LineAfter(std::uint64_t offset) const;
+
+    /// @brief Gets the text of a line.
+    /// @param offset The offset of the first byte of the line.
+    /// @return The line, excluding its line ending. Text that isn't valid
+    /// UTF-8 is read as Latin-1, the same as wxTextFile does.
+    wxString LineText(std::uint64_t offset) const;
+private:
+    wxString path;
+    MappedFile mappedFile;
+    std::unique_ptr<DecompressedFile> decompressedFile;
+    std::string heldText;
+    const char* data{ nullptr };
+    std::size_t size{ 0 };
+    bool readError{ false };
+};
+
+#endif
@@ -0,0 +1,57 @@
+// Span.h - Declares the Span class template.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPAN_H
+#define SPAN_H
+
+#include <cstddef>
+#include <vector>
+
+/// @brief A read-only view of a contiguous sequence of values.
+///
+/// This stands in for std::span, which isn't available in C++17.
+/// @tparam T The type of the values.
+template <typename T>
+class Span
+{
+public:
+    /// @brief Default constructor; creates an empty Span.
+    Span() = default;
+
+    /// @brief Constructor; creates a Span over a sequence of values.
+    /// @param data The first value. Must outlive the span.
+    /// @param size The number of values.
+    Span(const T* data, std::size_t size) : first{ data }, count{ size } {}
+
+    /// @brief Constructor; creates a Span over the values in a vector.
+    /// @param values The values. The span is invalidated if the vector is
+    /// changed.
+    Span(const std::vector<T>& values)
+        : first{ values.data() }, count{ values.size() }
+    {}
+
+    const T* begin() const { return first; }
+    const T* end() const { return first + count; }
+    const T* data() const { return first; }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const T& operator[](std::size_t i) const { return first[i]; }
+private:
+    const T* first{ nullptr };
+    std::size_t count{ 0 };
+};
+
+#endif
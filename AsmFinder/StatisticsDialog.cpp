@@ -0,0 +1,125 @@
+// StatisticsDialog.cpp - Defines the StatisticsDialog class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "StatisticsDialog.h"
+
+StatisticsDialog::StatisticsDialog(wxWindow* parent,
+                                   const SearchStatistics& statistics)
+    : wxDialog{ parent, wxID_ANY, "Search Statistics", wxDefaultPosition,
+                wxDefaultSize, wxDEFAULT_DIALOG_STYLE | wxRESIZE_BORDER },
+      statistics{ statistics }
+{
+    wxString summary;
+    summary << "The last search took ";
+    summary << wxString::Format("%.3f", statistics.WallSeconds());
+    summary << " seconds on " << statistics.ThreadCount() << " threads. ";
+    summary << "The time of each phase is added up over every thread.";
+
+    wxStaticText* summaryLabel = new wxStaticText{ this, wxID_ANY, summary };
+
+    phaseListView = new wxListView{ this, wxID_ANY, wxDefaultPosition,
+                                    wxSize{ 300, 200 }, wxLC_REPORT };
+    phaseListView->AppendColumn("Phase", wxLIST_FORMAT_LEFT, 100);
+    phaseListView->AppendColumn("Seconds", wxLIST_FORMAT_RIGHT, 100);
+    phaseListView->AppendColumn("Calls", wxLIST_FORMAT_RIGHT, 80);
+
+    counterListView = new wxListView{ this, wxID_ANY, wxDefaultPosition,
+                                      wxSize{ 240, 200 }, wxLC_REPORT };
+    counterListView->AppendColumn("Counter", wxLIST_FORMAT_LEFT, 100);
+    counterListView->AppendColumn("Value", wxLIST_FORMAT_RIGHT, 120);
+    FillLists();
+
+    wxStaticBoxSizer* phaseSizer = new wxStaticBoxSizer{ wxVERTICAL, this,
+                                                         "Phases" };
+    phaseSizer->Add(phaseListView, 1, wxALL | wxEXPAND, 5);
+
+    wxStaticBoxSizer* counterSizer = new wxStaticBoxSizer{ wxVERTICAL, this,
+                                                           "Counters" };
+    counterSizer->Add(counterListView, 1, wxALL | wxEXPAND, 5);
+
+    wxBoxSizer* listSizer = new wxBoxSizer{ wxHORIZONTAL };
+    listSizer->Add(phaseSizer, 1, wxALL | wxEXPAND, 5);
+    listSizer->Add(counterSizer, 1, wxALL | wxEXPAND, 5);
+
+    wxButton* saveButton = new wxButton{ this, wxID_SAVE, "Save..." };
+    wxBoxSizer* buttonSizer = new wxBoxSizer{ wxHORIZONTAL };
+    buttonSizer->Add(saveButton, 0, wxRIGHT, 5);
+    buttonSizer->AddStretchSpacer();
+    buttonSizer->Add(new wxButton{ this, wxID_OK, "Close" });
+
+    wxBoxSizer* dialogSizer = new wxBoxSizer{ wxVERTICAL };
+    dialogSizer->Add(summaryLabel, 0, wxALL | wxEXPAND, 10);
+    dialogSizer->Add(listSizer, 1, wxEXPAND);
+    dialogSizer->Add(buttonSizer, 0, wxALL | wxEXPAND, 10);
+
+    SetSizerAndFit(dialogSizer);
+
+    Bind(wxEVT_BUTTON, &StatisticsDialog::OnSave, this, wxID_SAVE);
+}
+
+void StatisticsDialog::FillLists()
+{
+    long item{ 0 };
+
+    for (SearchStatistics::Phase phase : SearchStatistics::phases)
+    {
+        wxString seconds = wxString::Format("%.3f",
+                                            statistics.Seconds(phase));
+        wxString calls;
+        calls << statistics.Calls(phase);
+
+        phaseListView->InsertItem(item, SearchStatistics::PhaseName(phase));
+        phaseListView->SetItem(item, Column::Value, seconds);
+        phaseListView->SetItem(item, Column::Calls, calls);
+        item++;
+    }
+
+    item = 0;
+
+    for (SearchStatistics::Counter counter : SearchStatistics::counters)
+    {
+        wxString value;
+        value << statistics.Count(counter);
+
+        counterListView->InsertItem(item,
+                                    SearchStatistics::CounterName(counter));
+        counterListView->SetItem(item, Column::Value, value);
+        item++;
+    }
+}
+
+void StatisticsDialog::OnSave(wxCommandEvent& event)
+{
+    wxFileDialog saveFileDialog{ this, "Save Search Statistics", "",
+                                 "statistics.json",
+                                 "JSON (*.json)|*.json|"
+                                 "Chrome trace (*.json)|*.json",
+                                 wxFD_SAVE | wxFD_OVERWRITE_PROMPT };
+
+    if (saveFileDialog.ShowModal() == wxID_CANCEL)
+        return;
+
+    wxString savePath = saveFileDialog.GetPath();
+    bool saved = saveFileDialog.GetFilterIndex() == SaveType::Trace
+        ? statistics.WriteTrace(savePath)
+        : statistics.WriteJson(savePath);
+
+    if (!saved)
+    {
+        wxMessageBox("Unable to save " + savePath, "AsmFinder",
+                     wxOK | wxICON_ERROR);
+    }
+}
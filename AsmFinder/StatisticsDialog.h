@@ -0,0 +1,61 @@
+// StatisticsDialog.h - Declares the StatisticsDialog class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef STATISTICS_DIALOG_H
+#define STATISTICS_DIALOG_H
+
+#include <wx/wx.h>
+#include <wx/listctrl.h>
+#include "SearchStatistics.h"
+
+/// @brief Shows where the time of the last search went and lets the user
+/// save the statistics.
+class StatisticsDialog : public wxDialog
+{
+public:
+    /// @brief Constructor; creates a new instance of StatisticsDialog.
+    /// @param parent The window the dialog belongs to.
+    /// @param statistics The statistics to show. Must outlive the dialog.
+    StatisticsDialog(wxWindow* parent, const SearchStatistics& statistics);
+private:
+    enum Column
+    {
+        Name = 0,
+        Value = 1,
+        Calls = 2
+    };
+
+    /// @brief The types of file the statistics can be saved as, in the
+    /// order of the save dialog's wildcard.
+    enum SaveType
+    {
+        Json = 0,
+        Trace = 1
+    };
+
+    const SearchStatistics& statistics;
+    wxListView* phaseListView;
+    wxListView* counterListView;
+
+    /// @brief Fills in the lists of phases and counters.
+    void FillLists();
+
+    /// @brief Event handler for the Save button.
+    /// @param event The triggering event.
+    void OnSave(wxCommandEvent& event);
+};
+
+#endif
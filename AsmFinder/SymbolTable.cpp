@@ -0,0 +1,131 @@
+// SymbolTable.cpp - Defines the SymbolTable class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "SymbolTable.h"
+
+namespace
+{
+    // Slots hold the id of a symbol plus one, so zero is free.
+    constexpr std::uint32_t emptySlot{ 0 };
+
+    constexpr std::size_t initialCapacity{ 64 };
+
+    char FoldCase(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+}
+
+SymbolTable::SymbolTable()
+    : slots(initialCapacity, emptySlot), mask{ initialCapacity - 1 }
+{}
+
+void SymbolTable::Clear()
+{
+    arena.clear();
+    symbols.clear();
+    slots.assign(initialCapacity, emptySlot);
+    mask = initialCapacity - 1;
+}
+
+std::uint32_t SymbolTable::Intern(std::string_view token)
+{
+    std::uint64_t hash = Hash(token);
+    std::size_t slot = FindSlot(token, hash);
+
+    if (slots[slot] != emptySlot)
+        return slots[slot] - 1;
+
+    symbols.push_back(Symbol{ arena.size(), token.size(), hash });
+
+    for (char c : token)
+        arena += FoldCase(c);
+
+    slots[slot] = static_cast<std::uint32_t>(symbols.size());
+
+    // Keep the table at most half full so probe sequences stay short.
+    if (symbols.size() * 2 > slots.size())
+        Grow();
+
+    return static_cast<std::uint32_t>(symbols.size() - 1);
+}
+
+std::uint32_t SymbolTable::Find(std::string_view token) const
+{
+    std::size_t slot = FindSlot(token, Hash(token));
+    return slots[slot] != emptySlot ? slots[slot] - 1 : notFound;
+}
+
+std::size_t SymbolTable::FindSlot(std::string_view token,
+                                  std::uint64_t hash) const
+{
+    std::size_t position = static_cast<std::size_t>(hash) & mask;
+
+    while (slots[position] != emptySlot)
+    {
+        const Symbol& symbol = symbols[slots[position] - 1];
+
+        if (symbol.hash == hash && symbol.size == token.size())
+        {
+            const char* name = arena.data() + symbol.offset;
+            std::size_t i{ 0 };
+
+            while (i < token.size() && name[i] == FoldCase(token[i]))
+                i++;
+
+            if (i == token.size())
+                return position;
+        }
+
+        position = (position + 1) & mask;
+    }
+
+    return position;
+}
+
+void SymbolTable::Grow()
+{
+    slots.assign(slots.size() * 2, emptySlot);
+    mask = slots.size() - 1;
+
+    for (std::size_t i = 0; i < symbols.size(); i++)
+    {
+        std::size_t position = static_cast<std::size_t>(symbols[i].hash) &
+            mask;
+
+        while (slots[position] != emptySlot)
+            position = (position + 1) & mask;
+
+        slots[position] = static_cast<std::uint32_t>(i + 1);
+    }
+}
+
+std::uint64_t SymbolTable::Hash(std::string_view token)
+{
+    constexpr std::uint64_t offsetBasis{ 14695981039346656037ULL };
+    constexpr std::uint64_t prime{ 1099511628211ULL };
+
+    std::uint64_t hash{ offsetBasis };
+
+    for (char c : token)
+    {
+        hash ^= static_cast<unsigned char>(FoldCase(c));
+        hash *= prime;
+    }
+
+    return hash;
+}
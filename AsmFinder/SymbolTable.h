@@ -0,0 +1,103 @@
+// SymbolTable.h - Declares the SymbolTable class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef SYMBOL_TABLE_H
+#define SYMBOL_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @brief Interns tokens, giving each distinct one a small integer id.
+///
+/// The text of every symbol is stored once, one after another in a single
+/// arena, and symbols are found through a flat open-addressed table of ids,
+/// so looking up a token that was interned before never allocates. Ids are
+/// given out in order from zero, so they can index a vector directly.
+///
+/// ASCII letters are folded to lowercase as tokens are hashed and compared,
+/// so "ADDU" and "addu" are the same symbol. Any other bytes are compared as
+/// they are, so folding never depends on the locale.
+class SymbolTable
+{
+public:
+    /// @brief The value Find() returns for a token that isn't interned.
+    static constexpr std::uint32_t notFound{ 0xFFFFFFFF };
+
+    /// @brief Default constructor; creates an empty SymbolTable.
+    SymbolTable();
+
+    /// @brief Removes every symbol.
+    /// @post Size() is zero.
+    void Clear();
+
+    /// @brief Gets the id of a token, interning it if it is new.
+    /// @param token The token.
+    /// @return The id of the symbol, which is Size() - 1 if it was added.
+    std::uint32_t Intern(std::string_view token);
+
+    /// @brief Finds the id of a token.
+    /// @param token The token.
+    /// @return The id of the symbol, or notFound if it isn't interned.
+    std::uint32_t Find(std::string_view token) const;
+
+    /// @brief Gets the text of a symbol.
+    /// @param id The id of the symbol.
+    /// @return The symbol with its ASCII letters in lowercase. The view is
+    /// invalidated when another token is interned.
+    std::string_view Name(std::uint32_t id) const
+    {
+        const Symbol& symbol = symbols[id];
+        return std::string_view{ arena.data() + symbol.offset, symbol.size };
+    }
+
+    /// @brief Gets the number of symbols.
+    /// @return The number of distinct tokens interned.
+    std::size_t Size() const { return symbols.size(); }
+
+private:
+    struct Symbol
+    {
+        std::size_t offset;
+        std::size_t size;
+        std::uint64_t hash;
+    };
+
+    std::string arena;
+    std::vector<Symbol> symbols;
+    std::vector<std::uint32_t> slots;
+    std::size_t mask{ 0 };
+
+    /// @brief Finds the slot of a token.
+    /// @param token The token.
+    /// @param hash The hash of the token.
+    /// @return The slot that holds the token's id, or the empty slot it
+    /// would be interned in.
+    std::size_t FindSlot(std::string_view token, std::uint64_t hash) const;
+
+    /// @brief Doubles the size of the table.
+    void Grow();
+
+    /// @brief Computes the FNV-1a hash of a token folded to lowercase.
+    /// @param token The token to hash.
+    /// @return The hash of the token.
+    static std::uint64_t Hash(std::string_view token);
+};
+
+#endif
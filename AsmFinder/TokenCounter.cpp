@@ -0,0 +1,91 @@
+// TokenCounter.cpp - Defines the TokenCounter class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "TokenCounter.h"
+
+namespace
+{
+    // Slots hold the position of an entry plus one, so zero is free.
+    constexpr std::uint32_t emptySlot{ 0 };
+
+    constexpr std::size_t initialCapacity{ 256 };
+}
+
+TokenCounter::TokenCounter()
+    : slots(initialCapacity, emptySlot), mask{ initialCapacity - 1 }
+{}
+
+std::size_t TokenCounter::Add(std::string_view token)
+{
+    std::uint64_t hash = Hash(token);
+    std::size_t position = static_cast<std::size_t>(hash) & mask;
+
+    while (slots[position] != emptySlot)
+    {
+        Entry& entry = entries[slots[position] - 1];
+
+        if (entry.hash == hash && entry.token == token)
+        {
+            entry.count++;
+            return slots[position] - 1;
+        }
+
+        position = (position + 1) & mask;
+    }
+
+    entries.push_back(Entry{ token, 1, hash });
+    slots[position] = static_cast<std::uint32_t>(entries.size());
+
+    // Keep the table at most half full so probe sequences stay short.
+    if (entries.size() * 2 > slots.size())
+        Grow();
+
+    return entries.size() - 1;
+}
+
+void TokenCounter::Grow()
+{
+    slots.assign(slots.size() * 2, emptySlot);
+    mask = slots.size() - 1;
+
+    for (std::size_t i = 0; i < entries.size(); i++)
+    {
+        std::size_t position = static_cast<std::size_t>(entries[i].hash) &
+            mask;
+
+        while (slots[position] != emptySlot)
+            position = (position + 1) & mask;
+
+        slots[position] = static_cast<std::uint32_t>(i + 1);
+    }
+}
+
+std::uint64_t TokenCounter::Hash(std::string_view token)
+{
+    constexpr std::uint64_t offsetBasis{ 14695981039346656037ULL };
+    constexpr std::uint64_t prime{ 1099511628211ULL };
+
+    std::uint64_t hash{ offsetBasis };
+
+    for (char c : token)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= prime;
+    }
+
+    return hash;
+}
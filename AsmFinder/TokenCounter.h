@@ -0,0 +1,68 @@
+// TokenCounter.h - Declares the TokenCounter class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TOKEN_COUNTER_H
+#define TOKEN_COUNTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/// @brief Counts how many times each distinct token occurs.
+///
+/// The tokens are kept in a flat open-addressed table of views into the
+/// text they were found in, so counting a token that was seen before costs
+/// a hash and a compare without allocating anything. Tokens are compared
+/// exactly, so tokens that only differ in case are counted separately.
+class TokenCounter
+{
+public:
+    /// @brief A distinct token and how many times it was added.
+    struct Entry
+    {
+        std::string_view token;
+        std::uint64_t count{ 0 };
+        std::uint64_t hash{ 0 };
+    };
+
+    /// @brief Default constructor; creates an empty TokenCounter.
+    TokenCounter();
+
+    /// @brief Counts a token.
+    /// @param token The token, which must outlive the counter.
+    /// @return The position of the token's entry.
+    std::size_t Add(std::string_view token);
+
+    /// @brief Gets the tokens that were counted.
+    /// @return Every distinct token in the order it was first added.
+    const std::vector<Entry>& Entries() const { return entries; }
+private:
+    std::vector<Entry> entries;
+    std::vector<std::uint32_t> slots;
+    std::size_t mask{ 0 };
+
+    /// @brief Doubles the size of the table.
+    void Grow();
+
+    /// @brief Computes the FNV-1a hash of a token.
+    /// @param token The token to hash.
+    /// @return The hash of the token.
+    static std::uint64_t Hash(std::string_view token);
+};
+
+#endif
@@ -0,0 +1,570 @@
+// TokenIndex.cpp - Defines the TokenIndex class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "TokenIndex.h"
+
+#include <cstring>
+#include <limits>
+#include <queue>
+#include <wx/ffile.h>
+#include <wx/filefn.h>
+#include <wx/filename.h>
+#include "InstructionIndex.h"
+#include "LineScanner.h"
+
+namespace
+{
+    // The first bytes of every index file. The last character is the
+    // version of the format, which is changed whenever the format is.
+    constexpr char magic[8]{ 'A', 'S', 'M', 'F', 'I', 'D', 'X', '5' };
+
+    // The stamp hashes this many bytes from the start and the end of the
+    // file, and from evenly spaced blocks in between.
+    constexpr std::size_t edgeSampleSize{ 64 << 10 };
+    constexpr std::size_t blockSampleSize{ 4 << 10 };
+    constexpr std::size_t blockSampleCount{ 64 };
+
+    std::uint64_t HashBytes(std::uint64_t hash, const char* data,
+                            std::size_t size)
+    {
+        constexpr std::uint64_t prime{ 1099511628211ULL };
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            hash ^= static_cast<unsigned char>(data[i]);
+            hash *= prime;
+        }
+
+        return hash;
+    }
+
+    void AppendFixed(std::string& output, std::uint64_t value, int bytes)
+    {
+        for (int i = 0; i < bytes; i++)
+            output += static_cast<char>((value >> (i * 8)) & 0xFF);
+    }
+
+    void AppendVarint(std::string& output, std::uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            output += static_cast<char>((value & 0x7F) | 0x80);
+            value >>= 7;
+        }
+
+        output += static_cast<char>(value);
+    }
+
+    // Checks that a range read from an index file is inside an area of
+    // the given size. The offset and size aren't added, since a damaged sum
+    // could wrap around and pass.
+    bool FitsIn(std::uint64_t offset, std::uint64_t size,
+                std::uint64_t available)
+    {
+        return offset <= available && size <= available - offset;
+    }
+
+    /// @brief Reads values from an index file, checking that each one is
+    /// inside the file.
+    class Reader
+    {
+    public:
+        Reader(const char* data, std::size_t size)
+            : position{ data }, end{ data + size }
+        {}
+
+        bool ReadFixed(std::uint64_t& value, int bytes)
+        {
+            if (end - position < bytes)
+                return false;
+
+            value = 0;
+
+            for (int i = 0; i < bytes; i++)
+            {
+                value |= static_cast<std::uint64_t>(
+                    static_cast<unsigned char>(*position++)) << (i * 8);
+            }
+
+            return true;
+        }
+
+        bool ReadVarint(std::uint64_t& value)
+        {
+            value = 0;
+
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                if (position == end)
+                    return false;
+
+                auto byte = static_cast<unsigned char>(*position++);
+                value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+                if ((byte & 0x80) == 0)
+                    return true;
+            }
+
+            return false;
+        }
+
+        bool ReadBytes(std::string& value, std::size_t size)
+        {
+            if (static_cast<std::size_t>(end - position) < size)
+                return false;
+
+            value.assign(position, size);
+            position += size;
+            return true;
+        }
+    private:
+        const char* position;
+        const char* end;
+    };
+
+    /// @brief A line found in the index, before the lines are put in order.
+    struct Posting
+    {
+        std::uint32_t line;
+        std::uint32_t instruction;
+        std::uint64_t offset;
+    };
+}
+
+TokenIndex::Stamp TokenIndex::StampOf(const SourceFile& source,
+                                      const Dialect& dialect)
+{
+    Stamp stamp;
+    stamp.dialect = static_cast<std::uint32_t>(dialect.GetKind());
+    stamp.size = source.Size();
+    stamp.modified = static_cast<std::int64_t>(
+        wxFileName{ source.Path() }.GetModificationTime().GetTicks());
+
+    // Hashing the whole file would cost as much as searching it, so only
+    // samples of it are hashed. The size and modification time catch
+    // nearly every change, and the samples catch files that were rewritten
+    // without either changing.
+    const char* data = source.Data();
+    std::size_t size = source.Size();
+    std::uint64_t hash{ 14695981039346656037ULL };
+
+    if (size <= 2 * edgeSampleSize + blockSampleCount * blockSampleSize)
+    {
+        hash = HashBytes(hash, data, size);
+    }
+    else
+    {
+        hash = HashBytes(hash, data, edgeSampleSize);
+        std::size_t stride = (size - 2 * edgeSampleSize) / blockSampleCount;
+
+        for (std::size_t i = 0; i < blockSampleCount; i++)
+        {
+            hash = HashBytes(hash, data + edgeSampleSize + i * stride,
+                             blockSampleSize);
+        }
+
+        hash = HashBytes(hash, data + size - edgeSampleSize, edgeSampleSize);
+    }
+
+    stamp.sampleHash = hash;
+    return stamp;
+}
+
+wxString TokenIndex::PathFor(const wxString& sourcePath)
+{
+    return sourcePath + ".afidx";
+}
+
+void TokenIndex::Clear()
+{
+    lists.clear();
+    symbolList = List{};
+    symbols.Clear();
+    lineCount = 0;
+    indexFile.Close();
+}
+
+std::size_t TokenIndex::ListFor(std::string_view token)
+{
+    std::uint32_t id = symbols.Intern(token);
+
+    if (id == lists.size())
+        lists.emplace_back();
+
+    return id;
+}
+
+void TokenIndex::Add(std::size_t list, std::uint32_t line,
+                     std::uint64_t offset)
+{
+    AddPosting(lists[list], line, offset);
+}
+
+void TokenIndex::AddSymbol(std::uint32_t line, std::uint64_t offset)
+{
+    AddPosting(symbolList, line, offset);
+}
+
+bool TokenIndex::Load(const wxString& path, const Stamp& stamp)
+{
+    Clear();
+
+    if (!wxFileExists(path) || !indexFile.Open(path))
+        return false;
+
+    Reader reader{ indexFile.Data(), indexFile.Size() };
+    std::string header;
+    std::uint64_t size, modified, sampleHash, dialect, lines, listCount;
+    std::uint64_t symbolCount, symbolOffset, symbolSize, postingsStart;
+
+    if (!reader.ReadBytes(header, sizeof(magic)) ||
+        header != std::string(magic, sizeof(magic)) ||
+        !reader.ReadFixed(size, 8) || !reader.ReadFixed(modified, 8) ||
+        !reader.ReadFixed(sampleHash, 8) || !reader.ReadFixed(dialect, 4) ||
+        !reader.ReadFixed(lines, 4) || !reader.ReadFixed(listCount, 4) ||
+        !reader.ReadFixed(symbolCount, 4) ||
+        !reader.ReadFixed(symbolOffset, 8) ||
+        !reader.ReadFixed(symbolSize, 8) || !reader.ReadFixed(postingsStart, 8))
+    {
+        Clear();
+        return false;
+    }
+
+    // Each list takes at least minimumEntrySize bytes of the directory,
+    // which keeps a damaged count from allocating huge amounts of memory.
+    constexpr std::uint64_t minimumEntrySize{ 24 };
+
+    if (size != stamp.size ||
+        static_cast<std::int64_t>(modified) != stamp.modified ||
+        sampleHash != stamp.sampleHash || dialect != stamp.dialect ||
+        postingsStart > indexFile.Size() ||
+        listCount > indexFile.Size() / minimumEntrySize ||
+        !FitsIn(symbolOffset, symbolSize, indexFile.Size() - postingsStart))
+    {
+        Clear();
+        return false;
+    }
+
+    lineCount = static_cast<std::uint32_t>(lines);
+    symbolList.count = static_cast<std::uint32_t>(symbolCount);
+    symbolList.mappedOffset = postingsStart + symbolOffset;
+    symbolList.mappedSize = symbolSize;
+    lists.resize(static_cast<std::size_t>(listCount));
+    std::string token;
+
+    for (std::size_t l = 0; l < lists.size(); l++)
+    {
+        std::uint64_t tokenSize, count, offset, postingsSize;
+
+        // A token that is in the directory twice would leave its second
+        // list without an id, so the index is treated as damaged.
+        if (!reader.ReadFixed(tokenSize, 4) ||
+            !reader.ReadBytes(token, tokenSize) ||
+            symbols.Intern(token) != l ||
+            !reader.ReadFixed(count, 4) || !reader.ReadFixed(offset, 8) ||
+            !reader.ReadFixed(postingsSize, 8) ||
+            !FitsIn(offset, postingsSize, indexFile.Size() - postingsStart))
+        {
+            Clear();
+            return false;
+        }
+
+        lists[l].count = static_cast<std::uint32_t>(count);
+        lists[l].mappedOffset = postingsStart + offset;
+        lists[l].mappedSize = postingsSize;
+    }
+
+    return true;
+}
+
+bool TokenIndex::Save(const wxString& path, const Stamp& stamp) const
+{
+    std::string directory;
+    std::uint64_t postingsSize{ 0 };
+
+    for (std::size_t l = 0; l < lists.size(); l++)
+    {
+        const List& list = lists[l];
+        std::string_view token = symbols.Name(static_cast<std::uint32_t>(l));
+        std::string_view postings = Postings(list);
+        AppendFixed(directory, token.size(), 4);
+        directory += token;
+        AppendFixed(directory, list.count, 4);
+        AppendFixed(directory, postingsSize, 8);
+        AppendFixed(directory, postings.size(), 8);
+        postingsSize += postings.size();
+    }
+
+    // The lines that start functions follow the postings of every token.
+    std::string_view symbolPostings = Postings(symbolList);
+
+    std::string header{ magic, sizeof(magic) };
+    AppendFixed(header, stamp.size, 8);
+    AppendFixed(header, static_cast<std::uint64_t>(stamp.modified), 8);
+    AppendFixed(header, stamp.sampleHash, 8);
+    AppendFixed(header, stamp.dialect, 4);
+    AppendFixed(header, lineCount, 4);
+    AppendFixed(header, lists.size(), 4);
+    AppendFixed(header, symbolList.count, 4);
+    AppendFixed(header, postingsSize, 8);
+    AppendFixed(header, symbolPostings.size(), 8);
+    AppendFixed(header, header.size() + 8 + directory.size(), 8);
+
+    // The index is written under another name and then renamed, so a search
+    // never sees an index that is only partly written.
+    wxString temporaryPath = path + ".tmp";
+
+    {
+        wxFFile file{ temporaryPath, "wb" };
+
+        if (!file.IsOpened())
+            return false;
+
+        bool written =
+            file.Write(header.data(), header.size()) == header.size() &&
+            file.Write(directory.data(), directory.size()) == directory.size();
+
+        for (auto& list : lists)
+        {
+            std::string_view postings = Postings(list);
+
+            if (written)
+            {
+                written = file.Write(postings.data(), postings.size()) ==
+                    postings.size();
+            }
+        }
+
+        if (written)
+        {
+            written = file.Write(symbolPostings.data(),
+                                 symbolPostings.size()) ==
+                symbolPostings.size();
+        }
+
+        if (!written || !file.Close())
+        {
+            file.Close();
+            wxRemoveFile(temporaryPath);
+            return false;
+        }
+    }
+
+    return wxRenameFile(temporaryPath, path, true);
+}
+
+bool TokenIndex::Search(const std::vector<Instruction>& instructions,
+                        const char* data, std::size_t size,
+                        const Dialect& dialect, MatchTable& matches) const
+{
+    matches.Reset(instructions.size());
+
+    InstructionIndex index;
+    index.Build(instructions);
+    InstructionIndex::Cache cache;
+    std::vector<Posting> postings;
+    std::vector<std::size_t> listEnds;
+
+    // Reads the lines of a list, asking which instruction each one matches
+    // only when that depends on its operands.
+    auto readList = [&](const List& list, int instruction, bool operands) {
+        std::string_view encoded = Postings(list);
+        Reader reader{ encoded.data(), encoded.size() };
+        std::uint64_t line{ 0 };
+        std::uint64_t offset{ 0 };
+
+        for (std::uint32_t p = 0; p < list.count; p++)
+        {
+            std::uint64_t lineDelta, offsetDelta;
+
+            if (!reader.ReadVarint(lineDelta) ||
+                !reader.ReadVarint(offsetDelta) ||
+                offsetDelta >= size - offset)
+            {
+                return false;
+            }
+
+            line += lineDelta;
+            offset += offsetDelta;
+            int matched = instruction;
+
+            if (operands)
+            {
+                LineScanner scanner{ data, static_cast<std::size_t>(offset),
+                                     size };
+                scanner.Next();
+                std::string_view lineOperands;
+                std::string_view token = dialect.Split(scanner.Text(),
+                                                       lineOperands);
+                matched = index.Find(token, lineOperands, cache);
+            }
+
+            for (; matched != InstructionIndex::notFound;
+                 matched = index.NextAlias(matched))
+            {
+                postings.push_back(Posting{
+                    static_cast<std::uint32_t>(line),
+                    static_cast<std::uint32_t>(matched), offset });
+            }
+        }
+
+        listEnds.push_back(postings.size());
+        return true;
+    };
+
+    bool read{ true };
+
+    if (!index.HasPatterns())
+    {
+        // The list of a token is read for the first instruction with it,
+        // which also gives its lines to the instruction's aliases.
+        std::vector<bool> searched(lists.size());
+
+        for (std::size_t i = 0; i < instructions.size() && read; i++)
+        {
+            wxScopedCharBuffer utf8 = instructions[i].Token().ToUTF8();
+            std::uint32_t id = symbols.Find(
+                std::string_view{ utf8.data(), utf8.length() });
+
+            if (id == SymbolTable::notFound || searched[id])
+                continue;
+
+            searched[id] = true;
+            read = readList(lists[id], static_cast<int>(i), false);
+        }
+    }
+    else
+    {
+        // A pattern's mnemonic can match any number of tokens, so every
+        // list is checked. The lines themselves are only read when a
+        // pattern could match them.
+        for (std::size_t l = 0; l < lists.size() && read; l++)
+        {
+            std::string_view token =
+                symbols.Name(static_cast<std::uint32_t>(l));
+            int plain = index.Find(token);
+            bool operands = index.PatternsMayMatch(token, cache);
+
+            if (plain != InstructionIndex::notFound || operands)
+                read = readList(lists[l], plain, operands);
+        }
+    }
+
+    if (!read)
+    {
+        matches.Reset(instructions.size());
+        return false;
+    }
+
+    // Each list is in line order and a line is only in the list of its
+    // token, so the lists are merged rather than sorted. A heap holds the
+    // next posting of each list, and postings are taken from the earliest
+    // list until another one has an earlier line.
+    using Cursor = std::pair<std::size_t, std::size_t>;
+    auto later = [&postings](const Cursor& a, const Cursor& b) {
+        return postings[a.first].line > postings[b.first].line;
+    };
+    std::priority_queue<Cursor, std::vector<Cursor>, decltype(later)> heads{
+        later };
+    std::size_t listBegin{ 0 };
+
+    for (std::size_t listEnd : listEnds)
+    {
+        if (listBegin < listEnd)
+            heads.push(Cursor{ listBegin, listEnd });
+
+        listBegin = listEnd;
+    }
+
+    while (!heads.empty())
+    {
+        Cursor head = heads.top();
+        heads.pop();
+
+        std::uint32_t until = heads.empty()
+            ? std::numeric_limits<std::uint32_t>::max()
+            : postings[heads.top().first].line;
+
+        do
+        {
+            const Posting& posting = postings[head.first++];
+            matches.Add(posting.instruction, posting.line, posting.offset);
+        } while (head.first < head.second &&
+                 postings[head.first].line < until);
+
+        if (head.first < head.second)
+            heads.push(head);
+    }
+
+    return true;
+}
+
+bool TokenIndex::ReadSymbols(const char* data, std::size_t size,
+                             const Dialect& dialect, ScopeTable& scopes) const
+{
+    std::string_view encoded = Postings(symbolList);
+    Reader reader{ encoded.data(), encoded.size() };
+    std::uint64_t line{ 0 };
+    std::uint64_t offset{ 0 };
+
+    for (std::uint32_t p = 0; p < symbolList.count; p++)
+    {
+        std::uint64_t lineDelta, offsetDelta;
+
+        if (!reader.ReadVarint(lineDelta) || !reader.ReadVarint(offsetDelta) ||
+            offsetDelta >= size - offset)
+        {
+            return false;
+        }
+
+        line += lineDelta;
+        offset += offsetDelta;
+
+        // Only the lines are indexed, so the names are read from the file.
+        LineScanner scanner{ data, static_cast<std::size_t>(offset), size };
+        scanner.Next();
+        if (!scopes.AddLine(dialect, static_cast<std::uint32_t>(line),
+                            scanner.Text()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void TokenIndex::AddPosting(List& list, std::uint32_t line,
+                            std::uint64_t offset)
+{
+    // Each line and offset is stored as the distance from the one before
+    // it, which keeps nearly all of them to a byte or two.
+    AppendVarint(list.encoded, line - list.lastLine);
+    AppendVarint(list.encoded, offset - list.lastOffset);
+    list.lastLine = line;
+    list.lastOffset = offset;
+    list.count++;
+}
+
+std::string_view TokenIndex::Postings(const List& list) const
+{
+    if (indexFile.Data() != nullptr)
+    {
+        return std::string_view(indexFile.Data() + list.mappedOffset,
+                                static_cast<std::size_t>(list.mappedSize));
+    }
+
+    return list.encoded;
+}
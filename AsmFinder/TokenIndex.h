@@ -0,0 +1,172 @@
+// TokenIndex.h - Declares the TokenIndex class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOKEN_INDEX_H
+#define TOKEN_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <wx/string.h>
+#include "Dialect.h"
+#include "Instruction.h"
+#include "MappedFile.h"
+#include "MatchTable.h"
+#include "ScopeTable.h"
+#include "SourceFile.h"
+#include "SymbolTable.h"
+
+/// @brief Maps the mnemonic of every line in a source file to the lines
+/// that have it, so a search can be answered without reading the file.
+///
+/// The index is saved next to the source file. Each token has a posting
+/// list of line numbers and offsets, which are delta encoded as variable
+/// length integers. The saved index is only used while the size,
+/// modification time and a sampled hash of the source file are unchanged,
+/// and only for the dialect it was built with.
+///
+/// The lines that start a function or section are saved in one more
+/// posting list, so the function and section of each match can be found
+/// without reading the file either.
+class TokenIndex
+{
+public:
+    /// @brief Identifies a version of a source file.
+    struct Stamp
+    {
+        std::uint64_t size{ 0 };
+        std::int64_t modified{ 0 };
+        std::uint64_t sampleHash{ 0 };
+        std::uint32_t dialect{ 0 };
+    };
+
+    /// @brief Computes the stamp of an open source file.
+    /// @param source The source file, which must have been opened by path.
+    /// @param dialect The dialect the mnemonics are found with.
+    /// @return The stamp of the file as it is now.
+    static Stamp StampOf(const SourceFile& source, const Dialect& dialect);
+
+    /// @brief Gets where the index of a source file is saved.
+    /// @param sourcePath The path of the source file.
+    /// @return The path of the index file.
+    static wxString PathFor(const wxString& sourcePath);
+
+    /// @brief Removes every token and line.
+    void Clear();
+
+    /// @brief Gets the position of a token's posting list, adding an empty
+    /// one if the token isn't indexed yet.
+    /// @param token The token. Only the case of ASCII letters is ignored.
+    /// @return The position of the list, to pass to Add().
+    std::size_t ListFor(std::string_view token);
+
+    /// @brief Adds a line to a token's posting list.
+    /// @param list The position of the list from ListFor().
+    /// @param line The number of the line, which must be after any line
+    /// already in the list.
+    /// @param offset The offset of the line in the source file.
+    void Add(std::size_t list, std::uint32_t line, std::uint64_t offset);
+
+    /// @brief Adds a line that starts a function or section.
+    /// @param line The number of the line, which must be after any line
+    /// already added.
+    /// @param offset The offset of the line in the source file.
+    void AddSymbol(std::uint32_t line, std::uint64_t offset);
+
+    /// @brief Sets the number of lines in the source file.
+    /// @param count The number of lines.
+    void SetLineCount(std::uint32_t count) { lineCount = count; }
+
+    /// @brief Gets the number of lines in the source file.
+    /// @return The number of lines.
+    std::uint32_t LineCount() const { return lineCount; }
+
+    /// @brief Loads a saved index.
+    /// @param path The path of the index file.
+    /// @param stamp The stamp of the source file the index must be for.
+    /// @return True if the index was loaded, or false if it is missing,
+    /// damaged or for a different version of the source file.
+    bool Load(const wxString& path, const Stamp& stamp);
+
+    /// @brief Saves the index.
+    /// @param path The path of the index file.
+    /// @param stamp The stamp of the source file the index was built from.
+    /// @return True if the index was saved, otherwise false.
+    bool Save(const wxString& path, const Stamp& stamp) const;
+
+    /// @brief Finds the lines that start with each instruction.
+    /// @param instructions The instructions to search for.
+    /// @param data The text of the source file, which patterns read the
+    /// operands of lines from.
+    /// @param size The size of the text in bytes.
+    /// @param dialect The dialect the index was built with.
+    /// @param matches Receives every matching line in line order, exactly
+    /// as SearchEngine would find them.
+    /// @return True if the search succeeded, or false if the index is
+    /// damaged.
+    bool Search(const std::vector<Instruction>& instructions,
+                const char* data, std::size_t size, const Dialect& dialect,
+                MatchTable& matches) const;
+
+    /// @brief Reads the functions and sections of the source file.
+    /// @param data The text of the source file, which the names of the
+    /// functions and sections are read from.
+    /// @param size The size of the text in bytes.
+    /// @param dialect The dialect the index was built with.
+    /// @param scopes Receives the functions and sections, after any it
+    /// already holds.
+    /// @return True if they were read, or false if the index is damaged.
+    bool ReadSymbols(const char* data, std::size_t size,
+                     const Dialect& dialect, ScopeTable& scopes) const;
+private:
+    /// @brief The lines that start with one token. Each list is at the
+    /// position of its token's id in the symbol table.
+    struct List
+    {
+        std::uint32_t count{ 0 };
+        std::uint32_t lastLine{ 0 };
+        std::uint64_t lastOffset{ 0 };
+
+        // Lists built in memory are encoded here. Lists that were loaded
+        // are left in the mapped index file instead.
+        std::string encoded;
+        std::uint64_t mappedOffset{ 0 };
+        std::uint64_t mappedSize{ 0 };
+    };
+
+    std::vector<List> lists;
+    List symbolList;
+    SymbolTable symbols;
+    std::uint32_t lineCount{ 0 };
+    MappedFile indexFile;
+
+    /// @brief Adds a line to a list.
+    /// @param list The list.
+    /// @param line The number of the line, which must be after any line
+    /// already in the list.
+    /// @param offset The offset of the line in the source file.
+    static void AddPosting(List& list, std::uint32_t line,
+                           std::uint64_t offset);
+
+    /// @brief Gets the encoded postings of a list.
+    /// @param list The list.
+    /// @return The delta encoded line numbers and offsets.
+    std::string_view Postings(const List& list) const;
+};
+
+#endif
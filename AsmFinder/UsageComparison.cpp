@@ -0,0 +1,142 @@
+// UsageComparison.cpp - Defines the UsageComparison class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "UsageComparison.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+void UsageComparison::Compare(const MatchTable& matches,
+                              std::size_t instructionCount,
+                              const ScopeTable& baseline,
+                              const ScopeTable& current)
+{
+    totals.assign(instructionCount, Row{});
+    functions.clear();
+    names.clear();
+
+    for (std::size_t i = 0; i < totals.size(); i++)
+        totals[i].instruction = static_cast<std::uint32_t>(i);
+
+    // The functions of both builds are numbered by name, so a function has
+    // the same number in both. The lines outside any function are number 0.
+    std::unordered_map<std::string, std::uint32_t> functionNumbers;
+    const ScopeTable* scopeTables[]{ &baseline, &current };
+    std::vector<std::uint32_t> scopeFunctions[2];
+    constexpr ScopeTable::Kind function{ ScopeTable::Kind::Function };
+    names.emplace_back();
+    functionNumbers.emplace(std::string{}, 0);
+
+    for (int build = 0; build < 2; build++)
+    {
+        const ScopeTable& scopes = *scopeTables[build];
+
+        for (std::size_t scope = 0; scope < scopes.Size(function); scope++)
+        {
+            const std::string& name = scopes.Name(function, scope);
+            auto found = functionNumbers.emplace(
+                name, static_cast<std::uint32_t>(names.size()));
+
+            if (found.second)
+                names.push_back(name);
+
+            scopeFunctions[build].push_back(found.first->second);
+        }
+    }
+
+    // The matches of each file are in line order, and so are its
+    // functions, so the function of each match is found by walking both.
+    std::unordered_map<std::uint64_t, std::size_t> rows;
+    std::uint32_t file{ 0 };
+    std::size_t nextScope{ 0 };
+
+    for (std::size_t row = 0; row < matches.Size(); row++)
+    {
+        if (matches.FileId(row) > 1)
+            break;
+
+        if (matches.FileId(row) != file)
+        {
+            file = matches.FileId(row);
+            nextScope = 0;
+        }
+
+        const ScopeTable& scopes = *scopeTables[file];
+        std::uint32_t line = matches.LineNumber(row);
+
+        while (nextScope < scopes.Size(function) &&
+               scopes.FirstLine(function, nextScope) <= line)
+        {
+            nextScope++;
+        }
+
+        std::uint32_t number = nextScope > 0
+            ? scopeFunctions[file][nextScope - 1]
+            : 0;
+        std::uint32_t instruction = matches.InstructionId(row);
+        std::uint64_t key = static_cast<std::uint64_t>(number) << 32 |
+            instruction;
+        auto found = rows.emplace(key, functions.size());
+
+        if (found.second)
+            functions.push_back(Row{ instruction, number });
+
+        Row& total = totals[instruction];
+        Row& functionRow = functions[found.first->second];
+
+        if (file == 0)
+        {
+            total.baseline++;
+            functionRow.baseline++;
+        }
+        else
+        {
+            total.current++;
+            functionRow.current++;
+        }
+    }
+
+    functions.erase(std::remove_if(functions.begin(), functions.end(),
+                                   [](const Row& row) {
+                                       return row.Change() == 0;
+                                   }),
+                    functions.end());
+
+    // The largest changes either way come first, and equal ones are in
+    // order of function name and then instruction.
+    std::sort(functions.begin(), functions.end(),
+              [&](const Row& a, const Row& b) {
+                  std::uint64_t aSize = a.Change() < 0 ? -a.Change()
+                                                       : a.Change();
+                  std::uint64_t bSize = b.Change() < 0 ? -b.Change()
+                                                       : b.Change();
+
+                  if (aSize != bSize)
+                      return aSize > bSize;
+
+                  if (a.function != b.function)
+                      return names[a.function] < names[b.function];
+
+                  return a.instruction < b.instruction;
+              });
+}
+
+std::size_t UsageComparison::ChangedCount() const
+{
+    return static_cast<std::size_t>(std::count_if(
+        totals.begin(), totals.end(),
+        [](const Row& row) { return row.Change() != 0; }));
+}
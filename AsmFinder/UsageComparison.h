@@ -0,0 +1,93 @@
+// UsageComparison.h - Declares the UsageComparison class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef USAGE_COMPARISON_H
+#define USAGE_COMPARISON_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "MatchTable.h"
+#include "ScopeTable.h"
+
+/// @brief Compares how many times each instruction was found in two builds
+/// of the same program, in total and in each function.
+///
+/// Both builds are searched together, the baseline as the first file and
+/// the current build as the second, so they are scanned at the same time.
+/// Functions are matched up by name, so a function that moved is still
+/// compared with itself, and one that was added or removed is compared
+/// with nothing.
+class UsageComparison
+{
+public:
+    /// @brief How many times an instruction was found in each build, in
+    /// total or in a single function.
+    struct Row
+    {
+        std::uint32_t instruction{ 0 };
+        std::uint32_t function{ 0 };
+        std::uint64_t baseline{ 0 };
+        std::uint64_t current{ 0 };
+
+        /// @brief Gets how the count changed.
+        /// @return The current count minus the baseline count.
+        std::int64_t Change() const
+        {
+            return static_cast<std::int64_t>(current) -
+                static_cast<std::int64_t>(baseline);
+        }
+    };
+
+    /// @brief Compares the matches of a search of both builds.
+    /// @param matches The matches, with the baseline as file 0 and the
+    /// current build as file 1.
+    /// @param instructionCount The number of instructions searched for.
+    /// @param baseline The functions of the baseline.
+    /// @param current The functions of the current build.
+    void Compare(const MatchTable& matches, std::size_t instructionCount,
+                 const ScopeTable& baseline, const ScopeTable& current);
+
+    /// @brief Gets the total of each instruction.
+    /// @return A row for every instruction, in the order they were searched
+    /// for. Their function is meaningless.
+    const std::vector<Row>& Totals() const { return totals; }
+
+    /// @brief Gets the instructions whose count changed in each function.
+    /// @return A row for every function and instruction whose count
+    /// changed, the largest change first.
+    const std::vector<Row>& Functions() const { return functions; }
+
+    /// @brief Gets the name of a function.
+    /// @param function The function of a row.
+    /// @return The name, which is empty for the lines that aren't in any
+    /// function.
+    const std::string& FunctionName(std::uint32_t function) const
+    {
+        return names[function];
+    }
+
+    /// @brief Gets the number of instructions whose total changed.
+    /// @return The number of rows of Totals() with a change.
+    std::size_t ChangedCount() const;
+private:
+    std::vector<Row> totals;
+    std::vector<Row> functions;
+    std::vector<std::string> names;
+};
+
+#endif
@@ -0,0 +1,316 @@
+// AsmFinderBench.cpp - Defines the entry point of the benchmark program.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <vector>
+#include <wx/cmdline.h>
+#include <wx/filename.h>
+#include <wx/init.h>
+#include "BenchmarkBaseline.h"
+#include "CorpusGenerator.h"
+#include "FixtureCheck.h"
+#include "Instruction.h"
+#include "KernelBenchmark.h"
+#include "PhaseBenchmark.h"
+#include "Version.h"
+
+namespace
+{
+    enum ExitCode
+    {
+        Success = 0,
+        UsageError = 1,
+        BenchmarkError = 2
+    };
+
+    const wxCmdLineEntryDesc commandLineDesc[] =
+    {
+        { wxCMD_LINE_SWITCH, "h", "help", "show this help",
+          wxCMD_LINE_VAL_NONE, wxCMD_LINE_OPTION_HELP },
+        { wxCMD_LINE_OPTION, "s", "size",
+          "size of each generated listing in MiB (default: 64)",
+          wxCMD_LINE_VAL_NUMBER },
+        { wxCMD_LINE_OPTION, "a", "isa",
+          "instruction set to generate: mips, x86, arm or all (default: all)",
+          wxCMD_LINE_VAL_STRING },
+        { wxCMD_LINE_OPTION, "z", "skew",
+          "Zipf exponent of the mnemonic distribution; 0 is uniform "
+          "(default: 1)", wxCMD_LINE_VAL_DOUBLE },
+        { wxCMD_LINE_OPTION, "m", "instructions",
+          "number of mnemonics to search for; 0 is all (default: 10)",
+          wxCMD_LINE_VAL_NUMBER },
+        { wxCMD_LINE_OPTION, "", "seed",
+          "seed of the generated listings (default: 1)",
+          wxCMD_LINE_VAL_NUMBER },
+        { wxCMD_LINE_OPTION, "g", "generate",
+          "only write the listings and instruction lists to dir",
+          wxCMD_LINE_VAL_STRING },
+        { wxCMD_LINE_OPTION, "r", "repeat",
+          "number of times to run each phase (default: 3)",
+          wxCMD_LINE_VAL_NUMBER },
+        { wxCMD_LINE_OPTION, "j", "threads",
+          "number of threads to match with (default: one per CPU)",
+          wxCMD_LINE_VAL_NUMBER },
+        { wxCMD_LINE_SWITCH, "c", "csv", "print the results as CSV" },
+        { wxCMD_LINE_SWITCH, "k", "kernels",
+          "measure the line scanning kernels instead of the phases" },
+        { wxCMD_LINE_SWITCH, "n", "no-line",
+          "with --kernels, don't measure tokenizing with Line" },
+        { wxCMD_LINE_OPTION, "t", "check",
+          "check the search results of the fixtures in dir instead of "
+          "measuring anything", wxCMD_LINE_VAL_STRING },
+        { wxCMD_LINE_OPTION, "b", "baseline",
+          "fail if a phase is slower than in this CSV of an earlier run",
+          wxCMD_LINE_VAL_STRING },
+        { wxCMD_LINE_OPTION, "", "margin",
+          "percent a phase may fall below the baseline (default: 10)",
+          wxCMD_LINE_VAL_DOUBLE },
+        { wxCMD_LINE_PARAM, nullptr, nullptr, "instruction-list",
+          wxCMD_LINE_VAL_STRING, wxCMD_LINE_PARAM_OPTIONAL },
+        { wxCMD_LINE_PARAM, nullptr, nullptr, "source-file",
+          wxCMD_LINE_VAL_STRING,
+          wxCMD_LINE_PARAM_OPTIONAL | wxCMD_LINE_PARAM_MULTIPLE },
+        wxCMD_LINE_DESC_END
+    };
+
+    /// @brief Benchmarks the phases of searching files.
+    /// @param instructionList The path of the instruction list.
+    /// @param sources The names and paths of the files to search.
+    /// @param benchmark Measures the phases. Receives the instructions.
+    /// @return The exit code of the program.
+    int RunPhases(const wxString& instructionList,
+                  const std::vector<std::pair<wxString, wxString>>& sources,
+                  PhaseBenchmark& benchmark)
+    {
+        std::vector<Instruction> instructions;
+
+        if (!Instruction::ReadFile(instructionList, instructions))
+        {
+            std::fprintf(stderr, "Unable to read %s\n",
+                         static_cast<const char*>(instructionList.ToUTF8()));
+            return ExitCode::UsageError;
+        }
+
+        benchmark.SetInstructions(instructions);
+        bool succeeded{ true };
+
+        for (auto& source : sources)
+        {
+            if (!benchmark.Run(source.first, source.second, stdout))
+                succeeded = false;
+        }
+
+        return succeeded ? ExitCode::Success : ExitCode::BenchmarkError;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    wxInitializer initializer{ argc, argv };
+
+    if (!initializer.IsOk())
+    {
+        std::fputs("Unable to initialize wxWidgets\n", stderr);
+        return ExitCode::UsageError;
+    }
+
+    wxCmdLineParser parser{ commandLineDesc, argc, argv };
+    parser.SetLogo(wxString{ PROGRAM_NAME } + " benchmark - measures each "
+                   "phase of a search on generated listings, or on the "
+                   "given instruction list and source files.");
+
+    switch (parser.Parse())
+    {
+    case 0:
+        break;
+    case -1:
+        return ExitCode::Success;
+    default:
+        return ExitCode::UsageError;
+    }
+
+    long size{ 64 };
+    long repeat{ 3 };
+    long threads{ 0 };
+    long instructionCount{ 10 };
+    long seed{ 1 };
+    double skew{ 1.0 };
+    double margin{ 10.0 };
+    wxString isaName{ "all" };
+    parser.Found("s", &size);
+    parser.Found("r", &repeat);
+    parser.Found("j", &threads);
+    parser.Found("m", &instructionCount);
+    parser.Found("seed", &seed);
+    parser.Found("z", &skew);
+    parser.Found("margin", &margin);
+    parser.Found("a", &isaName);
+
+    if (size < 1 || repeat < 1 || threads < 0 || instructionCount < 0 ||
+        seed < 0 || skew < 0 || margin < 0)
+    {
+        std::fputs("The size and repeat count must be at least 1 and the "
+                   "other numbers can't be negative\n", stderr);
+        return ExitCode::UsageError;
+    }
+
+    wxString fixtureDirectory;
+
+    if (parser.Found("t", &fixtureDirectory))
+    {
+        FixtureCheck check;
+        check.SetThreadCount(static_cast<unsigned>(threads));
+
+        bool passed = check.Run(fixtureDirectory, stdout);
+        return passed ? ExitCode::Success : ExitCode::BenchmarkError;
+    }
+
+    if (parser.GetParamCount() == 1)
+    {
+        std::fputs("Give the source files to search after the instruction "
+                   "list\n", stderr);
+        return ExitCode::UsageError;
+    }
+
+    std::vector<CorpusGenerator::Isa> isas;
+    CorpusGenerator::Isa isa;
+
+    if (isaName.Lower() == "all")
+    {
+        isas = { CorpusGenerator::Isa::Mips, CorpusGenerator::Isa::X86,
+                 CorpusGenerator::Isa::Arm };
+    }
+    else if (CorpusGenerator::ParseIsa(isaName, isa))
+    {
+        isas = { isa };
+    }
+    else
+    {
+        std::fprintf(stderr, "Unknown instruction set %s\n",
+                     static_cast<const char*>(isaName.ToUTF8()));
+        return ExitCode::UsageError;
+    }
+
+    auto makeGenerator = [&](CorpusGenerator::Isa generatorIsa) {
+        CorpusGenerator generator{ generatorIsa };
+        generator.SetSize(static_cast<std::size_t>(size) << 20);
+        generator.SetSkew(skew);
+        generator.SetSeed(static_cast<std::uint64_t>(seed));
+        generator.SetInstructionCount(
+            static_cast<std::size_t>(instructionCount));
+        return generator;
+    };
+
+    if (parser.Found("k"))
+    {
+        // Mixing the line endings makes every path in the kernels run.
+        CorpusGenerator generator = makeGenerator(isas.front());
+        generator.SetMixedLineEndings(true);
+
+        KernelBenchmark benchmark{ generator.MakeListing() };
+        benchmark.SetRepeatCount(static_cast<int>(repeat));
+        benchmark.SetCompareLine(!parser.Found("n"));
+
+        return benchmark.Run(stdout) ? ExitCode::Success
+                                     : ExitCode::BenchmarkError;
+    }
+
+    PhaseBenchmark benchmark;
+    benchmark.SetRepeatCount(static_cast<int>(repeat));
+    benchmark.SetThreadCount(static_cast<unsigned>(threads));
+    benchmark.SetCsv(parser.Found("c"));
+
+    BenchmarkBaseline baseline;
+    wxString baselinePath;
+
+    if (parser.Found("b", &baselinePath))
+    {
+        if (!baseline.Read(baselinePath))
+        {
+            std::fprintf(stderr, "Unable to read the results in %s\n",
+                         static_cast<const char*>(baselinePath.ToUTF8()));
+            return ExitCode::UsageError;
+        }
+
+        benchmark.SetBaseline(&baseline, margin);
+    }
+
+    if (parser.Found("c"))
+        PhaseBenchmark::PrintCsvHeader(stdout);
+
+    // Benchmark real files if they were given.
+    if (parser.GetParamCount() > 1)
+    {
+        std::vector<std::pair<wxString, wxString>> sources;
+
+        for (size_t i = 1; i < parser.GetParamCount(); i++)
+            sources.emplace_back(parser.GetParam(i), parser.GetParam(i));
+
+        return RunPhases(parser.GetParam(0), sources, benchmark);
+    }
+
+    wxString directory;
+    bool generateOnly = parser.Found("g", &directory);
+
+    if (generateOnly)
+    {
+        if (!wxDirExists(directory) && !wxMkdir(directory))
+        {
+            std::fprintf(stderr, "Unable to create %s\n",
+                         static_cast<const char*>(directory.ToUTF8()));
+            return ExitCode::UsageError;
+        }
+    }
+    else
+    {
+        directory = wxFileName::GetTempDir();
+    }
+
+    int exitCode{ ExitCode::Success };
+
+    for (auto isa : isas)
+    {
+        wxString name = CorpusGenerator::IsaName(isa);
+        wxString listing = wxFileName{ directory,
+                                       "AsmFinderBench-" + name + ".s" }
+                               .GetFullPath();
+        wxString instructionList = wxFileName{ directory,
+                                               "AsmFinderBench-" + name +
+                                               ".txt" }.GetFullPath();
+        CorpusGenerator generator = makeGenerator(isa);
+
+        if (!generator.WriteListing(listing) ||
+            !generator.WriteInstructionList(instructionList))
+        {
+            std::fprintf(stderr, "Unable to write the %s listing\n",
+                         static_cast<const char*>(name.ToUTF8()));
+            return ExitCode::BenchmarkError;
+        }
+
+        if (generateOnly)
+            continue;
+
+        int result = RunPhases(instructionList, { { name, listing } },
+                               benchmark);
+        wxRemoveFile(listing);
+        wxRemoveFile(instructionList);
+
+        if (result != ExitCode::Success)
+            exitCode = result;
+    }
+
+    return exitCode;
+}
@@ -0,0 +1,87 @@
+// BenchmarkBaseline.cpp - Defines the BenchmarkBaseline class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BenchmarkBaseline.h"
+
+#include <cstdlib>
+#include <wx/textfile.h>
+
+bool BenchmarkBaseline::Read(const wxString& path)
+{
+    wxTextFile file;
+
+    if (!file.Open(path))
+        return false;
+
+    speeds.clear();
+
+    for (std::size_t i = 0; i < file.GetLineCount(); i++)
+    {
+        std::string line{ file[i].ToUTF8() };
+
+        // The columns are file, phase, seconds, bytes per second, lines per
+        // second and peak memory. The file name may hold commas, so the
+        // columns are found from the end of the line.
+        std::size_t commas[5];
+        std::size_t position{ line.size() };
+        bool complete{ true };
+
+        for (std::size_t& comma : commas)
+        {
+            position = position == 0 ? std::string::npos
+                                      : line.rfind(',', position - 1);
+
+            if (position == std::string::npos)
+            {
+                complete = false;
+                break;
+            }
+
+            comma = position;
+        }
+
+        if (!complete)
+            continue;
+
+        std::string linesPerSecond = line.substr(commas[1] + 1,
+                                                 commas[0] - commas[1] - 1);
+        char* parsed{ nullptr };
+        double speed = std::strtod(linesPerSecond.c_str(), &parsed);
+
+        // The header and anything else that isn't a result are skipped.
+        if (linesPerSecond.empty() || *parsed != '\0' || speed <= 0)
+            continue;
+
+        std::string phase = line.substr(commas[4] + 1,
+                                        commas[3] - commas[4] - 1);
+        speeds[{ line.substr(0, commas[4]), phase }] = speed;
+    }
+
+    return !speeds.empty();
+}
+
+bool BenchmarkBaseline::Find(const std::string& file,
+                             const std::string& phase,
+                             double& linesPerSecond) const
+{
+    auto speed = speeds.find({ file, phase });
+
+    if (speed == speeds.end())
+        return false;
+
+    linesPerSecond = speed->second;
+    return true;
+}
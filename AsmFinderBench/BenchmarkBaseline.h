@@ -0,0 +1,50 @@
+// BenchmarkBaseline.h - Declares the BenchmarkBaseline class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BENCHMARK_BASELINE_H
+#define BENCHMARK_BASELINE_H
+
+#include <map>
+#include <string>
+#include <utility>
+#include <wx/string.h>
+
+/// @brief The speeds an earlier run of the benchmark measured, read from
+/// the CSV it printed with --csv.
+///
+/// A later run compares the lines per second of each phase against the
+/// same phase of the same file here, so a slower build can fail CI.
+class BenchmarkBaseline
+{
+public:
+    /// @brief Reads the results of an earlier run.
+    /// @param path The path of the CSV file.
+    /// @return True if the file was read and has at least one result,
+    /// otherwise false.
+    bool Read(const wxString& path);
+
+    /// @brief Finds the speed of a phase.
+    /// @param file The name the file was shown with.
+    /// @param phase The name of the phase.
+    /// @param linesPerSecond Receives the lines per second of the phase.
+    /// @return True if the baseline has the phase, otherwise false.
+    bool Find(const std::string& file, const std::string& phase,
+              double& linesPerSecond) const;
+private:
+    std::map<std::pair<std::string, std::string>, double> speeds;
+};
+
+#endif
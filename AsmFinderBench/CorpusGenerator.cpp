@@ -0,0 +1,377 @@
+// CorpusGenerator.cpp - Defines the CorpusGenerator class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CorpusGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <wx/ffile.h>
+
+namespace
+{
+    // Listings are written in blocks of about this size.
+    constexpr std::size_t blockSize{ 1 << 20 };
+
+    const char* const mipsRegisters[] =
+    {
+        "$zero", "$at", "$v0", "$v1", "$a0", "$a1", "$a2", "$a3", "$t0",
+        "$t1", "$t2", "$t3", "$t4", "$t5", "$t6", "$t7", "$t8", "$t9", "$s0",
+        "$s1", "$s2", "$s3", "$s4", "$s5", "$s6", "$s7", "$gp", "$sp", "$fp",
+        "$ra"
+    };
+
+    const char* const x86Registers[] =
+    {
+        "%eax", "%ebx", "%ecx", "%edx", "%esi", "%edi", "%rax", "%rbx",
+        "%rcx", "%rdx", "%rsi", "%rdi", "%rbp", "%rsp", "%r8", "%r9", "%r10",
+        "%r11", "%r12", "%r13", "%r14", "%r15"
+    };
+
+    const char* const armRegisters[] =
+    {
+        "r0", "r1", "r2", "r3", "r4", "r5", "r6", "r7", "r8", "r9", "r10",
+        "r11", "r12", "sp", "lr", "pc"
+    };
+
+    template <typename T, std::size_t N>
+    constexpr std::size_t CountOf(T (&)[N])
+    {
+        return N;
+    }
+}
+
+bool CorpusGenerator::ParseIsa(const wxString& name, Isa& isa)
+{
+    for (auto candidate : { Isa::Mips, Isa::X86, Isa::Arm })
+    {
+        if (name.Lower() == IsaName(candidate))
+        {
+            isa = candidate;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+const char* CorpusGenerator::IsaName(Isa isa)
+{
+    switch (isa)
+    {
+    case Isa::Mips:
+        return "mips";
+    case Isa::X86:
+        return "x86";
+    case Isa::Arm:
+        return "arm";
+    }
+
+    return "";
+}
+
+std::string CorpusGenerator::MakeListing() const
+{
+    std::string text;
+    text.reserve(size + blockSize);
+
+    Generate([&](const std::string& block) {
+        text += block;
+        return true;
+    });
+
+    return text;
+}
+
+bool CorpusGenerator::WriteListing(const wxString& path) const
+{
+    wxFFile file{ path, "wb" };
+
+    if (!file.IsOpened())
+        return false;
+
+    bool written = Generate([&](const std::string& block) {
+        return file.Write(block.data(), block.size()) == block.size();
+    });
+
+    return written && file.Close();
+}
+
+bool CorpusGenerator::WriteInstructionList(const wxString& path) const
+{
+    wxFFile file{ path, "wb" };
+
+    if (!file.IsOpened())
+        return false;
+
+    const std::vector<Opcode>& opcodes = Opcodes();
+    std::size_t count = instructionCount == 0
+        ? opcodes.size()
+        : std::min(instructionCount, opcodes.size());
+    std::string list;
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        std::size_t rank = i * opcodes.size() / count;
+        list += opcodes[rank].mnemonic;
+        list += ",Rank ";
+        list += std::to_string(rank + 1);
+        list += " ";
+        list += IsaName(isa);
+        list += " instruction\n";
+    }
+
+    return file.Write(list.data(), list.size()) == list.size() &&
+        file.Close();
+}
+
+const std::vector<CorpusGenerator::Opcode>& CorpusGenerator::Opcodes() const
+{
+    static const std::vector<Opcode> mips =
+    {
+        { "lw", "r, m" }, { "addiu", "r, r, i" }, { "sw", "r, m" },
+        { "move", "r, r" }, { "nop", "" }, { "jal", "l" },
+        { "beq", "r, r, l" }, { "bne", "r, r, l" }, { "addu", "r, r, r" },
+        { "lui", "r, i" }, { "li", "r, i" }, { "jr", "r" },
+        { "sll", "r, r, i" }, { "ori", "r, r, i" }, { "andi", "r, r, i" },
+        { "lbu", "r, m" }, { "sb", "r, m" }, { "subu", "r, r, r" },
+        { "slt", "r, r, r" }, { "sltu", "r, r, r" }, { "lh", "r, m" },
+        { "sh", "r, m" }, { "beqz", "r, l" }, { "bnez", "r, l" },
+        { "mult", "r, r" }, { "mflo", "r" }, { "mfhi", "r" },
+        { "div", "r, r" }, { "xor", "r, r, r" }, { "srl", "r, r, i" },
+        { "sra", "r, r, i" }, { "and", "r, r, r" }, { "or", "r, r, r" },
+        { "j", "l" }, { "lb", "r, m" }, { "slti", "r, r, i" },
+        { "syscall", "" }, { "break", "" }
+    };
+
+    static const std::vector<Opcode> x86 =
+    {
+        { "mov", "r, r" }, { "movl", "i, m" }, { "movq", "m, r" },
+        { "lea", "m, r" }, { "call", "l" }, { "add", "i, r" },
+        { "cmp", "r, r" }, { "jmp", "l" }, { "je", "l" }, { "jne", "l" },
+        { "push", "r" }, { "pop", "r" }, { "test", "r, r" },
+        { "sub", "i, r" }, { "xor", "r, r" }, { "and", "i, r" },
+        { "or", "r, r" }, { "ret", "" }, { "nop", "" },
+        { "movzbl", "m, r" }, { "imul", "r, r" }, { "shl", "i, r" },
+        { "sar", "i, r" }, { "cmovne", "r, r" }, { "jg", "l" },
+        { "jl", "l" }, { "jbe", "l" }, { "leave", "" }, { "cltq", "" },
+        { "div", "r" }
+    };
+
+    static const std::vector<Opcode> arm =
+    {
+        { "ldr", "r, m" }, { "str", "r, m" }, { "mov", "r, r" },
+        { "add", "r, r, i" }, { "bl", "l" }, { "cmp", "r, i" },
+        { "b", "l" }, { "beq", "l" }, { "bne", "l" }, { "sub", "r, r, i" },
+        { "push", "{r, r}" }, { "pop", "{r, r}" }, { "ldrb", "r, m" },
+        { "strb", "r, m" }, { "and", "r, r, r" }, { "orr", "r, r, r" },
+        { "eor", "r, r, r" }, { "lsl", "r, r, i" }, { "lsr", "r, r, i" },
+        { "mul", "r, r, r" }, { "bx", "r" }, { "movw", "r, i" },
+        { "movt", "r, i" }, { "tst", "r, i" }, { "ldm", "r, {r, r}" },
+        { "stm", "r, {r, r}" }, { "bgt", "l" }, { "blt", "l" },
+        { "nop", "" }
+    };
+
+    switch (isa)
+    {
+    case Isa::X86:
+        return x86;
+    case Isa::Arm:
+        return arm;
+    default:
+        return mips;
+    }
+}
+
+bool CorpusGenerator::Generate(
+    const std::function<bool(const std::string&)>& write) const
+{
+    // Zipf's law: the opcode with rank k is used in proportion to 1 / k^s.
+    // The weights are kept as integers so picking one doesn't depend on how
+    // the platform rounds floating point numbers.
+    const std::vector<Opcode>& opcodes = Opcodes();
+    std::vector<std::uint64_t> weights;
+    std::uint64_t total{ 0 };
+
+    for (std::size_t rank = 1; rank <= opcodes.size(); rank++)
+    {
+        total += static_cast<std::uint64_t>(
+            std::llround(1e9 / std::pow(static_cast<double>(rank), skew)));
+        weights.push_back(total);
+    }
+
+    static const char* const endings[] = { "\n", "\r\n", "\r" };
+    std::mt19937_64 random{ seed };
+    std::string block;
+    std::string line;
+    std::size_t written{ 0 };
+    block.reserve(blockSize + 256);
+
+    while (written + block.size() < size)
+    {
+        MakeLine(random, weights, line);
+        block += line;
+        block += mixedLineEndings ? endings[Pick(random, CountOf(endings))]
+                                  : "\n";
+
+        if (block.size() >= blockSize)
+        {
+            if (!write(block))
+                return false;
+
+            written += block.size();
+            block.clear();
+        }
+    }
+
+    return write(block);
+}
+
+void CorpusGenerator::MakeLine(std::mt19937_64& random,
+                               const std::vector<std::uint64_t>& weights,
+                               std::string& line) const
+{
+    line.clear();
+
+    // Real listings are mostly instructions, with labels, comments,
+    // directives and blank lines mixed in.
+    std::uint64_t kind = Pick(random, 100);
+    const char* comment = isa == Isa::Arm ? "@" : "#";
+
+    if (kind < 4)
+    {
+        line += isa == Isa::Mips ? "L" : ".L";
+        line += std::to_string(Pick(random, 100000));
+        line += ':';
+        return;
+    }
+
+    if (kind < 7)
+    {
+        line += "\t";
+        line += comment;
+        line += " spill the saved registers before the call";
+        return;
+    }
+
+    if (kind == 7)
+    {
+        line += "\t.align\t2";
+        return;
+    }
+
+    if (kind == 8)
+    {
+        char word[32];
+        std::snprintf(word, sizeof(word), "\t.word\t0x%08llx",
+                      static_cast<unsigned long long>(
+                          Pick(random, 0x100000000ULL)));
+        line += word;
+        return;
+    }
+
+    if (kind < 11)
+        return;
+
+    std::uint64_t weight = Pick(random, weights.back());
+    std::size_t rank = std::upper_bound(weights.begin(), weights.end(),
+                                        weight) - weights.begin();
+    const Opcode& opcode = Opcodes()[rank];
+
+    line += '\t';
+    line += opcode.mnemonic;
+
+    if (*opcode.operands != '\0')
+        line += '\t';
+
+    for (const char* c = opcode.operands; *c != '\0'; c++)
+    {
+        if (*c == 'r' || *c == 'i' || *c == 'm' || *c == 'l')
+            AppendOperand(random, *c, line);
+        else
+            line += *c;
+    }
+
+    // A few instructions have trailing comments, which makes for some long
+    // lines.
+    if (Pick(random, 10) == 0)
+    {
+        line += "\t\t";
+        line += comment;
+        line += " update the loop counter";
+    }
+}
+
+void CorpusGenerator::AppendOperand(std::mt19937_64& random, char kind,
+                                    std::string& line) const
+{
+    auto appendRegister = [&]() {
+        switch (isa)
+        {
+        case Isa::X86:
+            line += x86Registers[Pick(random, CountOf(x86Registers))];
+            break;
+        case Isa::Arm:
+            line += armRegisters[Pick(random, CountOf(armRegisters))];
+            break;
+        default:
+            line += mipsRegisters[Pick(random, CountOf(mipsRegisters))];
+            break;
+        }
+    };
+
+    std::string immediate = std::to_string(Pick(random, 256));
+
+    switch (kind)
+    {
+    case 'r':
+        appendRegister();
+        break;
+    case 'i':
+        line += isa == Isa::X86 ? "$" : isa == Isa::Arm ? "#" : "";
+        line += immediate;
+        break;
+    case 'm':
+        if (isa == Isa::Arm)
+        {
+            line += '[';
+            appendRegister();
+            line += ", #";
+            line += immediate;
+            line += ']';
+        }
+        else
+        {
+            line += isa == Isa::X86 ? "-" : "";
+            line += immediate;
+            line += '(';
+            appendRegister();
+            line += ')';
+        }
+        break;
+    default:
+        line += isa == Isa::Mips ? "L" : ".L";
+        line += std::to_string(Pick(random, 100000));
+        break;
+    }
+}
+
+std::uint64_t CorpusGenerator::Pick(std::mt19937_64& random,
+                                    std::uint64_t count)
+{
+    // The bias of taking the remainder is far too small to matter here.
+    return random() % count;
+}
@@ -0,0 +1,148 @@
+// CorpusGenerator.h - Declares the CorpusGenerator class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CORPUS_GENERATOR_H
+#define CORPUS_GENERATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include <wx/string.h>
+
+/// @brief Generates synthetic assembly language listings to benchmark with.
+///
+/// The same settings always generate the same bytes on every platform, so
+/// results from different machines and builds can be compared.
+class CorpusGenerator
+{
+public:
+    /// @brief Identifies the instruction set of a listing.
+    enum class Isa
+    {
+        Mips,
+        X86,
+        Arm
+    };
+
+    /// @brief Constructor; creates a new instance of CorpusGenerator.
+    /// @param isa The instruction set of the listings to generate.
+    explicit CorpusGenerator(Isa isa) : isa{ isa } {}
+
+    /// @brief Parses the name of an instruction set.
+    /// @param name The name, which is "mips", "x86" or "arm".
+    /// @param isa Receives the instruction set.
+    /// @return True if the name is known, otherwise false.
+    static bool ParseIsa(const wxString& name, Isa& isa);
+
+    /// @brief Gets the name of an instruction set.
+    /// @param isa The instruction set.
+    /// @return The name, which ParseIsa() accepts.
+    static const char* IsaName(Isa isa);
+
+    /// @brief Sets the size of the listing.
+    /// @param bytes The size in bytes. The listing ends with the first
+    /// complete line at or past this size.
+    void SetSize(std::size_t bytes) { size = bytes; }
+
+    /// @brief Sets how unevenly the mnemonics are used.
+    /// @param exponent The exponent of the Zipf distribution the mnemonics
+    /// are picked from. Zero uses every mnemonic equally, and larger values
+    /// make the first mnemonics in the table more and more common.
+    void SetSkew(double exponent) { skew = exponent; }
+
+    /// @brief Sets the seed of the random numbers.
+    /// @param value The seed.
+    void SetSeed(std::uint64_t value) { seed = value; }
+
+    /// @brief Sets how many mnemonics the instruction list has.
+    /// @param count The number of mnemonics, which are spread evenly over
+    /// the common and rare ones. Zero lists every mnemonic.
+    void SetInstructionCount(std::size_t count) { instructionCount = count; }
+
+    /// @brief Sets whether the lines end in a mix of "\n", "\r\n" and "\r".
+    /// @param enabled True to mix the line endings, or false to end every
+    /// line in "\n".
+    void SetMixedLineEndings(bool enabled) { mixedLineEndings = enabled; }
+
+    /// @brief Generates the listing in memory.
+    /// @return The text of the listing.
+    std::string MakeListing() const;
+
+    /// @brief Writes the listing.
+    /// @param path The path of the file to write.
+    /// @return True if the file was written, otherwise false.
+    bool WriteListing(const wxString& path) const;
+
+    /// @brief Writes an instruction list for the listing.
+    /// @param path The path of the file to write, which Instruction::ReadFile
+    /// can read.
+    /// @return True if the file was written, otherwise false.
+    bool WriteInstructionList(const wxString& path) const;
+private:
+    /// @brief A mnemonic and the form of its operands.
+    struct Opcode
+    {
+        const char* mnemonic;
+
+        // Each "r" is replaced by a register, "i" by an immediate value, "m"
+        // by a memory operand and "l" by a label. Everything else is copied.
+        const char* operands;
+    };
+
+    Isa isa;
+    std::size_t size{ 64 << 20 };
+    double skew{ 1.0 };
+    std::uint64_t seed{ 1 };
+    std::size_t instructionCount{ 10 };
+    bool mixedLineEndings{ false };
+
+    /// @brief Generates the listing a block at a time.
+    /// @param write Called with each block of text, and returns false to
+    /// stop.
+    /// @return True if every block was written, otherwise false.
+    bool Generate(const std::function<bool(const std::string&)>& write) const;
+
+    /// @brief Gets the mnemonics of the instruction set, most common first.
+    /// @return The opcode table.
+    const std::vector<Opcode>& Opcodes() const;
+
+    /// @brief Generates one line of the listing.
+    /// @param random The random number generator.
+    /// @param weights The cumulative weight of each opcode.
+    /// @param line Receives the line, without a line ending.
+    void MakeLine(std::mt19937_64& random,
+                  const std::vector<std::uint64_t>& weights,
+                  std::string& line) const;
+
+    /// @brief Appends an operand to a line.
+    /// @param random The random number generator.
+    /// @param kind The kind of operand from the opcode table.
+    /// @param line The line to append to.
+    void AppendOperand(std::mt19937_64& random, char kind,
+                       std::string& line) const;
+
+    /// @brief Picks a random number in a range. Unlike the standard
+    /// distributions, this gives the same numbers with every library.
+    /// @param random The random number generator.
+    /// @param count The size of the range.
+    /// @return A number from zero to count - 1.
+    static std::uint64_t Pick(std::mt19937_64& random, std::uint64_t count);
+};
+
+#endif
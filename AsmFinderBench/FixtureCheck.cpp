@@ -0,0 +1,1103 @@
+// FixtureCheck.cpp - Defines the FixtureCheck class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FixtureCheck.h"
+
+#include <algorithm>
+#include <clocale>
+#include <cstdlib>
+#include <wx/dir.h>
+#include <wx/ffile.h>
+#include <wx/filename.h>
+#include <wx/textfile.h>
+#include "Decompressor.h"
+#include "FileSignature.h"
+#include "Line.h"
+#include "LineScanner.h"
+#include "SourceFile.h"
+#include "TokenIndex.h"
+#include "UsageComparison.h"
+
+namespace
+{
+    char FoldCase(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    // Line lowers the case of the ASCII letters of the token it finds while
+    // LineScanner leaves it as is, so ASCII letters are compared without
+    // regard to case and every other byte must be the same.
+    bool SameToken(std::string_view lineToken, std::string_view scannerToken)
+    {
+        if (lineToken.size() != scannerToken.size())
+            return false;
+
+        for (std::size_t i = 0; i < lineToken.size(); i++)
+        {
+            if (FoldCase(lineToken[i]) != FoldCase(scannerToken[i]))
+                return false;
+        }
+
+        return true;
+    }
+
+    // Finds a UTF-8 locale and switches to it. Their names differ from one
+    // system to another, so the usual ones are tried in turn.
+    std::string UseUtf8Locale()
+    {
+        for (const char* name : { "C.UTF-8", "C.utf8", "en_US.UTF-8",
+                                  ".UTF-8" })
+        {
+            if (std::setlocale(LC_ALL, name) != nullptr)
+                return name;
+        }
+
+        return {};
+    }
+
+    // Files are read and written byte for byte, since their line endings
+    // and encoding are what is being checked.
+    bool ReadFile(const wxString& path, std::string& text)
+    {
+        wxFFile file{ path, "rb" };
+
+        if (!file.IsOpened())
+            return false;
+
+        text.resize(static_cast<std::size_t>(file.Length()));
+        return text.empty() ||
+            file.Read(&text[0], text.size()) == text.size();
+    }
+
+    bool WriteFile(const wxString& path, const std::string& text)
+    {
+        wxFFile file{ path, "wb" };
+        return file.IsOpened() &&
+            file.Write(text.data(), text.size()) == text.size() &&
+            file.Close();
+    }
+
+    // Reads "line name" from a line of a .expected file.
+    bool ParseScope(const wxString& text, std::uint32_t& line,
+                    std::string& name)
+    {
+        std::string utf8{ text.ToUTF8() };
+        char* end{ nullptr };
+        unsigned long number = std::strtoul(utf8.c_str(), &end, 10);
+
+        if (end == utf8.c_str() || *end != ' ' || end[1] == '\0')
+            return false;
+
+        line = static_cast<std::uint32_t>(number);
+        name = end + 1;
+        return true;
+    }
+
+    // Numbers in an index are little-endian, the way TokenIndex saves them.
+    std::uint64_t GetFixed(const std::string& data, std::size_t position,
+                           int bytes)
+    {
+        std::uint64_t value{ 0 };
+
+        for (int i = 0; i < bytes; i++)
+        {
+            value |= static_cast<std::uint64_t>(
+                static_cast<unsigned char>(data[position + i])) << (i * 8);
+        }
+
+        return value;
+    }
+
+    void PutFixed(std::string& data, std::size_t position,
+                  std::uint64_t value)
+    {
+        for (int i = 0; i < 8; i++)
+            data[position + i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+    }
+
+    std::vector<std::size_t> LineOffsets(const std::string& text)
+    {
+        LineScanner scanner{ text.data(), text.size() };
+        std::vector<std::size_t> offsets;
+
+        while (scanner.Next())
+            offsets.push_back(scanner.Offset());
+
+        return offsets;
+    }
+
+    // Each match as its line, instruction and offset, which an updated
+    // table must have the same as a new search.
+    std::vector<std::string> Rows(const MatchTable& matches)
+    {
+        std::vector<std::string> rows;
+
+        for (std::size_t row = 0; row < matches.Size(); row++)
+        {
+            rows.push_back(std::to_string(matches.LineNumber(row)) + ':' +
+                           std::to_string(matches.InstructionId(row)) + '@' +
+                           std::to_string(matches.Offset(row)));
+        }
+
+        return rows;
+    }
+}
+
+bool FixtureCheck::Run(const wxString& directory, std::FILE* output) const
+{
+    wxDir dir{ directory };
+    std::vector<wxString> names;
+    wxString name;
+
+    for (bool found = dir.GetFirst(&name, "*.expected", wxDIR_FILES); found;
+         found = dir.GetNext(&name))
+    {
+        names.push_back(wxFileName{ name }.GetName());
+    }
+
+    if (names.empty())
+    {
+        std::fprintf(stderr, "There are no fixtures in %s\n",
+                     static_cast<const char*>(directory.ToUTF8()));
+        return false;
+    }
+
+    std::sort(names.begin(), names.end());
+
+    // The GUI runs in the user's locale, which is usually UTF-8, while the
+    // command line tools stay in the C locale, so every fixture is checked
+    // in both to make sure the locale doesn't change what is found.
+    std::string originalLocale{ std::setlocale(LC_ALL, nullptr) };
+    std::vector<std::string> locales{ "C" };
+    std::string utf8Locale = UseUtf8Locale();
+
+    if (utf8Locale.empty())
+    {
+        std::fputs("  No UTF-8 locale was found, so the fixtures are only "
+                   "checked in the C locale\n", output);
+    }
+    else
+    {
+        locales.push_back(utf8Locale);
+    }
+
+    bool succeeded{ true };
+
+    for (const wxString& fixtureName : names)
+    {
+        wxString base = wxFileName{ directory, fixtureName }.GetFullPath();
+        Fixture fixture;
+        std::string problem;
+        bool passed = Read(base, fixture, problem);
+
+        for (std::size_t i = 0; i < locales.size() && passed; i++)
+        {
+            std::setlocale(LC_ALL, locales[i].c_str());
+
+            if (!Check(fixture, problem))
+            {
+                problem += " in the " + locales[i] + " locale";
+                passed = false;
+            }
+        }
+
+        if (passed)
+        {
+            std::fprintf(output, "  %-22s ok\n",
+                         static_cast<const char*>(fixtureName.ToUTF8()));
+        }
+        else
+        {
+            std::fprintf(output, "  %-22s FAILED: %s\n",
+                         static_cast<const char*>(fixtureName.ToUTF8()),
+                         problem.c_str());
+            succeeded = false;
+        }
+    }
+
+    std::setlocale(LC_ALL, originalLocale.c_str());
+    return succeeded;
+}
+
+bool FixtureCheck::Read(const wxString& base, Fixture& fixture,
+                        std::string& problem)
+{
+    wxString listingPath = base + ".s";
+    fixture.name = wxFileName{ listingPath }.GetFullName();
+
+    if (!ReadFile(listingPath, fixture.text))
+    {
+        problem = "unable to read the listing";
+        return false;
+    }
+
+    wxTextFile expected;
+
+    if (!expected.Open(base + ".expected"))
+    {
+        problem = "unable to read the expected matches";
+        return false;
+    }
+
+    for (std::size_t i = 0; i < expected.GetLineCount(); i++)
+    {
+        wxString line = expected[i];
+        wxString rest;
+
+        if (line.empty() || line.StartsWith("#"))
+            continue;
+
+        if (line.StartsWith("dialect ", &rest))
+        {
+            if (auto dialect = Dialect::FromName(rest))
+            {
+                fixture.dialect = *dialect;
+                continue;
+            }
+        }
+        else if (line.StartsWith("instruction ", &rest))
+        {
+            if (auto instruction = Instruction::Parse(rest))
+            {
+                fixture.instructions.push_back(*instruction);
+                continue;
+            }
+        }
+        else if (line.StartsWith("match ", &rest))
+        {
+            std::string numbers{ rest.ToUTF8() };
+            char* end{ nullptr };
+            unsigned long number = std::strtoul(numbers.c_str(), &end, 10);
+            char* positionEnd{ nullptr };
+            unsigned long position = std::strtoul(end, &positionEnd, 10);
+
+            if (end != numbers.c_str() && positionEnd != end &&
+                *positionEnd == '\0')
+            {
+                fixture.expected.emplace_back(
+                    static_cast<std::uint32_t>(number),
+                    static_cast<std::uint32_t>(position));
+                continue;
+            }
+        }
+        else if (line.StartsWith("function ", &rest) ||
+                 line.StartsWith("section ", &rest))
+        {
+            ScopeList& scopes = line.StartsWith("function ") ?
+                fixture.functions : fixture.sections;
+            std::uint32_t number;
+            std::string name;
+
+            if (ParseScope(rest, number, name))
+            {
+                scopes.emplace_back(number, name);
+                fixture.hasScopes = true;
+                continue;
+            }
+        }
+        else if (line.StartsWith("baseline ", &rest))
+        {
+            wxString path = wxFileName{ wxFileName{ base }.GetPath(), rest }
+                .GetFullPath();
+
+            if (!ReadFile(path, fixture.baselineText))
+            {
+                problem = "unable to read the baseline";
+                return false;
+            }
+
+            fixture.hasBaseline = true;
+            continue;
+        }
+        else if (line.StartsWith("change ", &rest))
+        {
+            fixture.changes.push_back(std::string{ rest.ToUTF8() });
+            continue;
+        }
+
+        problem = "line " + std::to_string(i + 1) + " of the expected "
+            "matches isn't understood";
+        return false;
+    }
+
+    for (const char* extension : { ".gz", ".zst", ".xz" })
+    {
+        if (wxFileExists(listingPath + extension))
+            fixture.compressedPaths.push_back(listingPath + extension);
+    }
+
+    for (ResultWriter::Format format : ResultWriter::formats)
+    {
+        wxString path = base + ".result." + ResultWriter::Extension(format);
+        std::string text;
+
+        if (!wxFileExists(path))
+            continue;
+
+        if (!ReadFile(path, text))
+        {
+            problem = "unable to read the saved results";
+            return false;
+        }
+
+        fixture.results.emplace_back(format, text);
+    }
+
+    return true;
+}
+
+bool FixtureCheck::Check(const Fixture& fixture, std::string& problem) const
+{
+    wxString path = wxFileName::CreateTempFileName("AsmFinderBench");
+
+    if (!WriteFile(path, fixture.text))
+    {
+        problem = "unable to write the fixture";
+        wxRemoveFile(path);
+        return false;
+    }
+
+    // Line tokenizes a line the way the original search did, which the
+    // scanner has to keep doing.
+    LineScanner scanner{ fixture.text.data(), fixture.text.size() };
+    std::vector<std::size_t> lineOffsets;
+
+    while (scanner.Next())
+    {
+        std::string_view text = scanner.Text();
+        Line line{ scanner.Number(),
+                   wxString::FromUTF8(text.data(), text.size()) };
+        wxScopedCharBuffer token = line.FirstToken().ToUTF8();
+
+        if (!SameToken(std::string_view(token.data(), token.length()),
+                       scanner.FirstToken()))
+        {
+            problem = "Line and LineScanner disagree on the first token of "
+                      "line " + std::to_string(scanner.Number());
+        }
+
+        lineOffsets.push_back(scanner.Offset());
+    }
+
+    if (problem.empty())
+        CheckSearches(fixture, path, lineOffsets, problem);
+
+    if (problem.empty())
+        CheckDamagedIndex(fixture, path, lineOffsets, problem);
+
+    if (problem.empty())
+        CheckCompressed(fixture, lineOffsets, problem);
+
+    if (problem.empty())
+        CheckUpdates(fixture, fixture.text, lineOffsets, true, problem);
+
+    // Several copies of the listing span more than one block of the file's
+    // signature, so a change is found between blocks that are the same.
+    if (problem.empty() && !fixture.text.empty())
+    {
+        std::string copies;
+
+        while (copies.size() <= 3 * FileSignature::blockSize)
+            copies += fixture.text;
+
+        CheckUpdates(fixture, copies, LineOffsets(copies), false, problem);
+    }
+
+    if (problem.empty())
+        CheckResults(fixture, path, problem);
+
+    if (problem.empty())
+        CheckComparison(fixture, path, problem);
+
+    wxRemoveFile(TokenIndex::PathFor(path));
+    wxRemoveFile(path);
+    return problem.empty();
+}
+
+void FixtureCheck::CheckSearches(const Fixture& fixture,
+                                 const wxString& path,
+                                 const std::vector<std::size_t>& lineOffsets,
+                                 std::string& problem) const
+{
+    // A chunk of a single byte ends at the end of every line, and one of 64
+    // bytes usually ends part way through one.
+    const char* const searches[]{ "one file", "two files", "building index",
+                                  "loaded index" };
+    const unsigned threadCounts[]{ 1, threadCount };
+    const std::size_t chunkSizes[]{ 0, 1, 64 };
+
+    for (unsigned threads : threadCounts)
+    {
+        for (std::size_t chunkSize : chunkSizes)
+        {
+            for (int search = 0; search < 4 && problem.empty(); search++)
+            {
+                if (search == 2)
+                    wxRemoveFile(TokenIndex::PathFor(path));
+
+                std::vector<SourceFile> sources(search == 1 ? 2 : 1);
+
+                for (SourceFile& source : sources)
+                    source.Open(path);
+
+                SearchEngine engine = Engine(fixture, threads, chunkSize);
+                engine.SetUseIndex(search >= 2);
+
+                // A single file has its functions and sections found the
+                // way the GUI does once the search is done.
+                std::vector<ScopeTable> scopes;
+                engine.SetScopeTables(search == 0 ? nullptr : &scopes);
+
+                MatchTable matches;
+
+                if (search == 0)
+                {
+                    engine.Search(sources[0], fixture.instructions, matches);
+                    scopes.resize(1);
+                    scopes[0].Build(sources[0], fixture.dialect);
+                }
+                else
+                {
+                    engine.Search(sources, fixture.instructions, matches);
+                }
+
+                problem = CheckMatches(fixture, matches, sources.size(),
+                                       lineOffsets);
+
+                if (problem.empty() && scopes.size() != sources.size())
+                    problem = "the functions and sections weren't found";
+
+                for (std::size_t i = 0; i < scopes.size() && problem.empty();
+                     i++)
+                {
+                    problem = CheckScopes(fixture, scopes[i]);
+                }
+
+                if (!problem.empty())
+                    problem += Describe(threads, chunkSize, searches[search]);
+            }
+        }
+    }
+}
+
+void FixtureCheck::CheckDamagedIndex(
+    const Fixture& fixture, const wxString& path,
+    const std::vector<std::size_t>& lineOffsets, std::string& problem) const
+{
+    // The header of an index, as TokenIndex::Save writes it, holds the
+    // number of lists at 40, and where the lines of the functions start
+    // among the postings and their size at 48. The directory follows it,
+    // where each list gives the size of its token, the token, its count,
+    // where its postings start and their size.
+    constexpr std::size_t listCountPosition{ 40 };
+    constexpr std::size_t symbolOffsetPosition{ 48 };
+    constexpr std::size_t directoryPosition{ 72 };
+
+    wxString indexPath = TokenIndex::PathFor(path);
+    std::string index;
+
+    if (!ReadFile(indexPath, index) || index.size() < directoryPosition)
+    {
+        problem = "the index wasn't saved";
+        return;
+    }
+
+    std::vector<std::pair<const char*, std::string>> damages;
+    damages.emplace_back("cut short", index.substr(0, 40));
+    damages.emplace_back("missing its last byte",
+                         index.substr(0, index.size() - 1));
+
+    // An offset that wraps around to zero when its size is added to it
+    // looks like it is inside the file.
+    std::string damaged{ index };
+    PutFixed(damaged, symbolOffsetPosition,
+             0 - GetFixed(index, symbolOffsetPosition + 8, 8));
+    damages.emplace_back("with the functions out of range", damaged);
+
+    damaged = index;
+    std::size_t position{ directoryPosition };
+
+    for (std::uint64_t l = GetFixed(index, listCountPosition, 4);
+         l > 0 && position + 4 <= index.size(); l--)
+    {
+        position += 4 + GetFixed(index, position, 4) + 4;
+
+        if (position + 16 > index.size())
+            break;
+
+        PutFixed(damaged, position, 0 - GetFixed(index, position + 8, 8));
+        position += 16;
+    }
+
+    damages.emplace_back("with its lists out of range", damaged);
+
+    for (auto& [damage, text] : damages)
+    {
+        if (!WriteFile(indexPath, text))
+        {
+            problem = "unable to write the damaged index";
+            return;
+        }
+
+        // The lines of the functions are only read for the scopes.
+        std::vector<SourceFile> sources(1);
+        sources[0].Open(path);
+        SearchEngine engine = Engine(fixture, threadCount, 0);
+        engine.SetUseIndex(true);
+        std::vector<ScopeTable> scopes;
+        engine.SetScopeTables(&scopes);
+        MatchTable matches;
+        engine.Search(sources, fixture.instructions, matches);
+        problem = CheckMatches(fixture, matches, 1, lineOffsets);
+
+        if (problem.empty())
+        {
+            problem = scopes.size() == 1 ? CheckScopes(fixture, scopes[0]) :
+                "the functions and sections weren't found";
+        }
+
+        if (!problem.empty())
+        {
+            problem += " (an index ";
+            problem += damage;
+            problem += ')';
+            return;
+        }
+    }
+}
+
+void FixtureCheck::CheckCompressed(
+    const Fixture& fixture, const std::vector<std::size_t>& lineOffsets,
+    std::string& problem) const
+{
+    const char* const searches[]{ "one file", "two files" };
+    const unsigned threadCounts[]{ 1, threadCount };
+    const std::size_t chunkSizes[]{ 0, 1, 64 };
+
+    for (const wxString& compressedPath : fixture.compressedPaths)
+    {
+        std::string compressed;
+
+        if (!ReadFile(compressedPath, compressed))
+        {
+            problem = "unable to read the compressed listing";
+            return;
+        }
+
+        // A build without the library for a format can't read its copy.
+        if (!Decompressor::IsSupported(Decompressor::Detect(
+                compressed.data(), compressed.size())))
+        {
+            continue;
+        }
+
+        std::string name{ wxFileName{ compressedPath }.GetFullName()
+                              .ToUTF8() };
+
+        for (unsigned threads : threadCounts)
+        {
+            for (std::size_t chunkSize : chunkSizes)
+            {
+                for (int search = 0; search < 2 && problem.empty(); search++)
+                {
+                    std::vector<SourceFile> sources(search + 1);
+
+                    for (SourceFile& source : sources)
+                        source.Open(compressedPath);
+
+                    SearchEngine engine = Engine(fixture, threads, chunkSize);
+                    MatchTable matches;
+
+                    if (search == 0)
+                        engine.Search(sources[0], fixture.instructions,
+                                      matches);
+                    else
+                        engine.Search(sources, fixture.instructions, matches);
+
+                    for (const SourceFile& source : sources)
+                    {
+                        if (!source.IsCompressed() || source.HasReadError() ||
+                            std::string_view(source.Data(), source.Size()) !=
+                                fixture.text)
+                        {
+                            problem = name + " isn't read as the listing";
+                        }
+                    }
+
+                    if (problem.empty())
+                    {
+                        problem = CheckMatches(fixture, matches,
+                                               sources.size(), lineOffsets);
+                    }
+
+                    if (!problem.empty())
+                    {
+                        problem += Describe(threads, chunkSize,
+                                            name + ", " + searches[search]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void FixtureCheck::CheckUpdates(const Fixture& fixture,
+                                const std::string& text,
+                                const std::vector<std::size_t>& lineOffsets,
+                                bool everyLine, std::string& problem) const
+{
+    // The file is read the way the GUI reads a watched file, and a copy of
+    // it mapped before watching started is detached from the file.
+    wxString path = wxFileName::CreateTempFileName("AsmFinderBench");
+    SourceFile oldSource;
+    SourceFile detachedSource;
+
+    if (!WriteFile(path, text) || !oldSource.Open(path, false) ||
+        !detachedSource.Open(path))
+    {
+        problem = "unable to write the text to update";
+        wxRemoveFile(path);
+        return;
+    }
+
+    detachedSource.Detach();
+
+    SearchEngine engine = Engine(fixture, threadCount, 64);
+    MatchTable oldMatches;
+    engine.Search(oldSource, fixture.instructions, oldMatches);
+
+    FileSignature before;
+    before.Compute(oldSource.Data(), oldSource.Size(), engine.ThreadCount());
+
+    std::vector<std::size_t> lines;
+
+    for (std::size_t i = 0; i < lineOffsets.size(); i++)
+    {
+        if (everyLine || i == 0 || i == lineOffsets.size() / 2 ||
+            i + 1 == lineOffsets.size())
+        {
+            lines.push_back(i);
+        }
+    }
+
+    const char* const edits[]{ "deleting", "repeating", "replacing" };
+
+    for (std::size_t i : lines)
+    {
+        std::size_t begin = lineOffsets[i];
+        std::size_t end = i + 1 < lineOffsets.size() ?
+            lineOffsets[i + 1] : text.size();
+
+        for (int edit = 0; edit < 3 && problem.empty(); edit++)
+        {
+            std::string newText{ text };
+
+            if (edit == 0)
+                newText.erase(begin, end - begin);
+            else if (edit == 1)
+                newText.insert(begin, text, begin, end - begin);
+            else
+                newText.replace(begin, end - begin, "\tnop\n");
+
+            // Builds often truncate the file before writing it again, which
+            // the lines of the results shown until the update is done must
+            // not see.
+            if (!WriteFile(path, std::string{}))
+            {
+                problem = "unable to truncate the watched file";
+                break;
+            }
+
+            for (const SourceFile* source : { &oldSource, &detachedSource })
+            {
+                if (problem.empty())
+                    problem = CheckLines(*source, text, lineOffsets,
+                                         oldMatches);
+            }
+
+            SourceFile newSource;
+
+            if (problem.empty() &&
+                (!WriteFile(path, newText) || !newSource.Open(path, false)))
+            {
+                problem = "unable to write the updated text";
+            }
+
+            if (!problem.empty())
+            {
+                problem += " (after truncating the watched file)";
+                break;
+            }
+
+            // The matches are updated the same way MainWindow does when the
+            // watched file changes.
+            FileSignature after;
+            after.Compute(newSource.Data(), newSource.Size(),
+                          engine.ThreadCount());
+
+            FileChange change;
+            MatchTable updated{ oldMatches };
+
+            if (before.Compare(after, newSource.Data(), change))
+            {
+                MatchTable rows;
+                engine.Search(newSource, change.begin, change.newEnd,
+                              change.firstLine, fixture.instructions, rows);
+
+                Span<std::uint64_t> offsets = updated.Offsets();
+                std::size_t first = std::lower_bound(
+                    offsets.begin(), offsets.end(), change.begin) -
+                    offsets.begin();
+                std::size_t last = std::lower_bound(
+                    offsets.begin(), offsets.end(), change.oldEnd) -
+                    offsets.begin();
+                updated.Splice(first, last, rows, change.lineShift,
+                               change.offsetShift);
+            }
+
+            MatchTable searched;
+            engine.Search(newSource, fixture.instructions, searched);
+            bool same = Rows(updated) == Rows(searched);
+
+            for (std::size_t n = 0; n < fixture.instructions.size(); n++)
+                same = same && updated.Count(n) == searched.Count(n);
+
+            if (!same)
+            {
+                problem = "updating the matches after " +
+                    std::string{ edits[edit] } + " line " +
+                    std::to_string(i + 1) + " of " +
+                    std::to_string(text.size()) + " bytes doesn't find " +
+                    "what searching again does";
+            }
+        }
+    }
+
+    oldSource.Close();
+    detachedSource.Close();
+    wxRemoveFile(path);
+}
+
+std::string FixtureCheck::CheckLines(
+    const SourceFile& source, const std::string& text,
+    const std::vector<std::size_t>& lineOffsets, const MatchTable& matches)
+{
+    // The result list shows each matching line, and the preview steps to
+    // the lines around it.
+    for (std::size_t row = 0; row < matches.Size(); row++)
+    {
+        std::uint32_t line = matches.LineNumber(row);
+        std::uint64_t offset = matches.Offset(row);
+        std::size_t lineEnd = std::min(text.find_first_of("\r\n", offset),
+                                       text.size());
+        std::string_view expected{ text.data() + offset, lineEnd - offset };
+        std::uint64_t next = line < lineOffsets.size() ?
+            lineOffsets[line] : text.size();
+        std::uint64_t previous = line > 1 ? lineOffsets[line - 2] : 0;
+
+        if (source.LineAt(offset) != expected ||
+            source.LineAfter(offset) != next ||
+            source.LineBefore(offset) != previous)
+        {
+            return "line " + std::to_string(line) + " of the results "
+                "changed with the file";
+        }
+    }
+
+    return {};
+}
+
+void FixtureCheck::CheckResults(const Fixture& fixture, const wxString& path,
+                                std::string& problem) const
+{
+    if (fixture.results.empty())
+        return;
+
+    SourceFile source;
+    source.Open(path);
+    SearchEngine engine = Engine(fixture, threadCount, 0);
+    MatchTable matches;
+    engine.Search(source, fixture.instructions, matches);
+
+    // A small buffer is written many times over, which splits the text of
+    // lines and escapes between writes.
+    wxString resultPath = wxFileName::CreateTempFileName("AsmFinderBench");
+    const std::size_t bufferSizes[]{ 1 << 20, 16 };
+
+    for (auto& [format, expected] : fixture.results)
+    {
+        for (std::size_t bufferSize : bufferSizes)
+        {
+            for (bool background : { false, true })
+            {
+                ResultWriter writer{ format };
+                writer.SetBufferSize(bufferSize);
+                writer.SetBackground(background);
+                std::string written;
+
+                if (!writer.Write(resultPath, Span<SourceFile>{ &source, 1 },
+                                  Span<wxString>{ &fixture.name, 1 },
+                                  fixture.instructions, matches) ||
+                    !ReadFile(resultPath, written))
+                {
+                    problem = "unable to save the results";
+                }
+                else if (written != expected)
+                {
+                    std::size_t position = std::mismatch(
+                        written.begin(),
+                        written.begin() + std::min(written.size(),
+                                                   expected.size()),
+                        expected.begin()).first - written.begin();
+                    problem = "the results saved as " +
+                        std::string{ ResultWriter::FormatName(format) } +
+                        " differ from the expected ones at byte " +
+                        std::to_string(position);
+                }
+
+                if (!problem.empty())
+                {
+                    problem += " (a buffer of " + std::to_string(bufferSize) +
+                        " bytes" + (background ? " written in the background"
+                                               : "") + ')';
+                    wxRemoveFile(resultPath);
+                    return;
+                }
+            }
+        }
+    }
+
+    wxRemoveFile(resultPath);
+}
+
+void FixtureCheck::CheckComparison(const Fixture& fixture,
+                                   const wxString& path,
+                                   std::string& problem) const
+{
+    if (!fixture.hasBaseline)
+        return;
+
+    wxString baselinePath = wxFileName::CreateTempFileName("AsmFinderBench");
+
+    if (!WriteFile(baselinePath, fixture.baselineText))
+    {
+        problem = "unable to write the baseline";
+        wxRemoveFile(baselinePath);
+        return;
+    }
+
+    auto join = [](const std::vector<std::string>& rows) {
+        std::string text;
+
+        for (const std::string& row : rows)
+            text += (text.empty() ? "" : ", ") + row;
+
+        return text;
+    };
+
+    const char* const searches[]{ "two files", "index" };
+    const unsigned threadCounts[]{ 1, threadCount };
+    const std::size_t chunkSizes[]{ 0, 1 };
+
+    for (unsigned threads : threadCounts)
+    {
+        for (std::size_t chunkSize : chunkSizes)
+        {
+            for (int search = 0; search < 2 && problem.empty(); search++)
+            {
+                // Both builds are searched at once, as BatchSearch::Compare
+                // and the GUI do.
+                std::vector<SourceFile> sources(2);
+                sources[0].Open(baselinePath);
+                sources[1].Open(path);
+
+                SearchEngine engine = Engine(fixture, threads, chunkSize);
+                engine.SetUseIndex(search == 1);
+                std::vector<ScopeTable> scopes;
+                engine.SetScopeTables(&scopes);
+                MatchTable matches;
+                engine.Search(sources, fixture.instructions, matches);
+
+                UsageComparison comparison;
+                comparison.Compare(matches, fixture.instructions.size(),
+                                   scopes[0], scopes[1]);
+                std::vector<std::string> changes;
+
+                auto add = [&](const std::string& function,
+                               const UsageComparison::Row& row) {
+                    changes.push_back(std::to_string(row.instruction) + ' ' +
+                                      std::to_string(row.baseline) + ' ' +
+                                      std::to_string(row.current) + ' ' +
+                                      function);
+                };
+
+                for (const UsageComparison::Row& row : comparison.Totals())
+                    add("*", row);
+
+                for (const UsageComparison::Row& row : comparison.Functions())
+                    add(comparison.FunctionName(row.function), row);
+
+                if (changes != fixture.changes)
+                {
+                    problem = "expected the changes \"" +
+                        join(fixture.changes) + "\" but found \"" +
+                        join(changes) + '"' +
+                        Describe(threads, chunkSize, searches[search]);
+                }
+            }
+        }
+    }
+
+    wxRemoveFile(TokenIndex::PathFor(baselinePath));
+    wxRemoveFile(baselinePath);
+}
+
+SearchEngine FixtureCheck::Engine(const Fixture& fixture, unsigned threads,
+                                  std::size_t chunkSize)
+{
+    SearchEngine engine;
+    engine.SetThreadCount(threads);
+    engine.SetChunkSize(chunkSize);
+    engine.SetDialect(fixture.dialect);
+    return engine;
+}
+
+std::string FixtureCheck::CheckMatches(
+    const Fixture& fixture, const MatchTable& matches, std::size_t fileCount,
+    const std::vector<std::size_t>& lineOffsets)
+{
+    std::size_t total{ 0 };
+
+    for (std::size_t i = 0; i < fixture.instructions.size(); i++)
+        total += matches.Count(i);
+
+    for (std::uint32_t f = 0; f < fileCount; f++)
+    {
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> found;
+
+        for (std::size_t row = 0; row < matches.Size(); row++)
+        {
+            if (matches.FileId(row) == f)
+            {
+                found.emplace_back(matches.LineNumber(row),
+                                   matches.InstructionId(row));
+            }
+        }
+
+        if (found != fixture.expected)
+        {
+            return "expected \"" + Format(fixture.expected) +
+                "\" but found \"" + Format(found) + '"';
+        }
+    }
+
+    for (std::size_t row = 0; row < matches.Size(); row++)
+    {
+        std::uint32_t line = matches.LineNumber(row);
+
+        if (line == 0 || line > lineOffsets.size() ||
+            matches.Offset(row) != lineOffsets[line - 1])
+        {
+            return "the offset of line " + std::to_string(line) +
+                " is wrong";
+        }
+    }
+
+    if (total != matches.Size())
+        return "the counts don't add up to the matches";
+
+    return {};
+}
+
+std::string FixtureCheck::CheckScopes(const Fixture& fixture,
+                                      const ScopeTable& scopes)
+{
+    if (!fixture.hasScopes)
+        return {};
+
+    for (ScopeTable::Kind kind : { ScopeTable::Kind::Function,
+                                   ScopeTable::Kind::Section })
+    {
+        const ScopeList& expected = kind == ScopeTable::Kind::Function ?
+            fixture.functions : fixture.sections;
+        ScopeList found;
+
+        for (std::size_t i = 0; i < scopes.Size(kind); i++)
+        {
+            found.emplace_back(scopes.FirstLine(kind, i),
+                               scopes.Name(kind, i));
+        }
+
+        if (found != expected)
+        {
+            return std::string{ kind == ScopeTable::Kind::Function ?
+                                "functions" : "sections" } +
+                " expected \"" + Format(expected) + "\" but found \"" +
+                Format(found) + '"';
+        }
+    }
+
+    return {};
+}
+
+std::string FixtureCheck::Format(
+    const std::vector<std::pair<std::uint32_t, std::uint32_t>>& matches)
+{
+    std::string text;
+
+    for (auto& match : matches)
+    {
+        if (!text.empty())
+            text += ' ';
+
+        text += std::to_string(match.first);
+        text += ':';
+        text += std::to_string(match.second);
+    }
+
+    return text;
+}
+
+std::string FixtureCheck::Format(const ScopeList& scopes)
+{
+    std::string text;
+
+    for (auto& scope : scopes)
+    {
+        if (!text.empty())
+            text += ", ";
+
+        text += std::to_string(scope.first);
+        text += ' ';
+        text += scope.second;
+    }
+
+    return text;
+}
+
+std::string FixtureCheck::Describe(unsigned threads, std::size_t chunkSize,
+                                   const std::string& search)
+{
+    std::string text{ " (" + std::to_string(threads) + " threads, " };
+
+    if (chunkSize == 0)
+        text += "chunks sized to the text, ";
+    else
+        text += "chunks of " + std::to_string(chunkSize) + " bytes, ";
+
+    return text + search + ')';
+}
@@ -0,0 +1,261 @@
+// FixtureCheck.h - Declares the FixtureCheck class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FIXTURE_CHECK_H
+#define FIXTURE_CHECK_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+#include <wx/string.h>
+#include "Dialect.h"
+#include "Instruction.h"
+#include "MatchTable.h"
+#include "ResultWriter.h"
+#include "ScopeTable.h"
+#include "SearchEngine.h"
+#include "SourceFile.h"
+
+/// @brief Checks the search core against listings whose results are known,
+/// so a change that quietly changes what is found fails at once.
+///
+/// Each fixture is a listing, such as Crlf.s, next to a file of the same
+/// name ending in .expected that gives the dialect, the instructions and
+/// every match the search must find. Lines of the .expected file are
+/// "dialect name", "instruction definition" in the format of an instruction
+/// list, and "match line position" for each match in row order, where
+/// position is the position of the instruction. Lines starting with # are
+/// comments. These lines are optional:
+///
+/// - "function line name" and "section line name" give every function and
+///   section in the listing, which each search must find the same.
+/// - "baseline file" names an earlier build of the listing in the same
+///   directory, and "change position baseline current function" gives each
+///   row the comparison of the two builds must have, in order. The function
+///   of the totals is *.
+///
+/// Every fixture is searched on one and several threads, in chunks sized to
+/// the text and in chunks of a few bytes, as a single file, as two files at
+/// once and through a newly built, a loaded and a damaged index, in the C
+/// locale and in a UTF-8 one, and each search must find the same matches.
+/// The first token Line finds on each line must also be the one LineScanner
+/// finds. Every line is deleted, repeated and replaced in turn, and updating
+/// the matches the way the GUI does when a watched file changes must give
+/// the same matches as searching the new text.
+///
+/// Files next to the listing are checked too when they exist. Copies
+/// compressed with gzip, zstd or xz, such as Crlf.s.gz, must give the same
+/// text and matches, unless the format isn't supported by the build. Files
+/// such as Crlf.result.csv give the results saved in each format.
+class FixtureCheck
+{
+public:
+    /// @brief Sets how many threads the searches use besides one.
+    /// @param count The number of threads. Zero uses one per hardware
+    /// thread.
+    void SetThreadCount(unsigned count) { threadCount = count; }
+
+    /// @brief Checks every fixture in a directory and prints the outcome of
+    /// each one.
+    /// @param directory The directory with the fixtures.
+    /// @param output The stream to print the outcomes to.
+    /// @return True if there were fixtures and every one passed, otherwise
+    /// false.
+    bool Run(const wxString& directory, std::FILE* output) const;
+private:
+    /// @brief The lines of the listing that start functions or sections,
+    /// with their names.
+    using ScopeList = std::vector<std::pair<std::uint32_t, std::string>>;
+
+    /// @brief A listing and what searching it must find.
+    struct Fixture
+    {
+        /// @brief The file name of the listing, which results are saved
+        /// under.
+        wxString name;
+
+        std::string text;
+        Dialect dialect;
+        std::vector<Instruction> instructions;
+
+        /// @brief The line and the position of the instruction of every
+        /// match, in row order.
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> expected;
+
+        /// @brief Whether the functions and sections are given.
+        bool hasScopes{ false };
+
+        ScopeList functions;
+        ScopeList sections;
+
+        /// @brief Whether the listing is compared with an earlier build.
+        bool hasBaseline{ false };
+
+        /// @brief The text of the earlier build.
+        std::string baselineText;
+
+        /// @brief The rows the comparison must have, as in the .expected
+        /// file.
+        std::vector<std::string> changes;
+
+        /// @brief The paths of the compressed copies of the listing.
+        std::vector<wxString> compressedPaths;
+
+        /// @brief The text of the results saved in each format that has a
+        /// file of them.
+        std::vector<std::pair<ResultWriter::Format, std::string>> results;
+    };
+
+    unsigned threadCount{ 0 };
+
+    /// @brief Reads a fixture.
+    /// @param base The path of the listing without its extension.
+    /// @param fixture Receives the fixture.
+    /// @param problem Receives what went wrong.
+    /// @return True if the fixture was read, otherwise false.
+    static bool Read(const wxString& base, Fixture& fixture,
+                     std::string& problem);
+
+    /// @brief Checks a single fixture.
+    /// @param fixture The fixture.
+    /// @param problem Receives what went wrong.
+    /// @return True if the fixture passed, otherwise false.
+    bool Check(const Fixture& fixture, std::string& problem) const;
+
+    /// @brief Searches the listing every way it can be searched.
+    /// @param fixture The fixture.
+    /// @param path The path the listing was written to.
+    /// @param lineOffsets The offset of each line of the listing.
+    /// @param problem Receives what went wrong.
+    void CheckSearches(const Fixture& fixture, const wxString& path,
+                       const std::vector<std::size_t>& lineOffsets,
+                       std::string& problem) const;
+
+    /// @brief Damages the index of the listing in several ways and searches
+    /// through each one, which must find the same matches as the listing.
+    /// @param fixture The fixture.
+    /// @param path The path the listing was written to, whose index has
+    /// been saved.
+    /// @param lineOffsets The offset of each line of the listing.
+    /// @param problem Receives what went wrong.
+    void CheckDamagedIndex(const Fixture& fixture, const wxString& path,
+                           const std::vector<std::size_t>& lineOffsets,
+                           std::string& problem) const;
+
+    /// @brief Searches the compressed copies of the listing.
+    /// @param fixture The fixture.
+    /// @param lineOffsets The offset of each line of the listing.
+    /// @param problem Receives what went wrong.
+    void CheckCompressed(const Fixture& fixture,
+                         const std::vector<std::size_t>& lineOffsets,
+                         std::string& problem) const;
+
+    /// @brief Changes the text one line at a time and updates the matches
+    /// the way the GUI does when a watched file changes. The file is
+    /// truncated before each change is written, and the lines of the old
+    /// matches must still read the same.
+    /// @param fixture The fixture.
+    /// @param text The text to change, which is the listing or several
+    /// copies of it.
+    /// @param lineOffsets The offset of each line of the text.
+    /// @param everyLine True to change every line, or false to only change
+    /// the first, the middle and the last one.
+    /// @param problem Receives what went wrong.
+    void CheckUpdates(const Fixture& fixture, const std::string& text,
+                      const std::vector<std::size_t>& lineOffsets,
+                      bool everyLine, std::string& problem) const;
+
+    /// @brief Saves the matches in each format that has a file of results
+    /// and compares what was saved with it.
+    /// @param fixture The fixture.
+    /// @param path The path the listing was written to.
+    /// @param problem Receives what went wrong.
+    void CheckResults(const Fixture& fixture, const wxString& path,
+                      std::string& problem) const;
+
+    /// @brief Compares the listing with its earlier build.
+    /// @param fixture The fixture.
+    /// @param path The path the listing was written to.
+    /// @param problem Receives what went wrong.
+    void CheckComparison(const Fixture& fixture, const wxString& path,
+                         std::string& problem) const;
+
+    /// @brief Creates a search engine for a fixture.
+    /// @param fixture The fixture.
+    /// @param threads The number of threads to search with.
+    /// @param chunkSize The size of the chunks the text is split into, or
+    /// zero to size them to the text.
+    /// @return The search engine.
+    static SearchEngine Engine(const Fixture& fixture, unsigned threads,
+                               std::size_t chunkSize);
+
+    /// @brief Checks that every file of a search found the expected
+    /// matches on the right lines.
+    /// @param fixture The fixture.
+    /// @param matches The matches of the search.
+    /// @param fileCount The number of copies of the listing searched.
+    /// @param lineOffsets The offset of each line of the listing.
+    /// @return What went wrong, or an empty string if nothing did.
+    static std::string CheckMatches(
+        const Fixture& fixture, const MatchTable& matches,
+        std::size_t fileCount, const std::vector<std::size_t>& lineOffsets);
+
+    /// @brief Checks that the lines of matches read the same as in the text
+    /// that was searched, as the result list and the preview read them.
+    /// @param source The file that was searched.
+    /// @param text The text that was searched.
+    /// @param lineOffsets The offset of each line of the text.
+    /// @param matches The matches of the search.
+    /// @return What went wrong, or an empty string if nothing did.
+    static std::string CheckLines(const SourceFile& source,
+                                  const std::string& text,
+                                  const std::vector<std::size_t>& lineOffsets,
+                                  const MatchTable& matches);
+
+    /// @brief Checks that a search found the functions and sections of the
+    /// listing.
+    /// @param fixture The fixture.
+    /// @param scopes The functions and sections found.
+    /// @return What went wrong, or an empty string if nothing did.
+    static std::string CheckScopes(const Fixture& fixture,
+                                   const ScopeTable& scopes);
+
+    /// @brief Formats matches the way the .expected files give them.
+    /// @param matches The line and the position of the instruction of each
+    /// match.
+    /// @return The matches as "line:position" separated by blanks.
+    static std::string Format(
+        const std::vector<std::pair<std::uint32_t, std::uint32_t>>& matches);
+
+    /// @brief Formats functions or sections the way the .expected files
+    /// give them.
+    /// @param scopes The line and the name of each scope.
+    /// @return The scopes as "line name" separated by commas.
+    static std::string Format(const ScopeList& scopes);
+
+    /// @brief Describes how a search was made, for the outcome of a check.
+    /// @param threads The number of threads.
+    /// @param chunkSize The size of the chunks, or zero if they were sized
+    /// to the text.
+    /// @param search How the files were searched.
+    /// @return The description in parentheses after a space.
+    static std::string Describe(unsigned threads, std::size_t chunkSize,
+                                const std::string& search);
+};
+
+#endif
@@ -0,0 +1,166 @@
+// KernelBenchmark.cpp - Defines the KernelBenchmark class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "KernelBenchmark.h"
+
+#include <chrono>
+#include <string_view>
+#include "Line.h"
+#include "LineScanner.h"
+
+namespace
+{
+    constexpr std::uint64_t offsetBasis{ 14695981039346656037ULL };
+    constexpr std::uint64_t prime{ 1099511628211ULL };
+
+    /// @brief Adds a token to a running hash of all the tokens in the text.
+    /// @param hash The hash of the tokens before this one.
+    /// @param token The token to add, which is folded to lowercase.
+    /// @return The hash of all the tokens including this one.
+    std::uint64_t HashToken(std::uint64_t hash, std::string_view token)
+    {
+        for (char c : token)
+        {
+            if (c >= 'A' && c <= 'Z')
+                c = static_cast<char>(c - 'A' + 'a');
+
+            hash ^= static_cast<unsigned char>(c);
+            hash *= prime;
+        }
+
+        // Mark the end of each token so moving a byte from one token to the
+        // next changes the hash.
+        hash ^= 0xFF;
+        hash *= prime;
+        return hash;
+    }
+
+    double Seconds(std::chrono::steady_clock::time_point start)
+    {
+        std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+}
+
+bool KernelBenchmark::Run(std::FILE* output) const
+{
+    std::fprintf(output, "Scanning %.1f MiB %d times per kernel\n",
+                 text.size() / 1048576.0, repeatCount);
+
+    bool succeeded{ true };
+    Result expected = Scan(*LineKernel::Get(LineKernel::Kind::Scalar));
+
+    for (auto kind : { LineKernel::Kind::Scalar, LineKernel::Kind::Sse2,
+                       LineKernel::Kind::Avx2 })
+    {
+        const LineKernel* kernel = LineKernel::Get(kind);
+
+        if (kernel == nullptr)
+        {
+            std::fprintf(output, "%-8s not supported\n",
+                         kind == LineKernel::Kind::Sse2 ? "SSE2" : "AVX2");
+            continue;
+        }
+
+        Result result = Scan(*kernel);
+        Print(output, kernel->Name(), result);
+
+        if (result.lineCount != expected.lineCount ||
+            result.tokenHash != expected.tokenHash)
+        {
+            std::fprintf(output, "%-8s found different tokens\n",
+                         kernel->Name());
+            succeeded = false;
+        }
+    }
+
+    if (compareLine)
+    {
+        Result result = ScanLines();
+        Print(output, "Line", result);
+
+        if (result.lineCount != expected.lineCount ||
+            result.tokenHash != expected.tokenHash)
+        {
+            std::fputs("Line     found different tokens\n", output);
+            succeeded = false;
+        }
+    }
+
+    return succeeded;
+}
+
+KernelBenchmark::Result KernelBenchmark::Scan(const LineKernel& kernel) const
+{
+    Result best;
+
+    for (int run = 0; run < repeatCount; run++)
+    {
+        Result result;
+        result.tokenHash = offsetBasis;
+        auto start = std::chrono::steady_clock::now();
+        LineScanner scanner{ text.data(), text.size(), kernel };
+
+        while (scanner.Next())
+            result.tokenHash = HashToken(result.tokenHash, scanner.FirstToken());
+
+        result.seconds = Seconds(start);
+        result.lineCount = static_cast<std::uint64_t>(scanner.Number());
+
+        if (run == 0 || result.seconds < best.seconds)
+            best = result;
+    }
+
+    return best;
+}
+
+KernelBenchmark::Result KernelBenchmark::ScanLines() const
+{
+    // Line is slow enough that a single run is plenty. The lines are split
+    // with the scalar kernel so only the tokenizing differs.
+    Result result;
+    result.tokenHash = offsetBasis;
+    auto start = std::chrono::steady_clock::now();
+    LineScanner scanner{ text.data(), text.size(),
+                         *LineKernel::Get(LineKernel::Kind::Scalar) };
+
+    while (scanner.Next())
+    {
+        std::string_view lineText = scanner.Text();
+        Line line{ scanner.Number(),
+                   wxString::FromUTF8(lineText.data(), lineText.size()) };
+        wxScopedCharBuffer token = line.FirstToken().ToUTF8();
+        result.tokenHash = HashToken(result.tokenHash,
+                                     std::string_view{ token.data(),
+                                                       token.length() });
+    }
+
+    result.seconds = Seconds(start);
+    result.lineCount = static_cast<std::uint64_t>(scanner.Number());
+    return result;
+}
+
+void KernelBenchmark::Print(std::FILE* output, const char* name,
+                            const Result& result) const
+{
+    double gigabytes = text.size() / 1e9;
+
+    std::fprintf(output, "%-8s %8.3f s %8.2f GB/s %8.3f s/GB %12.0f lines/s\n",
+                 name, result.seconds, gigabytes / result.seconds,
+                 result.seconds / gigabytes,
+                 result.lineCount / result.seconds);
+}
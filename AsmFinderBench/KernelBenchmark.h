@@ -0,0 +1,76 @@
+// KernelBenchmark.h - Declares the KernelBenchmark class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef KERNEL_BENCHMARK_H
+#define KERNEL_BENCHMARK_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "LineKernel.h"
+
+/// @brief Measures how fast each LineKernel splits text into lines and
+/// finds their first tokens.
+class KernelBenchmark
+{
+public:
+    /// @brief Constructor; creates a new instance of KernelBenchmark.
+    /// @param text The text to scan.
+    explicit KernelBenchmark(std::string text) : text{ std::move(text) } {}
+
+    /// @brief Sets how many times each kernel scans the text.
+    /// @param count The number of runs. The fastest one is reported.
+    void SetRepeatCount(int count) { repeatCount = count; }
+
+    /// @brief Sets whether the text is also scanned the way Line does it.
+    /// @param enabled True to measure Line and check its tokens match.
+    void SetCompareLine(bool enabled) { compareLine = enabled; }
+
+    /// @brief Scans the text with every kernel the processor supports and
+    /// prints the throughput of each one.
+    /// @param output The stream to print the results to.
+    /// @return True if every kernel found the same tokens, otherwise false.
+    bool Run(std::FILE* output) const;
+private:
+    /// @brief The outcome of scanning the text once.
+    struct Result
+    {
+        double seconds{ 0 };
+        std::uint64_t lineCount{ 0 };
+        std::uint64_t tokenHash{ 0 };
+    };
+
+    std::string text;
+    int repeatCount{ 5 };
+    bool compareLine{ true };
+
+    /// @brief Scans the text with a kernel.
+    /// @param kernel The kernel to scan with.
+    /// @return The time it took and a hash of the tokens it found.
+    Result Scan(const LineKernel& kernel) const;
+
+    /// @brief Scans the text by constructing a Line for each line.
+    /// @return The time it took and a hash of the tokens it found.
+    Result ScanLines() const;
+
+    /// @brief Prints the result of a scan.
+    /// @param output The stream to print to.
+    /// @param name The name of what was measured.
+    /// @param result The fastest run.
+    void Print(std::FILE* output, const char* name, const Result& result) const;
+};
+
+#endif
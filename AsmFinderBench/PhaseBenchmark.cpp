@@ -0,0 +1,283 @@
+// PhaseBenchmark.cpp - Defines the PhaseBenchmark class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "PhaseBenchmark.h"
+
+#include <chrono>
+#include <string>
+#include <wx/ffile.h>
+#include <wx/filename.h>
+#include "LineScanner.h"
+#include "MatchTable.h"
+#include "ResultWriter.h"
+#include "SearchEngine.h"
+#include "SourceFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+    /// @brief Runs part of the benchmark several times and times it.
+    /// @param repeatCount The number of times to run it.
+    /// @param prepare Called before each run without being timed.
+    /// @param body The part to time, which returns false if it failed.
+    /// @return The time of the fastest run in seconds, or a negative number
+    /// if a run failed.
+    template <typename Prepare, typename Body>
+    double TimeFastest(int repeatCount, Prepare prepare, Body body)
+    {
+        double fastest{ -1 };
+
+        for (int run = 0; run < repeatCount; run++)
+        {
+            prepare();
+            auto start = std::chrono::steady_clock::now();
+
+            if (!body())
+                return -1;
+
+            std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+
+            if (fastest < 0 || elapsed.count() < fastest)
+                fastest = elapsed.count();
+        }
+
+        return fastest;
+    }
+
+    // Results are added up here so the compiler can't skip the work that
+    // produces them.
+    volatile std::size_t sink;
+}
+
+void PhaseBenchmark::PrintCsvHeader(std::FILE* output)
+{
+    std::fputs("file,phase,seconds,bytes_per_second,lines_per_second,"
+               "peak_memory_bytes\n", output);
+}
+
+bool PhaseBenchmark::Run(const wxString& name, const wxString& path,
+                         std::FILE* output) const
+{
+    auto nothing = []() {};
+    std::vector<Phase> phases;
+    SourceFile source;
+    MatchTable matches;
+    std::uint64_t lineCount{ 0 };
+
+    // Mapping the file is nearly free, so the load phase also touches every
+    // page. That is the cost the first scan of the file would pay.
+    double seconds = TimeFastest(repeatCount, nothing, [&]() {
+        if (!source.Open(path))
+            return false;
+
+        std::size_t sum{ 0 };
+
+        for (std::size_t i = 0; i < source.Size(); i += 4096)
+            sum += static_cast<unsigned char>(source.Data()[i]);
+
+        sink = sum;
+        return true;
+    });
+
+    if (seconds < 0)
+    {
+        std::fprintf(stderr, "Unable to read %s\n",
+                     static_cast<const char*>(path.ToUTF8()));
+        return false;
+    }
+
+    phases.push_back(Phase{ "load", seconds, PeakMemory() });
+
+    seconds = TimeFastest(repeatCount, nothing, [&]() {
+        LineScanner scanner{ source.Data(), source.Size() };
+        std::size_t sum{ 0 };
+
+        while (scanner.Next())
+            sum += scanner.FirstToken().size();
+
+        sink = sum;
+        lineCount = static_cast<std::uint64_t>(scanner.Number());
+        return true;
+    });
+    phases.push_back(Phase{ "tokenize", seconds, PeakMemory() });
+
+    SearchEngine engine;
+    engine.SetThreadCount(threadCount);
+    seconds = TimeFastest(repeatCount, nothing, [&]() {
+        engine.Search(source, instructions, matches);
+        return true;
+    });
+    phases.push_back(Phase{ "match", seconds, PeakMemory() });
+
+    // The matches are grouped by instruction the first time they are shown,
+    // so each run starts from a copy that hasn't been grouped yet.
+    MatchTable ungrouped;
+    seconds = TimeFastest(repeatCount, [&]() {
+        ungrouped.Reset(instructions.size());
+        ungrouped.Append(matches);
+    }, [&]() {
+        std::size_t sum{ 0 };
+
+        for (std::size_t i = 0; i < instructions.size(); i++)
+        {
+            for (auto row : ungrouped.Rows(i))
+                sum += source.LineText(ungrouped.Offset(row)).length();
+        }
+
+        sink = sum;
+        return true;
+    });
+    phases.push_back(Phase{ "materialize", seconds, PeakMemory() });
+
+    // Grouping the matches was measured with the materialize phase, so it
+    // is done before the save phase is timed.
+    auto group = [&]() {
+        if (!instructions.empty())
+            matches.Rows(0);
+    };
+
+    wxString savePath = wxFileName::CreateTempFileName("AsmFinderBench");
+    ResultWriter writer;
+    seconds = TimeFastest(repeatCount, group, [&]() {
+        return writer.Write(savePath, Span<SourceFile>{ &source, 1 },
+                            Span<wxString>{ &path, 1 }, instructions, matches);
+    });
+    wxRemoveFile(savePath);
+
+    if (seconds < 0)
+    {
+        std::fputs("Unable to save the results\n", stderr);
+        return false;
+    }
+
+    phases.push_back(Phase{ "save", seconds, PeakMemory() });
+
+    Phase total{ "total", 0, PeakMemory() };
+
+    for (auto& phase : phases)
+        total.seconds += phase.seconds;
+
+    phases.push_back(total);
+
+    if (!csv)
+    {
+        std::fprintf(output, "%s: %.1f MiB, %llu lines, %zu instructions, "
+                     "%zu matches\n", static_cast<const char*>(name.ToUTF8()),
+                     source.Size() / 1048576.0,
+                     static_cast<unsigned long long>(lineCount),
+                     instructions.size(), matches.Size());
+        std::fprintf(output, "  %-12s %10s %12s %14s %12s\n", "phase",
+                     "seconds", "MB/s", "lines/s", "peak MiB");
+    }
+
+    for (auto& phase : phases)
+        Print(output, name, phase, source.Size(), lineCount);
+
+    // Every phase is compared so that each regression is reported.
+    bool succeeded{ true };
+
+    for (auto& phase : phases)
+    {
+        if (!CheckBaseline(name, phase, lineCount))
+            succeeded = false;
+    }
+
+    return succeeded;
+}
+
+std::size_t PhaseBenchmark::PeakMemory()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                              sizeof(counters)))
+    {
+        return 0;
+    }
+
+    return counters.PeakWorkingSetSize;
+#else
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+
+    // Linux reports the size in kilobytes and macOS in bytes.
+#ifdef __APPLE__
+    return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+void PhaseBenchmark::Print(std::FILE* output, const wxString& name,
+                           const Phase& phase, std::uint64_t bytes,
+                           std::uint64_t lines) const
+{
+    double bytesPerSecond = phase.seconds > 0 ? bytes / phase.seconds : 0;
+    double linesPerSecond = phase.seconds > 0 ? lines / phase.seconds : 0;
+
+    if (csv)
+    {
+        std::fprintf(output, "%s,%s,%.6f,%.0f,%.0f,%zu\n",
+                     static_cast<const char*>(name.ToUTF8()), phase.name,
+                     phase.seconds, bytesPerSecond, linesPerSecond,
+                     phase.peakMemory);
+        return;
+    }
+
+    std::fprintf(output, "  %-12s %10.4f %12.1f %14.0f %12.1f\n", phase.name,
+                 phase.seconds, bytesPerSecond / 1e6, linesPerSecond,
+                 phase.peakMemory / 1048576.0);
+}
+
+bool PhaseBenchmark::CheckBaseline(const wxString& name, const Phase& phase,
+                                   std::uint64_t lines) const
+{
+    double expected;
+
+    // Phases the baseline doesn't have, such as those of a file it didn't
+    // measure, aren't compared.
+    if (baseline == nullptr ||
+        !baseline->Find(std::string{ name.ToUTF8() }, phase.name, expected))
+    {
+        return true;
+    }
+
+    // A phase too quick for the clock to measure is never a regression.
+    if (phase.seconds <= 0)
+        return true;
+
+    double linesPerSecond = lines / phase.seconds;
+
+    if (linesPerSecond >= expected * (1 - margin / 100))
+        return true;
+
+    std::fprintf(stderr, "%s %s: %.0f lines/s is more than %g%% below the "
+                 "baseline of %.0f lines/s\n",
+                 static_cast<const char*>(name.ToUTF8()), phase.name,
+                 linesPerSecond, margin, expected);
+    return false;
+}
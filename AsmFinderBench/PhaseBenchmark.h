@@ -0,0 +1,121 @@
+// PhaseBenchmark.h - Declares the PhaseBenchmark class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PHASE_BENCHMARK_H
+#define PHASE_BENCHMARK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include <wx/string.h>
+#include "BenchmarkBaseline.h"
+#include "Instruction.h"
+
+/// @brief Times each phase of searching a file on its own.
+///
+/// The phases are loading the file, splitting it into lines and tokens,
+/// matching the tokens against the instructions, turning the matches into
+/// the text the GUI shows, and saving them. Each one is reported in bytes
+/// and lines per second along with the peak memory used so far.
+class PhaseBenchmark
+{
+public:
+    /// @brief Sets the instructions to search for.
+    /// @param list The instructions.
+    void SetInstructions(std::vector<Instruction> list)
+    {
+        instructions = std::move(list);
+    }
+
+    /// @brief Sets how many times each phase is run.
+    /// @param count The number of runs. The fastest one is reported.
+    void SetRepeatCount(int count) { repeatCount = count; }
+
+    /// @brief Sets how many threads the match phase uses.
+    /// @param count The number of threads. Zero uses one per hardware
+    /// thread.
+    void SetThreadCount(unsigned count) { threadCount = count; }
+
+    /// @brief Sets whether the results are printed as CSV.
+    /// @param enabled True to print CSV, otherwise a table is printed.
+    void SetCsv(bool enabled) { csv = enabled; }
+
+    /// @brief Sets the speeds each phase must keep up with.
+    /// @param speeds The results of an earlier run, or nullptr to not
+    /// compare. Must outlive the benchmark.
+    /// @param percent How far below its earlier speed a phase may fall
+    /// before it counts as a regression.
+    void SetBaseline(const BenchmarkBaseline* speeds, double percent)
+    {
+        baseline = speeds;
+        margin = percent;
+    }
+
+    /// @brief Prints the CSV column names.
+    /// @param output The stream to print to.
+    static void PrintCsvHeader(std::FILE* output);
+
+    /// @brief Runs every phase on a file and prints the results.
+    /// @param name The name to show for the file.
+    /// @param path The path of the file to search.
+    /// @param output The stream to print the results to.
+    /// @return True if the file was searched and no phase was slower than
+    /// the baseline allows, otherwise false.
+    bool Run(const wxString& name, const wxString& path,
+             std::FILE* output) const;
+private:
+    /// @brief The measurements of one phase.
+    struct Phase
+    {
+        const char* name;
+        double seconds;
+        std::size_t peakMemory;
+    };
+
+    std::vector<Instruction> instructions;
+    int repeatCount{ 3 };
+    unsigned threadCount{ 0 };
+    bool csv{ false };
+    const BenchmarkBaseline* baseline{ nullptr };
+    double margin{ 10 };
+
+    /// @brief Gets the most memory the process has had resident so far.
+    /// @return The peak resident set size in bytes, or zero if the platform
+    /// doesn't report it.
+    static std::size_t PeakMemory();
+
+    /// @brief Prints the measurements of a phase.
+    /// @param output The stream to print to.
+    /// @param name The name of the file.
+    /// @param phase The phase.
+    /// @param bytes The size of the file.
+    /// @param lines The number of lines in the file.
+    void Print(std::FILE* output, const wxString& name, const Phase& phase,
+               std::uint64_t bytes, std::uint64_t lines) const;
+
+    /// @brief Compares the speed of a phase with the baseline and prints
+    /// an error if it is too slow.
+    /// @param name The name of the file.
+    /// @param phase The phase.
+    /// @param lines The number of lines in the file.
+    /// @return False if the phase is slower than the baseline allows,
+    /// otherwise true.
+    bool CheckBaseline(const wxString& name, const Phase& phase,
+                       std::uint64_t lines) const;
+};
+
+#endif
@@ -0,0 +1,351 @@
+// AsmFinderCli.cpp - Defines the entry point of the command line program.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdio>
+#include <optional>
+#include <vector>
+#include <wx/cmdline.h>
+#include <wx/dir.h>
+#include <wx/filename.h>
+#include <wx/init.h>
+#include "BatchSearch.h"
+#include "Dialect.h"
+#include "FileFinder.h"
+#include "Instruction.h"
+#include "InstructionSet.h"
+#include "Pattern.h"
+#include "ResultWriter.h"
+#include "SearchStatistics.h"
+#include "Version.h"
+
+namespace
+{
+    enum ExitCode
+    {
+        Success = 0,
+        UsageError = 1,
+        SearchError = 2
+    };
+
+    const wxCmdLineEntryDesc commandLineDesc[] =
+    {
+        { wxCMD_LINE_SWITCH, "h", "help", "show this help",
+          wxCMD_LINE_VAL_NONE, wxCMD_LINE_OPTION_HELP },
+        { wxCMD_LINE_SWITCH, "v", "version", "show the program version" },
+        { wxCMD_LINE_SWITCH, "l", "lines",
+          "print each matching line as file:line:text" },
+        { wxCMD_LINE_OPTION, "o", "output",
+          "save each file's matching lines as an annotated .s file in dir",
+          wxCMD_LINE_VAL_STRING },
+        { wxCMD_LINE_OPTION, "f", "format",
+          "format of the files saved with --output: asm (the default), csv "
+          "or jsonl", wxCMD_LINE_VAL_STRING },
+        { wxCMD_LINE_SWITCH, "x", "index",
+          "search through an index saved next to each file, building it "
+          "when missing or out of date" },
+        { wxCMD_LINE_OPTION, "d", "dialect",
+          "how the instruction on each line is found: plain (the first "
+          "word, the default), gas, nasm or objdump", wxCMD_LINE_VAL_STRING },
+        { wxCMD_LINE_OPTION, "j", "jobs",
+          "number of threads to search with (default: one per CPU)",
+          wxCMD_LINE_VAL_NUMBER },
+        { wxCMD_LINE_OPTION, "i", "include",
+          "files to search in directories, separated by semicolons "
+          "(default: *.s;*.S;*.asm)", wxCMD_LINE_VAL_STRING },
+        { wxCMD_LINE_OPTION, "e", "exclude",
+          "files and directories to skip in directories, separated by "
+          "semicolons", wxCMD_LINE_VAL_STRING },
+        { wxCMD_LINE_OPTION, "c", "compare",
+          "compare how many times each instruction is found in the source "
+          "file, in total and in each function, with the baseline build at "
+          "path", wxCMD_LINE_VAL_STRING },
+        { wxCMD_LINE_OPTION, nullptr, "stats",
+          "save the time of each phase of the search and its counters as "
+          "JSON to path", wxCMD_LINE_VAL_STRING },
+        { wxCMD_LINE_OPTION, nullptr, "trace",
+          "save what each thread did during the search as a Chrome trace "
+          "to path", wxCMD_LINE_VAL_STRING },
+        { wxCMD_LINE_PARAM, nullptr, nullptr, "instruction-list",
+          wxCMD_LINE_VAL_STRING },
+        { wxCMD_LINE_PARAM, nullptr, nullptr, "source-file",
+          wxCMD_LINE_VAL_STRING, wxCMD_LINE_PARAM_MULTIPLE },
+        wxCMD_LINE_DESC_END
+    };
+
+    /// @brief Adds the files a command line argument names.
+    /// @param argument A path, a path with wildcards in its file name or a
+    /// directory.
+    /// @param finder Chooses the files to search in a directory.
+    /// @param paths Receives the matching paths, sorted by name.
+    /// @param names Receives the name each path's results are saved under:
+    /// its path relative to the directory argument, otherwise its file name.
+    void ExpandArgument(const wxString& argument, const FileFinder& finder,
+                        std::vector<wxString>& paths,
+                        std::vector<wxString>& names)
+    {
+        if (wxDirExists(argument))
+        {
+            std::size_t first = paths.size();
+            finder.Find(argument, paths);
+
+            for (std::size_t i = first; i < paths.size(); i++)
+            {
+                wxFileName name{ paths[i] };
+                name.MakeRelativeTo(argument);
+                names.push_back(name.GetFullPath());
+            }
+
+            return;
+        }
+
+        // Windows shells don't expand wildcards, so the program does it.
+        if (!wxIsWild(argument))
+        {
+            paths.push_back(argument);
+            names.push_back(wxFileName{ argument }.GetFullName());
+            return;
+        }
+
+        wxFileName pattern{ argument };
+        wxString directory = pattern.GetPath();
+
+        if (directory.empty())
+            directory = ".";
+
+        wxDir dir{ directory };
+        std::vector<wxString> found;
+        wxString name;
+
+        if (dir.IsOpened() &&
+            dir.GetFirst(&name, pattern.GetFullName(), wxDIR_FILES))
+        {
+            do
+            {
+                found.push_back(wxFileName{ directory, name }.GetFullPath());
+            } while (dir.GetNext(&name));
+        }
+
+        std::sort(found.begin(), found.end());
+        paths.insert(paths.end(), found.begin(), found.end());
+
+        for (const wxString& path : found)
+            names.push_back(wxFileName{ path }.GetFullName());
+    }
+}
+
+int main(int argc, char** argv)
+{
+    // This only initializes the non-GUI part of wxWidgets, so nothing needs
+    // a display and startup stays cheap.
+    wxInitializer initializer{ argc, argv };
+
+    if (!initializer.IsOk())
+    {
+        std::fputs("Unable to initialize wxWidgets\n", stderr);
+        return ExitCode::UsageError;
+    }
+
+    wxCmdLineParser parser{ commandLineDesc, argc, argv };
+    wxString logo{ PROGRAM_NAME };
+    logo << " - searches assembly language source files for instructions.\n";
+    logo << "Each line of the instruction list is in the form ";
+    logo << "instruction,description.\nThe instruction list can also be a ";
+    logo << "built-in instruction set:";
+
+    for (InstructionSet::Kind kind : InstructionSet::kinds)
+        logo << ' ' << InstructionSet{ kind }.Name();
+
+    parser.SetLogo(logo);
+
+    // The version switch is checked before parsing so it works without the
+    // parameters that are otherwise required.
+    for (int i = 1; i < argc; i++)
+    {
+        wxString argument{ argv[i] };
+
+        if (argument == "-v" || argument == "--version")
+        {
+            std::printf("%s v%d.%d.%d %s\n%s\n", PROGRAM_NAME, VERSION_MAJOR,
+                        VERSION_MINOR, VERSION_PATCH, PROGRAM_RELEASE,
+                        PROGRAM_COPYRIGHT);
+            return ExitCode::Success;
+        }
+    }
+
+    switch (parser.Parse())
+    {
+    case 0:
+        break;
+    case -1:
+        return ExitCode::Success;
+    default:
+        return ExitCode::UsageError;
+    }
+
+    // The instruction list can also be the name of a built-in instruction
+    // set, as long as there is no file with that name.
+    std::vector<Instruction> instructions;
+    std::optional<InstructionSet> instructionSet =
+        InstructionSet::FromName(parser.GetParam(0));
+
+    if (instructionSet && !wxFileExists(parser.GetParam(0)))
+    {
+        instructions = instructionSet->Instructions();
+    }
+    else if (!Instruction::ReadFile(parser.GetParam(0), instructions))
+    {
+        std::fprintf(stderr, "Unable to read %s\n",
+                     static_cast<const char*>(parser.GetParam(0).ToUTF8()));
+        return ExitCode::UsageError;
+    }
+
+    for (auto& instruction : instructions)
+    {
+        wxString error;
+
+        if (Pattern::IsPattern(instruction.Name()) &&
+            !Pattern::Parse(instruction.Name(), &error))
+        {
+            std::fprintf(stderr, "%s isn't a valid pattern: %s\n",
+                         static_cast<const char*>(
+                             instruction.Name().ToUTF8()),
+                         static_cast<const char*>(error.ToUTF8()));
+            return ExitCode::UsageError;
+        }
+    }
+
+    wxString includePatterns{ "*.s;*.S;*.asm" };
+    wxString excludePatterns;
+    parser.Found("i", &includePatterns);
+    parser.Found("e", &excludePatterns);
+
+    FileFinder finder;
+    finder.SetIncludePatterns(includePatterns);
+    finder.SetExcludePatterns(excludePatterns);
+
+    std::vector<wxString> paths;
+    std::vector<wxString> names;
+
+    for (size_t i = 1; i < parser.GetParamCount(); i++)
+        ExpandArgument(parser.GetParam(i), finder, paths, names);
+
+    BatchSearch search{ instructions };
+    search.SetPrintLines(parser.Found("l"));
+    search.SetUseIndex(parser.Found("x"));
+
+    wxString dialectName;
+
+    if (parser.Found("d", &dialectName))
+    {
+        std::optional<Dialect> dialect = Dialect::FromName(dialectName);
+
+        if (!dialect)
+        {
+            std::fprintf(stderr, "Unknown dialect %s\n",
+                         static_cast<const char*>(dialectName.ToUTF8()));
+            return ExitCode::UsageError;
+        }
+
+        search.SetDialect(*dialect);
+    }
+
+    long jobs{ 0 };
+
+    if (parser.Found("j", &jobs))
+    {
+        if (jobs < 1)
+        {
+            std::fputs("The number of jobs must be at least 1\n", stderr);
+            return ExitCode::UsageError;
+        }
+
+        search.SetThreadCount(static_cast<unsigned>(jobs));
+    }
+
+    wxString formatName;
+
+    if (parser.Found("f", &formatName))
+    {
+        std::optional<ResultWriter::Format> format =
+            ResultWriter::FormatFromName(formatName);
+
+        if (!format)
+        {
+            std::fprintf(stderr, "Unknown format %s\n",
+                         static_cast<const char*>(formatName.ToUTF8()));
+            return ExitCode::UsageError;
+        }
+
+        search.SetOutputFormat(*format);
+    }
+
+    wxString outputDirectory;
+
+    if (parser.Found("o", &outputDirectory))
+    {
+        if (!wxDirExists(outputDirectory) && !wxMkdir(outputDirectory))
+        {
+            std::fprintf(stderr, "Unable to create %s\n",
+                         static_cast<const char*>(outputDirectory.ToUTF8()));
+            return ExitCode::UsageError;
+        }
+
+        search.SetOutputDirectory(outputDirectory);
+        search.SetOutputNames(names);
+    }
+
+    wxString statsPath;
+    wxString tracePath;
+    parser.Found("stats", &statsPath);
+    parser.Found("trace", &tracePath);
+    SearchStatistics statistics;
+
+    if (!statsPath.empty() || !tracePath.empty())
+        search.SetStatistics(&statistics);
+
+    // A comparison searches the baseline and the current build together,
+    // so it needs exactly one of each.
+    wxString baselinePath;
+    bool compare = parser.Found("c", &baselinePath);
+
+    if (compare && paths.size() != 1)
+    {
+        std::fputs("--compare needs exactly one source file\n", stderr);
+        return ExitCode::UsageError;
+    }
+
+    bool succeeded = compare
+        ? search.Compare(baselinePath, paths[0], stdout)
+        : search.Run(paths, stdout);
+    statistics.Finish();
+
+    if (!statsPath.empty() && !statistics.WriteJson(statsPath))
+    {
+        std::fprintf(stderr, "Unable to write %s\n",
+                     static_cast<const char*>(statsPath.ToUTF8()));
+        succeeded = false;
+    }
+
+    if (!tracePath.empty() && !statistics.WriteTrace(tracePath))
+    {
+        std::fprintf(stderr, "Unable to write %s\n",
+                     static_cast<const char*>(tracePath.ToUTF8()));
+        succeeded = false;
+    }
+
+    return succeeded ? ExitCode::Success : ExitCode::SearchError;
+}
@@ -0,0 +1,305 @@
+// BatchSearch.cpp - Defines the BatchSearch class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BatchSearch.h"
+
+#include <unordered_map>
+#include <wx/filename.h>
+#include "ScopedTimer.h"
+#include "SearchEngine.h"
+#include "UsageComparison.h"
+
+namespace
+{
+    void Append(std::string& output, const wxString& text)
+    {
+        wxScopedCharBuffer utf8 = text.ToUTF8();
+        output.append(utf8.data(), utf8.length());
+    }
+}
+
+bool BatchSearch::Run(const std::vector<wxString>& paths,
+                      std::FILE* output) const
+{
+    std::vector<wxString> savePaths(paths.size());
+
+    if (!outputDirectory.empty() && !FindSavePaths(paths, savePaths))
+        return false;
+
+    std::vector<SourceFile> sources(paths.size());
+    std::vector<bool> opened(paths.size());
+
+    {
+        ScopedTimer timer{ statistics, SearchStatistics::Phase::Open };
+
+        for (std::size_t i = 0; i < paths.size(); i++)
+            opened[i] = sources[i].Open(paths[i]);
+    }
+
+    SearchEngine engine;
+    engine.SetThreadCount(threadCount);
+    engine.SetUseIndex(useIndex);
+    engine.SetDialect(dialect);
+    engine.SetStatistics(statistics);
+
+    // The matches are in file order, so the rows of each file follow the
+    // rows of the file before it. Once every chunk of a file has been
+    // merged, no thread reads it again and it can be printed and closed.
+    bool succeeded{ true };
+    std::size_t nextFile{ 0 };
+    std::size_t nextRow{ 0 };
+
+    auto printFiles = [&](std::size_t fileCount, const MatchTable& matches) {
+        ScopedTimer timer{ statistics, SearchStatistics::Phase::Display };
+
+        for (; nextFile < fileCount; nextFile++)
+        {
+            MatchTable fileMatches;
+            fileMatches.Reset(instructions.size());
+
+            for (; nextRow < matches.Size() &&
+                   matches.FileId(nextRow) == nextFile; nextRow++)
+            {
+                fileMatches.Add(matches.InstructionId(nextRow),
+                                matches.LineNumber(nextRow),
+                                matches.Offset(nextRow));
+            }
+
+            FileResult result;
+
+            if (opened[nextFile])
+            {
+                result = Report(paths[nextFile], savePaths[nextFile],
+                                sources[nextFile], fileMatches);
+
+                // A damaged compressed file is searched up to the damage.
+                if (sources[nextFile].HasReadError())
+                {
+                    result.error += "Unable to read all of ";
+                    Append(result.error, paths[nextFile]);
+                    result.error += '\n';
+                }
+            }
+            else
+            {
+                result.error = "Unable to read ";
+                Append(result.error, paths[nextFile]);
+                result.error += '\n';
+            }
+
+            std::fwrite(result.output.data(), 1, result.output.size(),
+                        output);
+
+            if (!result.error.empty())
+            {
+                std::fputs(result.error.c_str(), stderr);
+                succeeded = false;
+            }
+
+            sources[nextFile].Close();
+        }
+    };
+
+    engine.SetProgressCallback([&](const SearchProgress& progress,
+                                   const MatchTable& matches, std::size_t) {
+        if (statistics != nullptr)
+            statistics->Add(SearchStatistics::Counter::Updates);
+
+        printFiles(progress.filesScanned, matches);
+    });
+
+    MatchTable matches;
+    engine.Search(sources, instructions, matches);
+    return succeeded;
+}
+
+bool BatchSearch::Compare(const wxString& baselinePath, const wxString& path,
+                          std::FILE* output) const
+{
+    const wxString paths[]{ baselinePath, path };
+    std::vector<SourceFile> sources(2);
+
+    {
+        ScopedTimer timer{ statistics, SearchStatistics::Phase::Open };
+
+        for (std::size_t i = 0; i < sources.size(); i++)
+        {
+            if (!sources[i].Open(paths[i]))
+            {
+                std::string error{ "Unable to read " };
+                Append(error, paths[i]);
+                std::fprintf(stderr, "%s\n", error.c_str());
+                return false;
+            }
+        }
+    }
+
+    SearchEngine engine;
+    engine.SetThreadCount(threadCount);
+    engine.SetUseIndex(useIndex);
+    engine.SetDialect(dialect);
+    engine.SetStatistics(statistics);
+
+    std::vector<ScopeTable> scopes;
+    engine.SetScopeTables(&scopes);
+
+    MatchTable matches;
+    engine.Search(sources, instructions, matches);
+
+    UsageComparison comparison;
+    comparison.Compare(matches, instructions.size(), scopes[0], scopes[1]);
+
+    ScopedTimer timer{ statistics, SearchStatistics::Phase::Display };
+
+    // The totals come first with * as their function, followed by every
+    // change in a function, the largest first.
+    auto print = [&](const std::string& scope,
+                     const UsageComparison::Row& row) {
+        std::string text{ scope };
+        text += '\t';
+        Append(text, instructions[row.instruction].Name());
+        text += '\t';
+        text += std::to_string(row.baseline);
+        text += '\t';
+        text += std::to_string(row.current);
+        text += '\t';
+        text += std::to_string(row.Change());
+        text += '\n';
+        std::fwrite(text.data(), 1, text.size(), output);
+    };
+
+    for (const UsageComparison::Row& row : comparison.Totals())
+        print("*", row);
+
+    for (const UsageComparison::Row& row : comparison.Functions())
+        print(comparison.FunctionName(row.function), row);
+
+    bool succeeded{ true };
+
+    for (std::size_t i = 0; i < sources.size(); i++)
+    {
+        if (sources[i].HasReadError())
+        {
+            std::string error{ "Unable to read all of " };
+            Append(error, paths[i]);
+            std::fprintf(stderr, "%s\n", error.c_str());
+            succeeded = false;
+        }
+    }
+
+    return succeeded;
+}
+
+bool BatchSearch::FindSavePaths(const std::vector<wxString>& paths,
+                                std::vector<wxString>& savePaths) const
+{
+    // Files are compared without case, as a file system that ignores case
+    // would save both to the same file.
+    std::unordered_map<std::string, std::size_t> saved;
+    bool succeeded{ true };
+
+    for (std::size_t i = 0; i < paths.size(); i++)
+    {
+        wxString name = i < outputNames.size() ? outputNames[i] : wxString{};
+
+        if (name.empty())
+            name = wxFileName{ paths[i] }.GetFullName();
+
+        wxFileName savePath{ name };
+        savePath.MakeAbsolute(outputDirectory);
+        savePath.SetExt(ResultWriter::Extension(outputFormat));
+        savePaths[i] = savePath.GetFullPath();
+
+        std::string key{ savePaths[i].Lower().ToUTF8() };
+        auto [existing, added] = saved.emplace(key, i);
+
+        if (!added)
+        {
+            std::string error{ "The results of " };
+            Append(error, paths[existing->second]);
+            error += " and ";
+            Append(error, paths[i]);
+            error += " would both be saved to ";
+            Append(error, savePaths[i]);
+            std::fprintf(stderr, "%s\n", error.c_str());
+            succeeded = false;
+        }
+    }
+
+    return succeeded;
+}
+
+BatchSearch::FileResult BatchSearch::Report(const wxString& path,
+                                            const wxString& savePath,
+                                            const SourceFile& source,
+                                            const MatchTable& matches) const
+{
+    FileResult result;
+
+    for (std::size_t i = 0; i < instructions.size(); i++)
+    {
+        Append(result.output, path);
+        result.output += '\t';
+        Append(result.output, instructions[i].Name());
+        result.output += '\t';
+        result.output += std::to_string(matches.Count(i));
+        result.output += '\n';
+    }
+
+    if (printLines)
+    {
+        for (std::size_t row = 0; row < matches.Size(); row++)
+        {
+            Append(result.output, path);
+            result.output += ':';
+            result.output += std::to_string(matches.LineNumber(row));
+            result.output += ':';
+            result.output += source.LineAt(matches.Offset(row));
+            result.output += '\n';
+        }
+    }
+
+    if (!savePath.empty() && !SaveResults(path, savePath, source, matches))
+    {
+        result.error = "Unable to save the results of ";
+        Append(result.error, path);
+        result.error += '\n';
+    }
+
+    return result;
+}
+
+bool BatchSearch::SaveResults(const wxString& path, const wxString& savePath,
+                              const SourceFile& source,
+                              const MatchTable& matches) const
+{
+    // A file found in a subdirectory is saved in the same subdirectory of
+    // the output directory.
+    wxString directory = wxFileName{ savePath }.GetPath();
+
+    if (!wxFileName::DirExists(directory) &&
+        !wxFileName::Mkdir(directory, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL))
+    {
+        return false;
+    }
+
+    // Each file is saved while the other files are still being searched,
+    // so the output is written on this thread rather than another one.
+    ResultWriter writer{ outputFormat };
+    writer.SetBackground(false);
+    return writer.Write(savePath, Span<SourceFile>{ &source, 1 },
+                        Span<wxString>{ &path, 1 }, instructions, matches);
+}
@@ -0,0 +1,163 @@
+// BatchSearch.h - Declares the BatchSearch class.
+//
+// Copyright (C) 2024 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BATCH_SEARCH_H
+#define BATCH_SEARCH_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <wx/string.h>
+#include "Dialect.h"
+#include "Instruction.h"
+#include "MatchTable.h"
+#include "ResultWriter.h"
+#include "SearchStatistics.h"
+#include "SourceFile.h"
+
+/// @brief Searches many files for the same instructions at once.
+///
+/// Every file is split into chunks that share the same pool of threads, and
+/// the results of each file are printed as soon as it and all the files
+/// before it are done.
+class BatchSearch
+{
+public:
+    /// @brief Constructor; creates a new instance of BatchSearch.
+    /// @param instructions The instructions to search each file for.
+    explicit BatchSearch(std::vector<Instruction> instructions)
+        : instructions{ std::move(instructions) }
+    {}
+
+    /// @brief Sets how many threads search the files.
+    /// @param count The number of threads. Zero uses one per hardware
+    /// thread.
+    void SetThreadCount(unsigned count) { threadCount = count; }
+
+    /// @brief Sets whether every matching line is printed.
+    /// @param enabled True to print matching lines after the counts.
+    void SetPrintLines(bool enabled) { printLines = enabled; }
+
+    /// @brief Sets whether each file is searched through its saved index.
+    /// @param enabled True to use the index saved next to each file,
+    /// building it first if it is missing or out of date.
+    void SetUseIndex(bool enabled) { useIndex = enabled; }
+
+    /// @brief Sets how the mnemonic of each line is found.
+    /// @param newDialect The dialect of the files.
+    void SetDialect(const Dialect& newDialect) { dialect = newDialect; }
+
+    /// @brief Sets the directory the annotated results are saved in.
+    /// @param directory The directory, or an empty string to not save them.
+    void SetOutputDirectory(const wxString& directory)
+    {
+        outputDirectory = directory;
+    }
+
+    /// @brief Sets where in the output directory each file's results are
+    /// saved.
+    /// @param names The path to save the results of each file at, relative
+    /// to the output directory and in the order of the files given to
+    /// Run(). A file without a name is saved under its file name.
+    void SetOutputNames(std::vector<wxString> names)
+    {
+        outputNames = std::move(names);
+    }
+
+    /// @brief Sets the format the results are saved in.
+    /// @param format The format of the files saved in the output directory.
+    void SetOutputFormat(ResultWriter::Format format)
+    {
+        outputFormat = format;
+    }
+
+    /// @brief Sets the statistics that the search is measured in.
+    /// @param newStatistics The statistics to add the time of each phase
+    /// and the counters to, or nullptr to not measure the search. Must
+    /// outlive any search.
+    void SetStatistics(SearchStatistics* newStatistics)
+    {
+        statistics = newStatistics;
+    }
+
+    /// @brief Searches files and prints the results in the order given.
+    /// @param paths The paths of the files to search.
+    /// @param output The stream to print the results to.
+    /// @return True if every file was searched, otherwise false. Nothing is
+    /// searched if the results of two files would be saved to the same
+    /// path.
+    bool Run(const std::vector<wxString>& paths, std::FILE* output) const;
+
+    /// @brief Searches two builds of a program and prints how the count of
+    /// each instruction changed, in total and in each function.
+    /// @param baselinePath The path of the earlier build.
+    /// @param path The path of the current build.
+    /// @param output The stream to print the changes to.
+    /// @return True if both builds were searched, otherwise false.
+    bool Compare(const wxString& baselinePath, const wxString& path,
+                 std::FILE* output) const;
+private:
+    /// @brief The output of searching a single file.
+    struct FileResult
+    {
+        std::string output;
+        std::string error;
+    };
+
+    std::vector<Instruction> instructions;
+    unsigned threadCount{ 0 };
+    bool printLines{ false };
+    bool useIndex{ false };
+    Dialect dialect;
+    wxString outputDirectory;
+    std::vector<wxString> outputNames;
+    ResultWriter::Format outputFormat{ ResultWriter::Format::Assembly };
+    SearchStatistics* statistics{ nullptr };
+
+    /// @brief Finds the path each file's results are saved to.
+    /// @param paths The paths of the files to search.
+    /// @param savePaths Receives the path to save the results of each file
+    /// to.
+    /// @return True if every file has its own path, otherwise false after
+    /// printing the files that collide.
+    bool FindSavePaths(const std::vector<wxString>& paths,
+                       std::vector<wxString>& savePaths) const;
+
+    /// @brief Formats the results of a single file.
+    /// @param path The path of the file.
+    /// @param savePath The path to save the results to, or an empty string
+    /// to not save them.
+    /// @param source The file that was searched.
+    /// @param matches The matching lines of the file.
+    /// @return The text to print for the file.
+    FileResult Report(const wxString& path, const wxString& savePath,
+                      const SourceFile& source,
+                      const MatchTable& matches) const;
+
+    /// @brief Saves the matching lines in the output format, the same way
+    /// the GUI's File -> Save does.
+    /// @param path The path of the file that was searched.
+    /// @param savePath The path to save the results to. Any directories
+    /// missing from it are created.
+    /// @param source The file that was searched.
+    /// @param matches The matching lines.
+    /// @return True if the file was written, otherwise false.
+    bool SaveResults(const wxString& path, const wxString& savePath,
+                     const SourceFile& source,
+                     const MatchTable& matches) const;
+};
+
+#endif
@@ -0,0 +1,4 @@
+mov a
+lw b
+MOV c
+lw $t0, 8($sp)
@@ -0,0 +1,13 @@
+	.text
+main:
+	mov a
+	call f
+	call g
+helper:
+	push x
+	push y
+	pop y
+	pop x
+	.data
+fresh:
+	mov d
@@ -0,0 +1,9 @@
+	.text
+main:
+	mov a
+	mov b
+	call f
+helper:
+	push x
+	pop x
+	mov c
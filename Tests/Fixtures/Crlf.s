@@ -0,0 +1,5 @@
+mov a
+lw b
+
+mov c
+lw d
@@ -0,0 +1,11 @@
+
+
+mov a
+
+
+mov b
+
+ 
+	
+lw c
+
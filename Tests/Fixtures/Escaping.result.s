@@ -0,0 +1,8 @@
+	mov "a", b # Line 2, 
+	mov a,b,c \ x\n # Line 3, 
+	mov	xy # Line 4, 
+	mov  not UTF-8 # Line 6, 
+	mov été, 加 # Line 7, 
+	mov last\ # Line 9, 
+	push "quoted, with a comma" # and a comment # Line 5, 
+	push {r4, lr} # Line 8, 
@@ -0,0 +1,9 @@
+# Text that has to be escaped when the results are saved.
+	mov "a", b
+	mov a,b,c \ x\n
+	mov	xy
+	push "quoted, with a comma" # and a comment
+	mov  not UTF-8
+	mov été, 加
+	push {r4, lr}
+	mov last\
\ No newline at end of file
@@ -0,0 +1,7 @@
+# comment
+main:
+	.text
+loop: addiu $t0, $t0, 1 # inc
+	.word 4
+1: 2: bne $t0, $t1, loop
+size = 16
@@ -0,0 +1,3 @@
+mov alw bmov c
+lw d
+mov e
\ No newline at end of file
@@ -0,0 +1,5 @@
+x bbaaaaaaaababaabaabbbabbabbbbbabbbabbabaabbbbbbbabaaabaabbbabaaabbbabbbabaabaaabbabaaaaaababbaaababbbabbaabbabbaababaabbabbababbabbabbbaaaababbbbabbaaaabaabbbbabaabbbbabbaabaaaaaabbabbaaaababaaaabbbabbabaaaaababbabaaabbbbbbaabbaabbbaabbabbbabbabbaaabaaaaababaabaaabaabbabaaababbaabaaababbabababaaaaaaabbbbbabbbbaabbabbbabbbbaabaaabbabbaaaaaababaaaaaaabababaaabaaabbbbabbbbbaaaaaabaabaabbaabababbbaabaabbabaaaababbabbbbaaaaabababbaababbbbbbaabaabbabaaaaababbbababbababbabbaabaaaabbbababbbaaabaaaababbabaabbaaaaaabababaaabaaabaaaababbabaaaababbabbbaabbaabababaabbababbaaabbaaaabaabbababbabbaabaaaabbbbbabaabbaabbabaababbaababbaababbabababaabbabbaaabaaaabbbbaaabaaaabbbbbbabbababaaaaabaaabbaabaabbbbbbabbabbbbaaababbbbbaaabaaabbbababbbababbbabbbbaabaaabbbabaabbbbbaabaaaaaabaaabababaabbabbabbaabababbabbabbbbbbabaababbbbababbabbbabaabaaabaabbaaaaaaabbabbabbaaabbbaaaaabaababbbbaababbabaaaabbbaaaabbabbbbaabbabbbbbbbaaaababaaabababbbaaabbbabaababaaaabaababbaaabababbbababbabbbbababababbabbbabbbbabaaabaaaababbbaaabbabbabaabaaaabbabbbababaabaaabaaabaaaaababaabbabbaabbabaaabaaababbbbababababababbbaababbbbababbabbaabaaaaabaabbbabbbbaababaababaababaaababbbbaaabaaaabbbbabbaabbaaaabbbbbbaababbbabbbbbabbbbaaaaabaaaaaaaabbbbbaabbabbaaabbbbaaabbaabaaaaabaababbbbbabaaaabbaabbbabbbbbbababbabbabaaabbababbbaababababbbbbabaababbbaaaabbabaabbabbbbaaaaaabaabbaabaabbaaaabbaabbbbabbaabaaabbbaaabbbbaaaabaaaabaaaaaaabbbbabbabbbbbaaabbbbbbabaababaababbbbbbaaaabaabbbaaaaaababbabbaabbbabaabbbaababbbbabaabbabbbabbaaabaaabaabbabbbaabbabababababbbabbbabbaaaaabaaaaaaaaabbbbaaababbbabbbaaaabbaaababbaabaababaababaababaabbbbbbabbbbbaaaababbbbaababbabbbaabbbabbaaabaabbabbabaaaabbabbbababaababbbabbaabaaabbabbbbbaababaaabaababbbabbbbbbaabababaabaaaaaabbbaaabbbbbbabaaababbaabbbbbabbaaabbbbaaabbbabbaaabaabbaababaaabbaabaaaaaabbbbbabbbaaaaaabbbbaabbbaaaaabbbbabaabbaaaaabbbbaaabbbbbababbaaaaabbbabbababaabbbbaabaabababbaaaababaababbaaaabbaabbbbbabbbabbbaaabbbbabbbaaabbabbabbabbabbaabbbaaabbbaaaaaaabaaaabbbbbaabbabaabaaabaaaaaaaaaabaaaabaabbaaaaaabaabbbabbaaaabbababaaaaaabaabaaaabbbbbbbaaaaaabbbbaabababaaaaaabbababaabbbbabaaaaabaaaabbabaabbbbbbaababbbbababaabbbabbbbaaababbbaabbaabbaaabbabbabbbababbaaaaababbabbaabbababbabaaaaabbaaabbaababbabaabbbababaaabbbababaaababbbabbababbaaabbaabbbabaaabababaaaabbababbabbbbbbaabaabbaaabbabbaabbbaabbabbababbabaabbbaabbaaaabbbabbbbbbabbbaaabbaaaaabbaaababaabbbabbbaabbaabababbbbabaaaaabbabaabbbaabbaaababaabaaabaabbabbabaaaaababbbbbaabaaabbbabbbabaababbaaabbaaabbbbabaaabbbbabbabaaabbabbbabbaabababababbaabaaabaaabaabbbbababbabbaababbaaabbabbabbababbaaababbaabaababbaaabbaabbbbabbabbbabababbaabaaaabbbabbbabaaaaaaababaaaabbabbabbaabbabbaababbbaabbaabbaabbbbaabbbabbbbbaaaababbbaaabaaaabbbaabaababbbabbaaaabaaaababbbaaaababaaababbbbbabaaabbaabaaababbbbaababbbababbababaaababaababbababbbbbababbabbaaabbbbbaaabbaaababababaaaaaabbbbabaabbbbbaaabbaababaabaababaaababaabaaabaaabababbbaababaaaaaaabababbababbaabbbbbbaaaaabbbbbbaaaaabaaaabbaabaababaaaababababbbbabbbabaaaaaababbbaaaaaabaaabbbabbabbaaaaaaaaabaababbaabbbbabbbabaaaabaababbbaaabaaaabbabbabaaaabbbbaababbabaabaaaaabbbbbbabaababbabbabaaaababbabbbabbbaaaaabaababbbaaabbaaabbaabaaabbaababbbaaaabbaabbbbbbababaababaaaaabbaabaabababbbbabaabbaabbbbbbaabbbaaabbbaaaabaabaaababbaababbaaaaaaaaabbbbaaabaabbaaaabbbaaaabbaaaaabbaababbbaaaaaaaaaaabaabababababbbabbaabbabaaabbabaabaaaaaaababaaababbbabbbbbaabaaabaabbaaababbbbbbbaaaababababbbbaaaabbbbbbaabbbabaababbabaaabaabbaabbaabaaaaabbabbaabbbbbabababbbababbbababababbaaaaaaaaaabbabbbbbababbaaaaaaaaabbaabbbbbaabbbbbbaaaabbbbbbbbbabaabbabbababaabaaaabbbaabbaabbbaaabaaaabaabababbbabbbaabababbabababbabbaabababaaabaabbbbbbbaabaaaabbabababbaaaabbbbaaabbaabaabbaabbbbbbbaaaaaaaaabbaabbbaaaaaabbaaaaababbabbbaaaaaaaababbbabbabababbbbbaabbbbabbbbbababbbbbbaabbababbabaabaabbaabaaaaaaabbabaababababbbbaabaabbaabaaaababbababaabbaabbbabaaabbbbabaabbbaabbaabbaabbabbababababaabaabbbbabaaaabbaabbaabaaabaabbbbababbbbbabaaaabbabbabababbaababbbbababababbababbbbbbaabbbabbaaabbaaabbbabbaaaaabbaaababbabbabbbbbababaababaababbbbabaaabbaaaabaaaaaabbbbaabbbbaaaaabbabbbabbbbaabbaaabababbbbbabbaabbbbbabbaabbaaaababaaaaabaaabababaabbbbababababbbbbbbabbabbababbaaaabaabababababbbabbaaaaabbbbaaabaaabbbaabbbbaaaaabbaaabbaaababababababbbaababaabaaaababbbababaaabaaabaaabababababaabbbbabaabbabbaaaababaaabbbbaababaababaaaabbbbbbaaabaaaaaaaabbbaababaabbabaabaaaaabbabbbaabaaabababbaababbaabaaaaaaaaabbabbbabbaabbaaaabbbaaabaaabbabaaaaaaabababaaabbbabbbbabbaababaaaabaaaababbaabbbbbbaabaaabbbaabaaabbbbbbabbaabbabaabbaabbaaaababbbbaaabaababaaabaaabbabbabbbaaaaaabababaaababbaababaabbbaabaababaabbbabaabbbabaaaaababbbabbabaaaabbbaabaaabbbbbaaaabbbabaabaaababbbbaabaaaabbabaaaabbaaabbbbbbabbaaaabbbaaaaaaabaabbbaabaabaaaaabbbaabbabbababbbaabbaabbbaaabbbbbbaabbbaabaaabbabbaabbbabbaaaabaabaabbabaaaabbbbaabbbaaaabbbbabbbabaabaaaaabbaaaaaaabaabaabababbababbababbbbaabbabbbabbbaabbaaabaaaabbbbbbbbaaaababbbbbbbbaabbbaaabaabbaaabaaababaabbbababaaabaabbbbabbbbaaabbabaababbbbbbaabbaabbbaaabaaaababaaabbbabaaabbbbababbbbbababaaababaaaaabaaaaabbabbbaaabbbbaaabbbaaaaababaaaababaabbbabababbbaabababbabbbbbabbbabbbbbabbaabbbbbabbbaababbbbbababbbbaaaaaaaaaaababbabbbbaaababaaababbbababbaabababaaabbbbbabbbbbbabbabbaaabaabbbbaababbaaaaabbaaabbbaabbaaabbbbbabbabbabbababbaabababaabaabbabababbaaabbbaaaaaababbaababbbbabaabbabaababbabbaabababbbbbbbaaaaababababbabbbaabaabaaababbababbaaabaabaabaabaabbbbaabbabbbaaaabbabbaaaaabababbbbaabbaabbaaaaababaababbbaababbbbabaabbaabaabaaaaaabaabbaabbaaaabbabbbaabaabbabbaaabbbaaabaaabbbaabbbbbaaababbbabbababbababbaabbaabaabbaaabbabaaaabaabbbabaaabbbbbababaaabaabbbbbbbbbbbabbaababaabbbbaaabababaaababbbabaabbabaabbaaabbbabbbbaabaaaabbbbbaaababbbaaabbbbbbbaababbaabbabbabababbabaababbbabbbabbbbbbaabbbbaaaababbbbbaabaababbbaaabababababbbabababbaaaababbbaaababaabababbababbabbaaabbaaabaabaababbbabbababbaabbbababbbaaaababbabaabbaabbaababaabbbbabaabbbabaaababbabbababbbaabaababbbabbaabbbbaabbaaaaabaaabbbaaaaaaabbaaaabbaabaabbaabaabbabbababaababbbabaababbaaabaaaabbbbbbabbbaaabbbbbbbabaab
+x bbbaaaaaaaaaaaabaaaaaaaabbabbbabbaabbaaaababaabbaaabaabababbbbaababbbbabbbbabbbababaaaaabbaaaaaabbabaababaaaabaabbbaaaaaababbbbaabbabbbbbbabbabbbaaaabbbabbbbbbaaaabbbaababbaaabababbbbbaabaabbaaaaaaabbbaaaabaaabababaabbababbabbbbbabaaaabaabbabbbbaabaaabbababbbbbbbbbbbabbbabababbbabbaaabababbbbbbbbbbabaababaabbbbabbaaabaababaabbaaabaaababbabaababbaababaaaaaabbaaaaaaaaaaaaaaaaaaababbaabbabbaabaaaabaabbabbabababbbbabaabbbbaaabaabbaaaabbbbaaaabbababaabbababbbaabbababbbaabaabbbababbaaaabaaaaabaabaababbbababbaaaababbbabababbbaaaababaabaaabbaaaaababbbbaaabababaabaabaabbbabbbabaaabbbbbaaaababbbbabbaaabaaabaabbbbabbabbbbaabbbabbababababbababaaabbbaababbabaabaaaaabbbaaabbbababababbbaababbabaaabbbbabbbbaaaababbbaabaababbbabbabaaaabbabbbbbbbaabaaaaaabbbbbbbbaaaaabbbbabaabababbaaaaaaaababbaababbaaabaabbaaaaababbbbaababababbbbbaabaababababbbbabbaaabbaabaaabaaababaaabbaabbaabbabababbbaabbaabababbbbbbbabaabababaababaababbbabbaaaabaaabbbaaabbbabaaabababaababababbababaabaabbbbabaaaaaabbaababbaaabaabbabbbaaabbbbaaabababbabbbbabbababbbabaabbbabaabbbabaababbaabaaabbaaabbaaabaabababbabaaabbbbbabaabbaabbababbabbbbabbbbabbaabaaababababaaabbabbaaaabaaababbbbbbbaaabaaabbbbbbbbbabbaabbbaabbbaaabbaababbabaaabbaaaaabaaaaaaaababbaaabbaaaaabbbbbaabbbbbbabbbbbabbbabaababbbabbbbbbabbabaaabbaababbaabababababaabbabbaaabaabbbaaabaabbbbbbabaaaababaabaabaabbaaababbaaababbbbbbaaabbaabbbbbabbabaaaababbabbabaaabaaabaaaaabbbbabbabababbaaaabbbababaabbbbbbaaaaaaaaaababbbbbbabaaaaabbbaabababababbaaaabbbabbbbabbaaabaaaabbaaabbaaaabbaababbbaaaabaabbaabbaaaaaabbabaabbbbaaaaabaabaaaaabaaababaaabbbaabaabbbaabbbbabaabaabbabbbaabbbaaaaaabbaabaabaaababaaaabbbbaababbbbabbababaabbbabbabbaabbbbbababbaaabaabbbbaabaaabaaaaaabbbbbbbbaabbbaababaaaababbaabaaabbbbbbbabbabbbaaaaabbababbbbabaaaaabaabbabbbababbbbbabaabbabbaababbaaaabbbbabbababbbbbbbbabbbbaababbaabaabaaababbaabaabababaabbaabbbabbbbbbbbaabaabbabaaaabbaaaabbaabbaababaaabaabaababbaabbbaaaaaabaabbabaaaabbaaababaaaaaaaaabababaabbaabbbabaaaabbaaaaaaaabbbbbbbabbbaaabbabaabaaabbaabbabaabaaabaabaabaaabbbaabaaabbbabbaaabbbbbaabbbbbbaabbaaababbbabaaabbaaabbabaababbababaabaababbaabbbbabaabbbbaabaaababbbbaabbaababbabaaabbbbbabaabaabbbbabbbabbabbabaabbaaabbbbbaabaabaabbbbaabbabbaaabaaababbabaabbbbbbbabbbbbbaaabbabaaabbaababbbabaaabbabaabababaabbabbbaaabbbbabaaabbabbabbbbaabbbaabbaabbaabbaaaaaaaaabbbbbabbbbbabbbabaababbaabbbbaaababbbababaabbbabbabaabbaaabaaaabbabbbabbaaabbabbabbaabaababbabbbabbaaabaaabaabbabbbbbaaaabaaabbbabaabbabbbabbbabbbaaaabbbaaabaaaaaabbabbaabbabbbabababbabbaaabababaaabababbaaaaaabaaabaaaaaababbabbaaabbbbbbbaaaaaaaabaababababbabaaaaaabbbbbbbaaababbaababbabbaaabbbaaaabababbabbaababbbbbabbaaaabbbbabbbbaabbbbbbabababbabbabbaabababbbababbbaaaabaababbaaabaabbbbaaabaaabbabaaaaaaabbbabbaaaababababbbabbbabaabbbaabaaaaababbbbabbbbaaabbbabbbbaaabbabbaaabaabbbaababbaaabbbabaaaaababbaaababbababaababbbabbabbababaaabababaabaaababaabbbababaababababbbabaaaaaaabbbbbbbbabbbbaabbbaaabaabaaaabbbbaaabbbbbaaaabbabbaababaabbaababaaabbaaaaabbbbaababbabaabaaaababaababbbaabaaabbbaaaaaaabaaaaabbbabbabbbabbabababaaaabbaabababbaabbbaabbabaabaaaaaaabbbbbabbbbbabaaaabababababbbbabbbbbabbbbaababbbaaabababbababaababaabaaabbbaaaaaaabaababbbabbaabbbbaaaabaaaaaaabaaaabbabbaabbbaabaaabbabbabbaaaabbbababbaaabaabbaaabaaaabbbabbbbbbabababbaaababaabbabababbbbbbbaaabbabbbbaabbabbaabaaaaaaabbabaabaababaabbabbabbbbbbbaababbaaababbbaabbbbbbabbabbbbabaaaabaabaabbbaaaaabababbbababbabaaabaabbabbaaababbbaaaaaababbaabbbbabbaabababaabbbbbbaababaaaaaaabbaabaabbbbbbbaababaabaabbaababbbabababaaaabababaaaabaaaaabbbbabaaabbaabbbabbabaaabbaabaaaabaabaabbaabbbbaaababbabaaaabbbbbbbbbabbbbabaabbabbbabaaabababbabbbbabababbbaaabaabaaabbbbabaababababbbaabaaabaaabababbabaaabbaaaaaababbbaabbabbaabaaaabbbbbbaaababbabbbbbababaaaabbababbbbabbabbababbbabbaaabaabaabbbbabaabaababbaabaaabbaabaababbbaaaabbaaaabaaaabaaaabaababaabbababbabbbababbaabaababababaabbbbbababbbbabbaaabbbaaaaaabaaaabbbabaaabbaabbababbabbbbbbabaabbbbbbbaaabbabababaababaaaaaaabaabaabbababaababababbaaaababbabaababababbababbbabbabbaaabaaabbababbabbaabaabbbabaabaabbbababbbbaaaaabbabaabbbbbababbabbbbbbabbabaabaaaaaabbabbbabaaabbbabaaabbbbaababaaabaaabbbaabbaaabbababbabaaaaabbbaaaabaaaaaabbbabbaabbbbbababbaabbaabbbbaababaaabaabaababbbbaabbbbaabbaaaababababbabbbbbababbbbbbbbbbabaabbaabaabbbbaabbaabaaaaababaaabbbbaabababaaabaaabaaabaabbbbabbabbabbbabababababaaaabbaabbabaaabaaaaabaaababbabbaabaabbaabbbabaabababababbaabaabaabaaaaabbaababbaabbbabababbbaaabaababbbababababbbbbabbababbaabbaaabbaabaaaabababbbbaabaababbaaabababaaabaaabbbbbbababababaababbbbaabaaababbbbaabbbababbaaaaabaaabbbababbababbababbbbabbababbbaabaabbaaababaaaaaabababaabbaaabaabababbbbaababbbaababbaababbbbbabaaaaabbabbaabbbabbababaababaaabbaabbbbbbabbbbbbaaaaabbbaaaabbbaabbaabbabaaaaaaaaabbbbaaabbbbbabbbabbbaabbababaaaabbbaabbaaaaaabaabbbbaabaabaaaaaaaaababbaaabbbbaaaabaaaaaaabaabbbaabbaabbabbbbbbbbbabaaabbbbbabaaaaabaaaaabbbabaababbbbbbababbbbbabbaabaaabbaabbbabbbbabaabbbbbbababaababbbaaaabaaababbbbbabaaaabbaababbaaaaabaaabbaababababbaaabbbbababbbaaababbbababababaabbabababbaaabaaaabbbbbabbaabaabbbabbaaabaaababababbbababbaababbbabababbaabaabababbababbabbbbaaaaabbbabbababaabbbaaaabaaaabbaaaabbaabbaabaaabbbbabbaaaabababbabbbbbbbbaaaabbbabbabbaaaabbbabbaabbbbaaababababaaabaaabbbaabbbbabbbbababaabaaaababbbbbbabaaababbbabbbababbbaaababaaabbbbabbbbbaaabababbbabababaaaaabababbaaabaabbbbbaaaaaabbaabaabababaabaababbbaaaaababababababaaaababaaaabbbbbabaaabbbaaabaaaaabababbaabaabbbaabaabbabaababbaaabbabaaaababbaabaaaabababbabbbbaaabaabbbabaaaabbbbbaabbaaaabbaaaabaababababbbabaabbbaaaaabaabbbbbbbbaaabbaaabbbbaabbbaaabbababbbabaabbbaaaababaabaaabbbbabbbbbbbaabbbbababbabbabbaabbaabbbabbaabbbabaaaaabbbbabbabaabbbbaabaaabbaababaaabababbbbaaabaabbabbaabbbbbbbbbbbbbaabbbbbbabbbbabbaaabaaaaaaabbbbbbaaaaabbbaaabbbaabbbaabbaaabaaababbbbbbbbaabbabaaaabaabaaabaaaaabaabbbabbaaabbbbaaabbbabbbbbabbabbbabbbabbaaababaabbbbbababbbbbaaaaaabbaabaaabbbabbbbbabbbbbababbaaabaabbbaabaaaaabbbbbbbaaabbaaabbaaabbabababbabbaaabaaaabbbabbbabbaaabbabbbaaaabaaabbaabb
+y abababaaaabbaababbabbbbbaabbaaaaabbabbbbbabbbabbaaaabbbbbabbbbaabbaababbbbababaaabbaaaabbbbbaabbaaba
+x aaabbbabbaaaaababbaaaaabaabbabbabaaabaaabaabbbaaabbabbbbababbabbaaaabaabbbbbaaaaabbaababbbabbabaaabbbaabababbaababbaabaaaaaabbabbaaabbaaaababbbabbbabaabbabbbbaaaaaabbaabbabababababbbbaabbbbbbaaaaabbaababbabbbaabbbbabaaaaabaabbbabaaabbbaabbabaaaabaaaabbabaabaaababbaaaaabbabbbaabbaababbbabababaaaaaaabbaabbbabaabababaaababbaabaaabaaaabbbaaaabababbaaabbbbabbabbaababbabaababbbabababaabbaaabbabaababbbaababbbabbbbaababbbabbaaaaabbbaaabaaaaabbbbbaabaaaabbabbbabbaabababaaaabaaaaaaaaaaababbabaaabaaabbbaaabaaabbbbbbaabaaabbababaaaabaaaaabaabababaabbbaababaababaabbaababbaabaaabbabbaababaaaaabbabaaabbbbaabbaaabbbaaabbbabaabaaaaabbaaabbbabbaabbaaabbaaaabbbbbabababbbaaababbabaaababbaaaaaabaaaaaababaabbabaaababbbabbbbbbabaaabbbaabaaaaabbabaababababbabbaabaabbaaaabaabababbbabababbbbbbaaaaaabbbaabbbababbaabbbabbbbbaabaabaabaaaaaabaababaabbbbbbbbaaabbaaaaaaaaaaabbbabaaabaababbbbbbabaaabaaabaabaaababaabbbbabaaabbaaaabbababbbbaaababbbababbbbbabbbbbaaabbbbbababaababbbbabbababbbbbbbabbbbbbabbbbbabbababbabbababbbbaaaaabababbaabbbbbbaabaaabbbaaaaabaaaaaabababaaaaaabbbbaabbbabbaabaabbbbabbababbbbbbaaaaabaabbbbabababbbbaabaababaaaaabbaabaaababaaaabbaaabaabaaaaababbbaabaabaababbbaabababbbbabbabaaabbbbaaaaaaabaabaaabbbbbaabbabbbabaaabaaaabbababbbbaabbbaaababbbbaabaaabbbabbbbabbaabbababaaaabaabbaaabbbbaababaabaababbbaaaabbbbaaaaaabbbaaabaaabababbaaabaabbbaabaaaaaaababaaabbaaabababaabbabbaabbbbbbbaaaababbbaababaaababababbabbaabaababbaabbaabaaaababaababbbbababbababaaaabaabaaaabababbbbababaababbaaaababbaaaababbabbababaabbaaabaabbaaababaabababaabaaabbaabbbaabbbaabaabaabbaaaaabababababaabbabbbbbbaabaababaabbaababbbabbabbbaaabaaababbaabaaabbbaaaaaabababbaabbabbbbababbbbaababaaaaaabaaababaabbbababbbaabbbabaabaabbbbbabbbaabbaaaababbbaabababbbaaabaabaaaabaaaaaabbabaaabaababbabbabababbababbbbbaabababbbababbbabbaaabbabaabbababbbaaaaabbaaababaabbaaabaaabaaaaaabbbbabbababbbababbabbbaababababbaabbbabaabbabaaaabbbaaaaaaaaaabababaaabaaabbbabababbaabbbbaabbbaaabbabaaaababaaaaabbabbabbbabaababbbaabbbbbbaaabbbbabaabbbbbbaababbabababaabaaaabbabbabbbaabbaabbbbbbabaaaababaabbbaaaababaaaaaaaabaaabababbbbabaababaabaabbaaaaababbabbabaabbaaabbaabaaaaabbbbbabbabbbbababbbbbaabbbbaabbbabaaaabbbabbaaaabbabbbaaababbaabbbabbabbaaabbbbabbbabbbbabbaababaabbabaabaaababbbbbbbabbabbaabaaabbabaabaababbaaaaabbabbbababaaabaaababababbbaaaabbbbbabbaabbbbaabaababbabaababbaabaaabaababaaaaaabaababbaaaabbbbbaabbaaaabbabbbbbbaabbabaababbbaaaaabbabaaabaababbbaabbbabbbaaababbaabbaababaaabbbbaabbabaababaabbbaabbaaaaaabaaaababbbbbabbababbbbbaabbaaaaabbabbbbaaaaaabbaabbbaabbbbbaaabaabaabbbbbbaaaabaabbaaaabbaaabaaaababbbaabaaaaabaaabbabbaabbabbaabababbababbaabbabbabbabaabbaabaaabbbbaabbaababbbaabbbabaabaabbabbabaaaababbbbabaabaabbaaabbabbaabaababbaaababbbababbbbbbaabbaaabaabbbbabaabbbaaababaababbbaaaabababaaaabaabbbabbbbabbaaabaaabbbbbababaaaaabbbbabbbaabababbababbaaabbabaabbbaaabbaaaabbabbabbbbbaaabbbbabbaababababbbaabaaabbaababaaaabbbabbbaabbbaaabbbabaaaaaababbbbbaaabaabbaabbbabbaabbaaaaabbbaabbbabbbaaabbbbabbaabaaaaabaabaaaaabbaaaabbbbabababbaaaaaaabbbababaabbaaabaabaaabbbaabbbabaaabababbaabbbbabbbabbbbbbababababababaabaababaaabbabaabbaabbaaaaababbbaaaabbababaaaaababbbbaababbbabbaaababbbabbbabbabaababababbababaabbbbbaabbbabbaaaaaaabaaaabaaabbbbbaabaabaabaaababbaabababbaaababaabbbbabbbbbbbbaaaaaabaaabbaaaaabaaaaaabaabbaaaaabaabbaabbabbabaaabaaaaabbbabbababbbbbababbbababaaaababbabaaabaabaabbaabababbbabbbbabbbbbaabaabaaaabaaaababbbabaaabaabbbbbbbbbbbababbbabbbaababaabaaababaabababaabaaaaaaaaaabbaababbbbabbaaaabaabbbbbbaabbbbaaabbabaaabbbaabbaaabbbaabbabbabbaabbbaabbbbbababbbababaababbbbaabbbaaabbaababaabbaaaaabaabbbaabbabaaaaabbabbbbaabaaaaabbbaaaababbabababaabaaaaaaababababbbbbbaaaabababbbabaaaaabbaababaabbaaabaabaabbaaabaabbabababababaaabaabbbbbaaaabaabababaaaaaabaababaabaaabaabbaaabbbbbbaaabbabbbbaabbbabbbbabbaabbbaaabbabaaaababbabbbbaabbaaabbbbbabbbaaababababbaaabbaaabaabbbbbabbaababbbbbabbaababbbaabaabbabaaaabbaaaaababbbbaaaababbbbbaaaaaabbabaaabaaaaabababbaabbbbbbbbaabbaaabbbabbababaabbbbaaaabaaaabababaabaabbaaaabbaaabaaaaaaababbbaababbabbbbabababaaabaababbbabbbabaaaaabbababaaaabbaababbaabbabaabbaaaabaaaabaaabaaabbbabaaaaaabbbbabababbabbaabbbabbbabbbbbbbbaaaaaaabbbbaabababbbaaaaaabaabbbbbaaabbabaabbaabbbbabaabababaabbbabaabbababbababaabbbabaababababaaaababaaaababbbabbaaaabaaaabaababbabaabaabbbbbabbbabbbabbababaabbaabbbbababbbbaabbabbaabbbabbaabbaabaaabaabaababababaaabbbababbbbbbbaabababaaaabbbaabbbaaabaaabbaabbbabaaaaaaababbbbbaabbbabbabbabaaabbbbabbbabbababbbbabbabaaaaababbbabbbaaaaabaaabaabbbabbabaaaaababaaaabbabbabbbbbaabaaababbbbaabaababbbaabaaabbbbbabbbbaabbaaaabaaabbaababbbaaaabbaabbbbabbbaaabbbbbbabbabbbbaababaabbabbababaabaaabbaaabaaaaaababbbabbbbababbabaaabababbaabbbbbaaaaaabbabaabaabbabaabbbaaabbbaabaabbaababaaaabbabbbbbbbbabbbabbaababaaabababbbabbaaabbbbaabbaaabbbabbbbbbbaabbbaabaababababaaabbbabbaaabbaaaababbbaaabbbababbbabaabaababbbaaabbaaaaabaaaabbbbbbbabbbaaaaabbaaabbbbbbaaabbabbaabbabaabbaabbababbbaabababbbbbbabaaaaaabaaaabbabbbbbbaaabaabbabbbabbaababbaaaaababbbbaababaaabbbbaaababababaaabbabababaabaabaabbbaaaabbbaabbbaabaaabbabaaaabbabbbbaaabaaabbabaababbbbaababababbababbaaabaabaaabbbabbabbbabbababbbbaabbaaababbaaabbaababaaabbbabbaaabaababababbababbaabbaaabbaabaaaaaabaabbaabababababbabaabbbbbbabbbbbbaabbabbabaabbaaaaabbabaababbababbababbaaabbabbabaabbaabbaaaababbbaaabbbbabaabbbabbbbbbbbaaaababbbaababaaabbbbbababbbbaabbaabaaabbabbbbaabaababbbabaabbbaabaaabbaabababbabbabbbbababbaabaaabbbbbaababababbbaabbbbaabbabbbababbbaaaaaabbbbabbaaabaabbaabbbbababbababababbabaabbaaabbabbbabbbaaabbabbbbaabababbbabbaababbabbabbaaabaababbbabaabbbbbbabbbbbabbababaabbbbbabaaaaaaaabaababaaaaababababaabbabbbabaaaaaababbbbbbaabaabaabbabbabbbabbbabbbbbaaabbababbbbabbaabbbabaaaaabbbbbabaabababbaabbbbababbabbababbbaaaaabaabaaaabbbbbabaabbaabbaabababbaababbbbaaababaabaaababbbababababbaabbbbabaabaaaababbbbababaabaaabbabaaababbaabbaaaaabababbbbbaabbbbaabbaaababbababbbaaabaaababbabbaababbabbaaaabaaababbbaaabbabaaaaabbbbaaabbbaaaabaaababaababbaaabbbababbabbabbaaaaababbbbbabababb
+x baaaaaaaaaaaaaa
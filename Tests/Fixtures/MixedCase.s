@@ -0,0 +1,6 @@
+MOV eax, 1
+mov ebx, 2
+MoV ecx, 3
+lw $t0, 0($sp)
+LW $t1, 4($sp)
+movl %eax, %ebx
@@ -0,0 +1,9 @@
+; comment
+%define X 1
+section .text
+global _start
+_start:
+	mov eax, 1
+loop: add eax, ebx ; add
+msg db 'hi', 0
+.local: jmp loop
@@ -0,0 +1,3 @@
+lw a
+mov b
+mov
\ No newline at end of file
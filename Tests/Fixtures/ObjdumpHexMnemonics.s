@@ -0,0 +1,16 @@
+
+mips.o:     file format elf64-tradbigmips
+
+
+Disassembly of section .text:
+
+0000000000000000 <add3>:
+   0:	0085102c 	dadd	v0,a0,a1
+   4:	03e00008 	jr	ra
+   8:	0046102c 	dadd	v0,v0,a2
+
+0000000000000010 <x86>:
+  10:	dc c1                	fadd   %st,%st(1)
+  12:	48 b8 00 00 00 00 00 	movabs $0x0,%rax
+  19:	00 00 00 
+  1c:	01 d8                	add    %ebx,%eax
@@ -0,0 +1,16 @@
+
+mips.o:     file format elf64-tradbigmips
+
+
+Disassembly of section .text:
+
+0000000000000000 <add3>:
+   0:	dadd	v0,a0,a1
+   4:	jr	ra
+   8:	dadd	v0,v0,a2
+
+0000000000000010 <sum>:
+  10:	fadd	d0, d1, d2
+  14:	fadd   %st(1),%st
+  18:	add    %eax,%ebx
+  1c:	beef	x
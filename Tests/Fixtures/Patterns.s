@@ -0,0 +1,5 @@
+lw $t0, 0($sp)
+lw $t1, 0($gp)
+LW $T2, 0x200($SP)
+addiu $sp, $sp, -32
+addiu $t0, $t0, 1
@@ -0,0 +1,5 @@
+	mov	eax, 1
+  	 lw	$t0, 0($sp)
+	
+ 	 jr $ra
+mov			ebx,	ecx
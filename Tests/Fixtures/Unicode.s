@@ -0,0 +1,7 @@
+; коммент
+mov al, 'ü'
+möv x
+MÖV y
+加算 r1
+mov z
+MöV w